@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// Throughput of the NLS encoder for all block sizes.
+//
+// The coefficients are calculated from a noisy sensor signal with the
+// in place wavelet transform, as done by DataBlock. Each block is encoded
+// without limit and with the output limited to an eighth of the raw size.
+
+#include <outpost/base/fixpoint.h>
+#include <outpost/base/slice.h>
+#include <outpost/compression/legall_wavelet.h>
+#include <outpost/compression/nls_encoder.h>
+#include <outpost/utils/storage/bitstream.h>
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+
+using namespace outpost;
+
+namespace
+{
+constexpr size_t maximumBlockSize = 4096;
+constexpr size_t samplesPerRun = 16 * 1024 * 1024;
+
+int16_t coefficients[maximumBlockSize];
+int16_t input[maximumBlockSize];
+uint8_t streamBuffer[2 * maximumBlockSize + Bitstream::headerSize];
+
+compression::NLSEncoder encoder;
+
+void
+calculateCoefficients(size_t blockSize)
+{
+    static Fixpoint samples[maximumBlockSize];
+    uint32_t state = 1;
+    for (size_t i = 0; i < blockSize; i++)
+    {
+        state = state * 1664525U + 1013904223U;
+        const double noise = static_cast<double>(state >> 24) / 4.0;
+        samples[i] = static_cast<int16_t>(1024.0 + 512.0 * sin(i * 0.01) + noise);
+    }
+
+    Slice<Fixpoint> slice = Slice<Fixpoint>(samples).first(blockSize);
+    compression::LeGall53Wavelet::forwardTransformInPlace(slice);
+    Slice<int16_t> reordered = compression::LeGall53Wavelet::reorder(slice);
+    memcpy(coefficients, reordered.getDataPointer(), blockSize * sizeof(int16_t));
+}
+
+/**
+ * \return Encoded samples per second and the size of the last stream
+ */
+double
+measure(size_t blockSize, size_t maxBytes, size_t& size)
+{
+    Slice<uint8_t> streamSlice(streamBuffer);
+    const size_t numberOfBlocks = samplesPerRun / blockSize;
+
+    std::chrono::duration<double> duration(0);
+    for (size_t i = 0; i < numberOfBlocks; i++)
+    {
+        // The encoder modifies its input
+        memcpy(input, coefficients, blockSize * sizeof(int16_t));
+        Bitstream bitstream(streamSlice);
+
+        auto start = std::chrono::steady_clock::now();
+        encoder.encode(Slice<int16_t>(input).first(blockSize), bitstream, 2, maxBytes);
+        duration += std::chrono::steady_clock::now() - start;
+
+        size = bitstream.getSize();
+    }
+    return (numberOfBlocks * blockSize) / duration.count();
+}
+}  // namespace
+
+int
+main(void)
+{
+    const size_t blockSizes[] = {16, 128, 256, 512, 1024, 2048, 4096};
+
+    printf("block size | unlimited: Msamples/s  bytes | limited: Msamples/s  bytes\n");
+    for (size_t blockSize : blockSizes)
+    {
+        calculateCoefficients(blockSize);
+
+        size_t unlimitedSize = 0;
+        size_t limitedSize = 0;
+        const double unlimited = measure(blockSize, 0, unlimitedSize);
+        const double limited = measure(blockSize, blockSize / 4, limitedSize);
+        printf("%10u | %20.2f %6u | %18.2f %6u\n",
+               static_cast<unsigned int>(blockSize),
+               unlimited / 1e6,
+               static_cast<unsigned int>(unlimitedSize),
+               limited / 1e6,
+               static_cast<unsigned int>(limitedSize));
+    }
+
+    return 0;
+}
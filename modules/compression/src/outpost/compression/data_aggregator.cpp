@@ -125,7 +125,9 @@ DataAggregator::push(Fixpoint fp, const outpost::time::GpsTime& currentTime)
         if (!mBlock.isValid())
         {
             outpost::utils::SharedBufferPointer p;
-            if (mMemoryPool->allocate(p))
+            const size_t size =
+                    DataBlock::headerSize + toUInt(mNextBlocksize) * sizeof(Fixpoint);
+            if (mMemoryPool->allocate(p, size))
             {
                 mSamplingRate = mNextSamplingRate;
                 mBlocksize = mNextBlocksize;
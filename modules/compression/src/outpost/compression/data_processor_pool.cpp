@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "data_processor_pool.h"
+
+#include "data_processor_thread.h"
+
+#include <outpost/rtos/mutex_guard.h>
+#include <outpost/support/heartbeat.h>
+#include <outpost/utils/container/reference_queue.h>
+#include <outpost/utils/container/shared_object_pool.h>
+
+namespace outpost
+{
+namespace compression
+{
+namespace
+{
+/**
+ * Compares sequence numbers, tolerates the overflow of the counter.
+ */
+inline bool
+isBefore(uint32_t first, uint32_t second)
+{
+    return static_cast<int32_t>(first - second) < 0;
+}
+}  // namespace
+
+DataProcessorPool::DataProcessorPool(const outpost::time::Clock& clock,
+                                     outpost::utils::SharedBufferPoolBase& pool,
+                                     outpost::utils::ReferenceQueueBase<DataBlock>& inputQueue,
+                                     outpost::utils::ReferenceQueueBase<DataBlock>& outputQueue) :
+    mClock(clock),
+    mPool(pool),
+    mInputQueue(inputQueue),
+    mOutputQueue(outputQueue),
+    mWorkers(nullptr),
+    mNextSequenceNumber(0),
+    mNumIncomingBlocks(0),
+    mNumProcessedBlocks(0),
+    mNumForwardedBlocks(0),
+    mNumLostBlocks(0)
+{
+}
+
+void
+DataProcessorPool::enable()
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    for (DataProcessorWorker* worker = mWorkers; worker != nullptr; worker = worker->mNext)
+    {
+        worker->enable();
+    }
+}
+
+void
+DataProcessorPool::disable()
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    for (DataProcessorWorker* worker = mWorkers; worker != nullptr; worker = worker->mNext)
+    {
+        worker->disable();
+    }
+}
+
+size_t
+DataProcessorPool::getNumberOfWorkers() const
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    size_t count = 0;
+    for (DataProcessorWorker* worker = mWorkers; worker != nullptr; worker = worker->mNext)
+    {
+        count++;
+    }
+    return count;
+}
+
+void
+DataProcessorPool::resetCounters()
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    mNumIncomingBlocks = 0;
+    mNumProcessedBlocks = 0;
+    mNumForwardedBlocks = 0;
+    mNumLostBlocks = 0;
+}
+
+void
+DataProcessorPool::add(DataProcessorWorker& worker)
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    worker.mNext = mWorkers;
+    mWorkers = &worker;
+}
+
+void
+DataProcessorPool::remove(DataProcessorWorker& worker)
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    if (worker.mState != DataProcessorWorker::State::idle)
+    {
+        // The block of the worker is gone with it
+        worker.mState = DataProcessorWorker::State::idle;
+        worker.mBlock = DataBlock();
+        mNumLostBlocks++;
+    }
+
+    DataProcessorWorker** link = &mWorkers;
+    while (*link != nullptr)
+    {
+        if (*link == &worker)
+        {
+            *link = worker.mNext;
+            break;
+        }
+        link = &(*link)->mNext;
+    }
+
+    // Blocks of the same parameter do not have to wait for a removed worker
+    forwardBlocks();
+}
+
+bool
+DataProcessorPool::receive(DataProcessorWorker& worker, outpost::time::Duration timeout)
+{
+    if (!mReceiveMutex.acquire(timeout))
+    {
+        return false;
+    }
+
+    DataBlock block;
+    bool received = mInputQueue.receive(block, timeout);
+    if (received)
+    {
+        outpost::rtos::MutexGuard lock(mMutex);
+        worker.mBlock = block;
+        worker.mParameterId = block.getParameterId();
+        worker.mSequenceNumber = mNextSequenceNumber++;
+        worker.mState = DataProcessorWorker::State::processing;
+        mNumIncomingBlocks++;
+    }
+    mReceiveMutex.release();
+    return received;
+}
+
+void
+DataProcessorPool::finish(DataProcessorWorker& worker, bool success)
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    if (success)
+    {
+        worker.mState = DataProcessorWorker::State::encoded;
+        worker.mEncodedTime = mClock.now();
+        mNumProcessedBlocks++;
+    }
+    else
+    {
+        worker.mState = DataProcessorWorker::State::idle;
+        worker.mBlock = DataBlock();
+        mNumLostBlocks++;
+    }
+    forwardBlocks();
+}
+
+bool
+DataProcessorPool::isPending(const DataProcessorWorker& worker)
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    forwardBlocks();
+    return worker.mState == DataProcessorWorker::State::encoded;
+}
+
+void
+DataProcessorPool::forwardBlocks()
+{
+    while (1)
+    {
+        // Forward the oldest block that does not wait for another block of
+        // its parameter
+        DataProcessorWorker* next = nullptr;
+        for (DataProcessorWorker* worker = mWorkers; worker != nullptr; worker = worker->mNext)
+        {
+            if ((worker->mState == DataProcessorWorker::State::encoded)
+                && ((next == nullptr) || isBefore(worker->mSequenceNumber, next->mSequenceNumber))
+                && isNextOfParameter(*worker))
+            {
+                next = worker;
+            }
+        }
+
+        if ((next == nullptr) || !mOutputQueue.send(next->mBlock))
+        {
+            // Nothing to forward or the output queue is full. Try again
+            // when the next block is finished or a worker polls again.
+            return;
+        }
+
+        next->mStallTime += mClock.now() - next->mEncodedTime;
+        next->mBlock = DataBlock();
+        next->mState = DataProcessorWorker::State::idle;
+        next->mForwarded.release();
+        mNumForwardedBlocks++;
+    }
+}
+
+bool
+DataProcessorPool::isNextOfParameter(const DataProcessorWorker& worker) const
+{
+    for (DataProcessorWorker* other = mWorkers; other != nullptr; other = other->mNext)
+    {
+        if ((other->mState != DataProcessorWorker::State::idle)
+            && (other->mParameterId == worker.mParameterId)
+            && isBefore(other->mSequenceNumber, worker.mSequenceNumber))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ----------------------------------------------------------------------------
+constexpr size_t DataProcessorWorker::minimumStackSize;
+constexpr outpost::time::Duration DataProcessorWorker::waitForBlockTimeout;
+constexpr outpost::time::Duration DataProcessorWorker::processingTimeout;
+
+DataProcessorWorker::DataProcessorWorker(
+        DataProcessorPool& pool,
+        uint8_t thread_priority,
+        outpost::support::parameter::HeartbeatSource heartbeatSource,
+        outpost::time::Duration outputTimeout,
+        size_t stackSize) :
+    outpost::rtos::Thread(thread_priority, stackSize, "DPW"),
+    mPool(pool),
+    mHeartbeatSource(heartbeatSource),
+    mCheckpoint(outpost::rtos::Checkpoint::State::suspending),
+    mForwarded(outpost::rtos::BinarySemaphore::State::acquired),
+    mOutputTimeout(outputTimeout),
+    mNext(nullptr),
+    mState(State::idle),
+    mBlock(),
+    mParameterId(0),
+    mSequenceNumber(0),
+    mEncodedTime(),
+    mNumProcessedBlocks(0),
+    mProcessingTime(outpost::time::Duration::zero()),
+    mMaximumProcessingTime(outpost::time::Duration::zero()),
+    mStallTime(outpost::time::Duration::zero())
+{
+    mPool.add(*this);
+}
+
+DataProcessorWorker::~DataProcessorWorker()
+{
+    mPool.remove(*this);
+}
+
+void
+DataProcessorWorker::run()
+{
+    while (1)
+    {
+        outpost::support::Heartbeat::suspend(mHeartbeatSource);
+        mCheckpoint.pass();
+        processSingleBlock();
+    }
+}
+
+void
+DataProcessorWorker::enable()
+{
+    mCheckpoint.resume();
+}
+
+void
+DataProcessorWorker::disable()
+{
+    mCheckpoint.suspend();
+}
+
+bool
+DataProcessorWorker::isEnabled() const
+{
+    return mCheckpoint.getState() == outpost::rtos::Checkpoint::State::running;
+}
+
+void
+DataProcessorWorker::processSingleBlock(outpost::time::Duration timeout)
+{
+    outpost::support::Heartbeat::send(
+            mHeartbeatSource, timeout * 2U + processingTimeout * 2U + mOutputTimeout);
+
+    if (mPool.isPending(*this))
+    {
+        // Backpressure: keep the encoded block and leave new blocks in the
+        // input queue until the output queue accepts it
+        mForwarded.acquire(mOutputTimeout);
+        if (mPool.isPending(*this))
+        {
+            return;
+        }
+    }
+
+    if (mPool.receive(*this, timeout))
+    {
+        const outpost::time::SpacecraftElapsedTime start = mPool.mClock.now();
+        const bool success = DataProcessorThread::compress(mBlock, mPool.mPool, mEncoder);
+        const outpost::time::Duration duration = mPool.mClock.now() - start;
+
+        if (success)
+        {
+            mNumProcessedBlocks++;
+            mProcessingTime += duration;
+            if (duration > mMaximumProcessingTime)
+            {
+                mMaximumProcessingTime = duration;
+            }
+        }
+        mPool.finish(*this, success);
+    }
+}
+
+void
+DataProcessorWorker::resetStatistics()
+{
+    mNumProcessedBlocks = 0;
+    mProcessingTime = outpost::time::Duration::zero();
+    mMaximumProcessingTime = outpost::time::Duration::zero();
+    mStallTime = outpost::time::Duration::zero();
+}
+
+}  // namespace compression
+}  // namespace outpost
@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_COMPRESSION_DATA_PROCESSOR_POOL_H_
+#define OUTPOST_COMPRESSION_DATA_PROCESSOR_POOL_H_
+
+#include "data_block.h"
+#include "nls_encoder.h"
+
+#include <outpost/parameter/support.h>
+#include <outpost/rtos/checkpoint.h>
+#include <outpost/rtos/mutex.h>
+#include <outpost/rtos/semaphore.h>
+#include <outpost/rtos/thread.h>
+#include <outpost/time/clock.h>
+#include <outpost/time/duration.h>
+
+namespace outpost
+{
+namespace utils
+{
+template <typename T>
+class ReferenceQueueBase;
+
+class SharedBufferPoolBase;
+}  // namespace utils
+
+namespace compression
+{
+class DataProcessorWorker;
+
+/**
+ * Distributes the transformation and encoding of DataBlocks over several
+ * DataProcessorWorker threads.
+ *
+ * All workers receive from the same input queue. The encoded blocks are
+ * forwarded to the output queue in the order in which they have been
+ * received, as far as blocks of the same parameter are concerned. Blocks
+ * of different parameters may overtake each other.
+ *
+ * When the output queue is full, a worker keeps its encoded block and does
+ * not receive new blocks until the block has been forwarded. Raw blocks
+ * then stay in the input queue, which makes the DataAggregators drop
+ * samples instead of the pool dropping blocks that have already been
+ * encoded.
+ *
+ * \code
+ * DataProcessorPool pool(clock, bufferPool, inputQueue, outputQueue);
+ * DataProcessorWorker worker0(pool, priority, HeartbeatSource::dataProcessor0);
+ * DataProcessorWorker worker1(pool, priority, HeartbeatSource::dataProcessor1);
+ *
+ * worker0.start();
+ * worker1.start();
+ * pool.enable();
+ * \endcode
+ */
+class DataProcessorPool
+{
+public:
+    /** Constructor
+     * @param clock Clock for the timing statistics of the workers
+     * @param pool SharedBufferPool for allocation of new DataBlocks
+     * @param inputQueue Queue to listen to for incoming raw DataBlocks
+     * @param outputQueue Queue to send encoded DataBlocks to for long-term storage or transmission
+     * to ground
+     */
+    DataProcessorPool(const outpost::time::Clock& clock,
+                      outpost::utils::SharedBufferPoolBase& pool,
+                      outpost::utils::ReferenceQueueBase<DataBlock>& inputQueue,
+                      outpost::utils::ReferenceQueueBase<DataBlock>& outputQueue);
+
+    ~DataProcessorPool() = default;
+
+    // disable copy constructor
+    DataProcessorPool(const DataProcessorPool&) = delete;
+
+    // disable copy-assignment operator
+    DataProcessorPool&
+    operator=(const DataProcessorPool&) = delete;
+
+    /**
+     * Enables the processing of DataBlocks in all workers
+     */
+    void
+    enable();
+
+    /**
+     * Disables the processing of DataBlocks in all workers
+     */
+    void
+    disable();
+
+    /**
+     * Getter for the number of registered workers.
+     */
+    size_t
+    getNumberOfWorkers() const;
+
+    /**
+     * Getter for the number of DataBlocks that have been received from the input queue.
+     * @return Returns the number of incoming blocks.
+     */
+    inline uint32_t
+    getNumberOfReceivedBlocks() const
+    {
+        return mNumIncomingBlocks;
+    }
+
+    /**
+     * Getter for the number of DataBlocks that have been processed.
+     * @return Returns the number of processed blocks.
+     */
+    inline uint32_t
+    getNumberOfProcessedBlocks() const
+    {
+        return mNumProcessedBlocks;
+    }
+
+    /**
+     * Getter for the number of DataBlocks that haven been forwarded to the output queue.
+     * @return Returns the number of forwarded blocks.
+     */
+    inline uint32_t
+    getNumberOfForwardedBlocks() const
+    {
+        return mNumForwardedBlocks;
+    }
+
+    /**
+     * Getter for the number of DataBlocks that have been lost because they could not be
+     * encoded or their worker has been destroyed before forwarding them.
+     * @return Returns the number of lost blocks.
+     */
+    inline uint32_t
+    getNumberOfLostBlocks() const
+    {
+        return mNumLostBlocks;
+    }
+
+    /**
+     * Resets the counters for incoming, processed, forwarded and lost blocks.
+     */
+    void
+    resetCounters();
+
+private:
+    friend class DataProcessorWorker;
+
+    void
+    add(DataProcessorWorker& worker);
+
+    void
+    remove(DataProcessorWorker& worker);
+
+    /**
+     * Receive the next block for a worker and assign it a sequence number.
+     */
+    bool
+    receive(DataProcessorWorker& worker, outpost::time::Duration timeout);
+
+    /**
+     * Hand back a block after processing and forward all blocks which are
+     * next in order.
+     *
+     * @param success
+     *      False if the block could not be encoded. It is dropped.
+     */
+    void
+    finish(DataProcessorWorker& worker, bool success);
+
+    /**
+     * @return True if the worker still holds a block that has not been forwarded.
+     */
+    bool
+    isPending(const DataProcessorWorker& worker);
+
+    void
+    forwardBlocks();
+
+    bool
+    isNextOfParameter(const DataProcessorWorker& worker) const;
+
+    const outpost::time::Clock& mClock;
+
+    outpost::utils::SharedBufferPoolBase& mPool;
+
+    outpost::utils::ReferenceQueueBase<DataBlock>& mInputQueue;
+    outpost::utils::ReferenceQueueBase<DataBlock>& mOutputQueue;
+
+    // Held while receiving from the input queue, so that the sequence
+    // numbers follow the order of the queue
+    outpost::rtos::Mutex mReceiveMutex;
+
+    // Protects the state of the workers and the list of workers
+    mutable outpost::rtos::Mutex mMutex;
+
+    DataProcessorWorker* mWorkers;
+    uint32_t mNextSequenceNumber;
+
+    uint32_t mNumIncomingBlocks;
+    uint32_t mNumProcessedBlocks;
+    uint32_t mNumForwardedBlocks;
+    uint32_t mNumLostBlocks;
+};
+
+/**
+ * Worker thread of a DataProcessorPool.
+ *
+ * Each worker has its own NLSEncoder and heartbeat source. It registers
+ * itself with the pool on construction and removes itself on destruction,
+ * the pool must outlive its workers.
+ */
+class DataProcessorWorker : public outpost::rtos::Thread
+{
+public:
+    /**
+     * Stack needed by run(). DataProcessorThread::compress() alone needs
+     * about 600 bytes, mostly for the wavelet transform.
+     */
+    static constexpr size_t minimumStackSize = 1024;
+
+    /** Constructor
+     * @param pool Pool to take the DataBlocks from
+     * @param thread_priority Priority in the OS' scheduler
+     * @param heartbeatSource Heartbeat source of this worker, each worker needs its own
+     * @param outputTimeout Interval in which a full output queue is checked again
+     * @param stackSize Stack size of the thread, should not be below minimumStackSize
+     */
+    DataProcessorWorker(DataProcessorPool& pool,
+                        uint8_t thread_priority,
+                        outpost::support::parameter::HeartbeatSource heartbeatSource,
+                        outpost::time::Duration outputTimeout = outpost::time::Milliseconds(500),
+                        size_t stackSize = minimumStackSize);
+
+    virtual ~DataProcessorWorker();
+
+    // disable copy constructor
+    DataProcessorWorker(const DataProcessorWorker&) = delete;
+
+    // disable copy-assignment operator
+    DataProcessorWorker&
+    operator=(const DataProcessorWorker&) = delete;
+
+    /**
+     * The method is called by the OS' scheduler. It awaits DataBlocks on the incoming queue of
+     * the pool, transforms and encodes them and forwards them to the output queue of the pool.
+     */
+    void
+    run() override;
+
+    /**
+     * Enables the processing of DataBlocks
+     */
+    void
+    enable();
+
+    /**
+     * Disables the processing of DataBlocks
+     */
+    void
+    disable();
+
+    /**
+     * Getter for the thread's state.
+     * @return Returns true if processing is currently enabled, false otherwise.
+     */
+    bool
+    isEnabled() const;
+
+    /**
+     * Goes through the entire processing sequence for a single block, from reception from the
+     * input queue through compression to forwarding to the output queue.
+     *
+     * If the block of the previous call has not been forwarded yet, waits up to the output
+     * timeout for it to be forwarded instead and does not receive a new block.
+     *
+     * @param timeout Timeout for reception of a DataBlock on the input queue.
+     */
+    void
+    processSingleBlock(outpost::time::Duration timeout = waitForBlockTimeout);
+
+    /**
+     * Getter for the number of DataBlocks this worker has encoded.
+     */
+    inline uint32_t
+    getNumberOfProcessedBlocks() const
+    {
+        return mNumProcessedBlocks;
+    }
+
+    /**
+     * Getter for the time spent transforming and encoding blocks.
+     */
+    inline outpost::time::Duration
+    getProcessingTime() const
+    {
+        return mProcessingTime;
+    }
+
+    /**
+     * Getter for the longest time spent on a single block.
+     */
+    inline outpost::time::Duration
+    getMaximumProcessingTime() const
+    {
+        return mMaximumProcessingTime;
+    }
+
+    /**
+     * Getter for the time encoded blocks waited to be forwarded, either
+     * for an earlier block of the same parameter or for the output queue.
+     */
+    inline outpost::time::Duration
+    getStallTime() const
+    {
+        return mStallTime;
+    }
+
+    /**
+     * Resets the timing statistics of this worker.
+     */
+    void
+    resetStatistics();
+
+private:
+    friend class DataProcessorPool;
+
+    enum class State
+    {
+        idle,
+        processing,
+        encoded
+    };
+
+    static constexpr outpost::time::Duration waitForBlockTimeout = outpost::time::Seconds(5);
+    static constexpr outpost::time::Duration processingTimeout = outpost::time::Seconds(1);
+
+    DataProcessorPool& mPool;
+
+    outpost::support::parameter::HeartbeatSource mHeartbeatSource;
+
+    outpost::rtos::Checkpoint mCheckpoint;
+
+    // Released by the pool when the block of this worker has been forwarded
+    outpost::rtos::BinarySemaphore mForwarded;
+
+    outpost::time::Duration mOutputTimeout;
+
+    NLSEncoder mEncoder;
+
+    // State of the block, protected by the mutex of the pool. The block
+    // itself is only accessed by the worker while it is processing it.
+    DataProcessorWorker* mNext;
+    State mState;
+    DataBlock mBlock;
+    uint16_t mParameterId;
+    uint32_t mSequenceNumber;
+    outpost::time::SpacecraftElapsedTime mEncodedTime;
+
+    uint32_t mNumProcessedBlocks;
+    outpost::time::Duration mProcessingTime;
+    outpost::time::Duration mMaximumProcessingTime;
+    outpost::time::Duration mStallTime;
+};
+
+}  // namespace compression
+}  // namespace outpost
+
+#endif /* OUTPOST_COMPRESSION_DATA_PROCESSOR_POOL_H_ */
@@ -36,6 +36,8 @@ DataProcessorThread::DataProcessorThread(
         outpost::utils::ReferenceQueueBase<DataBlock>& outputQueue,
         uint8_t numOutputRetries,
         outpost::time::Duration retryTimeout) :
+    // compress() needs about 600 bytes of stack on top of run(), most of it
+    // for the chunk buffers of LeGall53Wavelet::forwardTransformInPlace().
     outpost::rtos::Thread(thread_priority, 1024, "DPT"),
     mHeartbeatSource(heartbeatSource),
     mInputQueue(inputQueue),
@@ -94,7 +96,7 @@ DataProcessorThread::processSingleBlock(outpost::time::Duration timeout)
     if (mInputQueue.receive(b, timeout))
     {
         mNumIncomingBlocks++;
-        if (compress(b))
+        if (compress(b, mPool, mEncoder))
         {
             mNumProcessedBlocks++;
             bool success = false;
@@ -126,16 +128,20 @@ DataProcessorThread::processSingleBlock(outpost::time::Duration timeout)
 }
 
 bool
-DataProcessorThread::compress(DataBlock& b)
+DataProcessorThread::compress(DataBlock& b,
+                              outpost::utils::SharedBufferPoolBase& pool,
+                              NLSEncoder& encoder)
 {
     if (b.applyWaveletTransform() && b.getCoefficients().getNumberOfElements() > 0U)
     {
         outpost::utils::SharedBufferPointer p;
-        if (mPool.allocate(p))
+        const size_t size = DataBlock::headerSize
+                            + b.getCoefficients().getNumberOfElements() * sizeof(int16_t);
+        if (pool.allocate(p, size))
         {
             DataBlock outputBlock(
                     p, b.getParameterId(), b.getStartTime(), b.getSamplingRate(), b.getBlocksize());
-            if (b.encode(outputBlock, mEncoder))
+            if (b.encode(outputBlock, encoder))
             {
                 b = outputBlock;
                 return true;
@@ -147,12 +147,19 @@ public:
     void
     processSingleBlock(outpost::time::Duration timeout = waitForBlockTimeout);
 
+    /**
+     * Transforms and encodes a raw DataBlock into a newly allocated DataBlock.
+     * @param b Raw DataBlock, replaced by the encoded one on success
+     * @param pool SharedBufferPool for the allocation of the encoded DataBlock
+     * @param encoder Encoder to use, holds the intermediate results
+     * @return Returns true if the block has been encoded, false otherwise.
+     */
+    static bool
+    compress(DataBlock& b, outpost::utils::SharedBufferPoolBase& pool, NLSEncoder& encoder);
+
     static constexpr uint16_t maximumEncodingBufferLength = 16500;
 
 private:
-    bool
-    compress(DataBlock& b);
-
     outpost::support::parameter::HeartbeatSource mHeartbeatSource;
 
     outpost::utils::ReferenceQueueBase<DataBlock>& mInputQueue;
@@ -19,118 +19,654 @@
 
 #include <string.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace outpost
 {
 namespace compression
 {
-void
-LeGall53Wavelet::forwardTransform(outpost::Slice<Fixpoint> inBuffer,
-                                  outpost::Slice<Fixpoint> outBuffer)
+namespace
+{
+static_assert(sizeof(Fixpoint) == sizeof(int32_t), "Fixpoint must be a plain 32-bit value");
+
+// All filter coefficients of the forward transform are multiples of
+// powers of two. The product of a Fixpoint with a coefficient, truncated
+// to 32 bit as done by FP<16>, is therefore equal to shifts and additions
+// of the raw values:
+//
+//   -0.125 * x = floor(-x / 8)
+//    0.25  * x = x >> 2
+//    0.75  * x = x + floor(-x / 4)
+//   -0.5   * x = floor(-x / 2)
+//    4.0   * x = x << 2
+//   -3.5   * x = (x >> 1) - (x << 2)
+//    0.5   * x = x >> 1
+//
+// All results are exact modulo 2^32, the transform stays bit-exact to the
+// multiplication with 64 bit intermediate products.
+
+/**
+ * One coefficient per step, used for the remainder of each level.
+ */
+struct ScalarLanes
 {
-    size_t halfBufferLength = inBuffer.getNumberOfElements();
+    typedef int32_t Vector;
+    static constexpr size_t width = 1;
+
+    static inline Vector
+    load(const int32_t* values)
+    {
+        return *values;
+    }
+
+    static inline void
+    store(int32_t* values, Vector v)
+    {
+        *values = v;
+    }
+
+    /// Split `width` consecutive sample pairs into even and odd samples
+    static inline void
+    split(const int32_t* samples, int32_t* even, int32_t* odd)
+    {
+        *even = samples[0];
+        *odd = samples[1];
+    }
+
+    /// Inverse of split()
+    static inline void
+    merge(const int32_t* even, const int32_t* odd, int32_t* samples)
+    {
+        samples[0] = *even;
+        samples[1] = *odd;
+    }
+
+    // Wrap around on overflow like the additions of FP<16>
+    static inline Vector
+    add(Vector a, Vector b)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b));
+    }
+
+    static inline Vector
+    subtract(Vector a, Vector b)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(a) - static_cast<uint32_t>(b));
+    }
+
+    template <int n>
+    static inline Vector
+    shiftRight(Vector a)
+    {
+        return a >> n;
+    }
 
-    size_t step;
-    // Perform log2 passes, bisecting the buffer after each pass
-    for (step = 0; halfBufferLength > 2; step++)
+    template <int n>
+    static inline Vector
+    shiftLeft(Vector a)
     {
-        // Calculate high- and lowpass coefficients for the general case
-        halfBufferLength = halfBufferLength >> 1;
-        for (size_t i = 0; i < halfBufferLength - 2; i++)
+        return static_cast<int32_t>(static_cast<uint32_t>(a) << n);
+    }
+
+    /// floor(-a / 2^n), i.e. -ceil(a / 2^n) without overflow for INT32_MIN
+    template <int n>
+    static inline Vector
+    negativeDivide(Vector a)
+    {
+        const uint32_t exact = ((a & ((1 << n) - 1)) == 0) ? 1U : 0U;
+        return static_cast<int32_t>(~static_cast<uint32_t>(a >> n) + exact);
+    }
+
+    /// Load `width` coefficients and widen them to 32 bit
+    static inline Vector
+    load(const int16_t* values)
+    {
+        return *values;
+    }
+
+    static inline Vector
+    shiftLeft(Vector a, int n)
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(a) << n);
+    }
+
+    /// Round to nearest with halves rounded up, i.e. floor(a / 2^n + 0.5)
+    static inline Vector
+    roundingShiftRight(Vector a, int n)
+    {
+        return add(a, 1 << (n - 1)) >> n;
+    }
+
+    /// Store `width` sample pairs
+    static inline void
+    storeInterleaved(int32_t* samples, Vector even, Vector odd)
+    {
+        samples[0] = even;
+        samples[1] = odd;
+    }
+
+    /// Store `width` sample pairs, saturated to the range of int16_t
+    static inline void
+    storeInterleaved(int16_t* samples, Vector even, Vector odd)
+    {
+        samples[0] = saturate(even);
+        samples[1] = saturate(odd);
+    }
+
+private:
+    static inline int16_t
+    saturate(Vector a)
+    {
+        if (a > INT16_MAX)
         {
-            // Lowpass
-            outBuffer[i] = h0 * inBuffer[2 * i] + h1 * inBuffer[2 * i + 1]
-                           + h2 * inBuffer[2 * i + 2] + h3 * inBuffer[2 * i + 3]
-                           + h4 * inBuffer[2 * i + 4];
-            // Highpass
-            outBuffer[i + halfBufferLength] =
-                    g0 * inBuffer[2 * i] + g1 * inBuffer[2 * i + 1] + g2 * inBuffer[2 * i + 2];
+            return INT16_MAX;
         }
+        else if (a < INT16_MIN)
+        {
+            return INT16_MIN;
+        }
+        return static_cast<int16_t>(a);
+    }
+};
 
-        // Handle lapping cases
-        outBuffer[halfBufferLength - 2] =
-                h0 * inBuffer[2 * halfBufferLength - 4] + h1 * inBuffer[2 * halfBufferLength - 3]
-                + h2 * inBuffer[2 * halfBufferLength - 2] + h3 * inBuffer[2 * halfBufferLength - 1]
-                + h4 * inBuffer[0];
-        outBuffer[2 * halfBufferLength - 2] = g0 * inBuffer[2 * halfBufferLength - 4]
-                                              + g1 * inBuffer[2 * halfBufferLength - 3]
-                                              + g2 * inBuffer[2 * halfBufferLength - 2];
+#if defined(__SSE2__)
+/**
+ * Four coefficients per step with SSE2, available on every x86-64 target.
+ */
+struct VectorLanes
+{
+    typedef __m128i Vector;
+    static constexpr size_t width = 4;
 
-        outBuffer[halfBufferLength - 1] = h0 * inBuffer[2 * halfBufferLength - 2]
-                                          + h1 * inBuffer[2 * halfBufferLength - 1]
-                                          + h2 * inBuffer[0] + h3 * inBuffer[1] + h4 * inBuffer[2];
-        outBuffer[2 * halfBufferLength - 1] = g0 * inBuffer[2 * halfBufferLength - 2]
-                                              + g1 * inBuffer[2 * halfBufferLength - 1]
-                                              + g2 * inBuffer[0];
+    static inline Vector
+    load(const int32_t* values)
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(values));
+    }
 
-        // Swap buffers for the subsequent pass
-        outpost::Slice<Fixpoint> tmp = inBuffer;
-        inBuffer = outBuffer;
-        outBuffer = tmp;
+    static inline void
+    store(int32_t* values, Vector v)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(values), v);
+    }
+
+    static inline void
+    split(const int32_t* samples, int32_t* even, int32_t* odd)
+    {
+        const __m128 first = _mm_castsi128_ps(load(samples));
+        const __m128 second = _mm_castsi128_ps(load(samples + 4));
+        store(even, _mm_castps_si128(_mm_shuffle_ps(first, second, _MM_SHUFFLE(2, 0, 2, 0))));
+        store(odd, _mm_castps_si128(_mm_shuffle_ps(first, second, _MM_SHUFFLE(3, 1, 3, 1))));
+    }
+
+    static inline void
+    merge(const int32_t* even, const int32_t* odd, int32_t* samples)
+    {
+        const Vector e = load(even);
+        const Vector o = load(odd);
+        store(samples, _mm_unpacklo_epi32(e, o));
+        store(samples + 4, _mm_unpackhi_epi32(e, o));
+    }
+
+    static inline Vector
+    add(Vector a, Vector b)
+    {
+        return _mm_add_epi32(a, b);
+    }
+
+    static inline Vector
+    subtract(Vector a, Vector b)
+    {
+        return _mm_sub_epi32(a, b);
+    }
+
+    template <int n>
+    static inline Vector
+    shiftRight(Vector a)
+    {
+        return _mm_srai_epi32(a, n);
+    }
+
+    template <int n>
+    static inline Vector
+    shiftLeft(Vector a)
+    {
+        return _mm_slli_epi32(a, n);
+    }
+
+    template <int n>
+    static inline Vector
+    negativeDivide(Vector a)
+    {
+        const Vector inverted = _mm_xor_si128(_mm_srai_epi32(a, n), _mm_set1_epi32(-1));
+        // All bits set where the division is exact
+        const Vector exact = _mm_cmpeq_epi32(_mm_and_si128(a, _mm_set1_epi32((1 << n) - 1)),
+                                             _mm_setzero_si128());
+        return _mm_sub_epi32(inverted, exact);
+    }
+
+    static inline Vector
+    load(const int16_t* values)
+    {
+        const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(values));
+        return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+    }
+
+    static inline Vector
+    shiftLeft(Vector a, int n)
+    {
+        return _mm_sll_epi32(a, _mm_cvtsi32_si128(n));
     }
 
-    // With coefficients of different levels spread through both buffers, these need to be copied to
-    // outBuffer
-    size_t steps = step;
-    if (step % 2)
+    static inline Vector
+    roundingShiftRight(Vector a, int n)
     {
-        outpost::Slice<Fixpoint> tmp = inBuffer;
-        inBuffer = outBuffer;
-        outBuffer = tmp;
-        step = 2;
+        return _mm_sra_epi32(_mm_add_epi32(a, _mm_set1_epi32(1 << (n - 1))),
+                             _mm_cvtsi32_si128(n));
     }
-    else
+
+    static inline void
+    storeInterleaved(int32_t* samples, Vector even, Vector odd)
+    {
+        store(samples, _mm_unpacklo_epi32(even, odd));
+        store(samples + 4, _mm_unpackhi_epi32(even, odd));
+    }
+
+    static inline void
+    storeInterleaved(int16_t* samples, Vector even, Vector odd)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(samples),
+                         _mm_packs_epi32(_mm_unpacklo_epi32(even, odd),
+                                         _mm_unpackhi_epi32(even, odd)));
+    }
+};
+#elif defined(__ARM_NEON)
+/**
+ * Four coefficients per step with NEON.
+ */
+struct VectorLanes
+{
+    typedef int32x4_t Vector;
+    static constexpr size_t width = 4;
+
+    static inline Vector
+    load(const int32_t* values)
+    {
+        return vld1q_s32(values);
+    }
+
+    static inline void
+    store(int32_t* values, Vector v)
+    {
+        vst1q_s32(values, v);
+    }
+
+    static inline void
+    split(const int32_t* samples, int32_t* even, int32_t* odd)
+    {
+        const int32x4x2_t pairs = vld2q_s32(samples);
+        vst1q_s32(even, pairs.val[0]);
+        vst1q_s32(odd, pairs.val[1]);
+    }
+
+    static inline void
+    merge(const int32_t* even, const int32_t* odd, int32_t* samples)
+    {
+        int32x4x2_t pairs;
+        pairs.val[0] = vld1q_s32(even);
+        pairs.val[1] = vld1q_s32(odd);
+        vst2q_s32(samples, pairs);
+    }
+
+    static inline Vector
+    add(Vector a, Vector b)
     {
-        step = 1;
-        memcpy(&outBuffer[0], &inBuffer[0], 16);
+        return vaddq_s32(a, b);
     }
 
-    for (; step < steps; step += 2)
+    static inline Vector
+    subtract(Vector a, Vector b)
     {
-        memcpy(&outBuffer[1 << step], &inBuffer[1 << step], (1 << (step + 2)));
+        return vsubq_s32(a, b);
     }
+
+    template <int n>
+    static inline Vector
+    shiftRight(Vector a)
+    {
+        return vshrq_n_s32(a, n);
+    }
+
+    template <int n>
+    static inline Vector
+    shiftLeft(Vector a)
+    {
+        return vshlq_n_s32(a, n);
+    }
+
+    template <int n>
+    static inline Vector
+    negativeDivide(Vector a)
+    {
+        const Vector inverted = vmvnq_s32(vshrq_n_s32(a, n));
+        // All bits set where the division is exact
+        const uint32x4_t exact =
+                vceqq_s32(vandq_s32(a, vdupq_n_s32((1 << n) - 1)), vdupq_n_s32(0));
+        return vsubq_s32(inverted, vreinterpretq_s32_u32(exact));
+    }
+
+    static inline Vector
+    load(const int16_t* values)
+    {
+        return vmovl_s16(vld1_s16(values));
+    }
+
+    static inline Vector
+    shiftLeft(Vector a, int n)
+    {
+        return vshlq_s32(a, vdupq_n_s32(n));
+    }
+
+    static inline Vector
+    roundingShiftRight(Vector a, int n)
+    {
+        // Same wrap around as the other implementations instead of vrshlq_s32
+        return vshlq_s32(vaddq_s32(a, vdupq_n_s32(1 << (n - 1))), vdupq_n_s32(-n));
+    }
+
+    static inline void
+    storeInterleaved(int32_t* samples, Vector even, Vector odd)
+    {
+        int32x4x2_t pairs;
+        pairs.val[0] = even;
+        pairs.val[1] = odd;
+        vst2q_s32(samples, pairs);
+    }
+
+    static inline void
+    storeInterleaved(int16_t* samples, Vector even, Vector odd)
+    {
+        int16x4x2_t pairs;
+        pairs.val[0] = vqmovn_s32(even);
+        pairs.val[1] = vqmovn_s32(odd);
+        vst2_s16(samples, pairs);
+    }
+};
+#else
+typedef ScalarLanes VectorLanes;
+#endif
+
+/**
+ * Calculate the lowpass and highpass coefficients of sample pairs.
+ *
+ * Reads even[0, count + 2) and odd[0, count + 1).
+ *
+ * \tparam lifting
+ *      Calculate the highpass coefficients from the lowpass coefficients
+ *      as done by the in place transform.
+ * \return Number of processed pairs, a multiple of Lanes::width
+ */
+template <typename Lanes, bool lifting>
+inline size_t
+filter(const int32_t* even, const int32_t* odd, int32_t* low, int32_t* high, size_t count)
+{
+    typedef typename Lanes::Vector Vector;
+
+    size_t i = 0;
+    for (; (i + Lanes::width) <= count; i += Lanes::width)
+    {
+        const Vector e0 = Lanes::load(even + i);
+        const Vector e1 = Lanes::load(even + i + 1);
+        const Vector e2 = Lanes::load(even + i + 2);
+        const Vector o0 = Lanes::load(odd + i);
+        const Vector o1 = Lanes::load(odd + i + 1);
+
+        // -0.125 * e0 + 0.25 * o0 + 0.75 * e1 + 0.25 * o1 - 0.125 * e2
+        const Vector lowpass = Lanes::add(
+                Lanes::add(Lanes::add(Lanes::template negativeDivide<3>(e0),
+                                      Lanes::template shiftRight<2>(o0)),
+                           Lanes::add(e1, Lanes::template negativeDivide<2>(e1))),
+                Lanes::add(Lanes::template shiftRight<2>(o1),
+                           Lanes::template negativeDivide<3>(e2)));
+        Lanes::store(low + i, lowpass);
+
+        Vector highpass;
+        if (lifting)
+        {
+            // 4.0 * lowpass - 3.5 * e1 - 1.0 * o1 + 0.5 * e2
+            highpass = Lanes::add(
+                    Lanes::subtract(
+                            Lanes::add(Lanes::template shiftLeft<2>(lowpass),
+                                       Lanes::subtract(Lanes::template shiftRight<1>(e1),
+                                                       Lanes::template shiftLeft<2>(e1))),
+                            o1),
+                    Lanes::template shiftRight<1>(e2));
+        }
+        else
+        {
+            // -0.5 * e0 + 1.0 * o0 - 0.5 * e1
+            highpass = Lanes::add(Lanes::add(Lanes::template negativeDivide<1>(e0), o0),
+                                  Lanes::template negativeDivide<1>(e1));
+        }
+        Lanes::store(high + i, highpass);
+    }
+    return i;
+}
+
+template <bool lifting>
+inline void
+filter(const int32_t* even, const int32_t* odd, int32_t* low, int32_t* high, size_t count)
+{
+    const size_t i = filter<VectorLanes, lifting>(even, odd, low, high, count);
+    filter<ScalarLanes, lifting>(even + i, odd + i, low + i, high + i, count - i);
+}
+
+/**
+ * Split every second sample of a level into separate contiguous arrays.
+ */
+inline void
+deinterleave(const int32_t* samples, size_t stride, size_t count, int32_t* even, int32_t* odd)
+{
+    size_t k = 0;
+    if (stride == 1)
+    {
+        for (; (k + VectorLanes::width) <= count; k += VectorLanes::width)
+        {
+            VectorLanes::split(samples + 2 * k, even + k, odd + k);
+        }
+    }
+    for (; k < count; k++)
+    {
+        even[k] = samples[(2 * k) * stride];
+        odd[k] = samples[(2 * k + 1) * stride];
+    }
+}
+
+/**
+ * Inverse of deinterleave().
+ */
+inline void
+interleave(const int32_t* even, const int32_t* odd, size_t count, size_t stride, int32_t* samples)
+{
+    size_t k = 0;
+    if (stride == 1)
+    {
+        for (; (k + VectorLanes::width) <= count; k += VectorLanes::width)
+        {
+            VectorLanes::merge(even + k, odd + k, samples + 2 * k);
+        }
+    }
+    for (; k < count; k++)
+    {
+        samples[(2 * k) * stride] = even[k];
+        samples[(2 * k + 1) * stride] = odd[k];
+    }
+}
+
+inline int32_t*
+getRawValues(outpost::Slice<Fixpoint> buffer)
+{
+    return reinterpret_cast<int32_t*>(buffer.begin());
+}
+
+template <typename Lanes>
+inline void
+writeSamples(int32_t* samples, typename Lanes::Vector even, typename Lanes::Vector odd, int)
+{
+    Lanes::storeInterleaved(samples, even, odd);
+}
+
+template <typename Lanes>
+inline void
+writeSamples(int16_t* samples,
+             typename Lanes::Vector even,
+             typename Lanes::Vector odd,
+             int fractionalBits)
+{
+    Lanes::storeInterleaved(samples,
+                            Lanes::roundingShiftRight(even, fractionalBits),
+                            Lanes::roundingShiftRight(odd, fractionalBits));
+}
+
+/**
+ * Reconstruct sample pairs of a level with the inverse lifting steps
+ *
+ *   even[i] = low[i - 1] - 0.25 * (high[i - 1] + high[i])
+ *   odd[i]  = high[i] + 0.5 * (even[i] + even[i + 1])
+ *
+ * The lowpass coefficients of the level have `level` + 2 fractional bits.
+ * Instead of dividing by four and two the highpass coefficients are
+ * shifted left, the even samples keep the precision of the lowpass
+ * coefficients and the odd samples get one more fractional bit. No bits
+ * are lost, so the result is exact modulo 2^32 and intermediate overflows
+ * cancel out as long as the final samples are in range.
+ *
+ * Reads low[0, count + 1) and high[0, count + 2), writes the pairs
+ * 1 to count relative to `low`.
+ *
+ * \return Number of processed pairs, a multiple of Lanes::width
+ */
+template <typename Lanes, typename Sample>
+inline size_t
+synthesize(const int32_t* low, const int16_t* high, size_t count, int level, Sample* samples)
+{
+    typedef typename Lanes::Vector Vector;
+
+    const int fractionalBits = level + 3;
+    size_t i = 0;
+    for (; (i + Lanes::width) <= count; i += Lanes::width)
+    {
+        const Vector h0 = Lanes::load(high + i);
+        const Vector h1 = Lanes::load(high + i + 1);
+        const Vector h2 = Lanes::load(high + i + 2);
+
+        const Vector e0 = Lanes::subtract(Lanes::load(low + i),
+                                          Lanes::shiftLeft(Lanes::add(h0, h1), level));
+        const Vector e1 = Lanes::subtract(Lanes::load(low + i + 1),
+                                          Lanes::shiftLeft(Lanes::add(h1, h2), level));
+        const Vector odd =
+                Lanes::add(Lanes::shiftLeft(h1, fractionalBits), Lanes::add(e0, e1));
+
+        writeSamples<Lanes>(
+                samples + 2 * i, Lanes::template shiftLeft<1>(e0), odd, fractionalBits);
+    }
+    return i;
+}
+
+/**
+ * Reconstruct the 2 * pairs samples of a level from the lowpass
+ * coefficients and the following highpass coefficients.
+ */
+template <typename Sample>
+inline void
+synthesizeLevel(const int32_t* low, const int16_t* high, size_t pairs, int level, Sample* samples)
+{
+    const size_t count = pairs - 2;
+    const size_t i = synthesize<VectorLanes>(low, high, count, level, samples + 2);
+    synthesize<ScalarLanes>(low + i, high + i, count - i, level, samples + 2 + 2 * i);
+
+    // The first and the last pair wrap around to the other end of the level
+    const int32_t lappedLow[3] = {low[pairs - 2], low[pairs - 1], low[0]};
+    const int16_t lappedHigh[4] = {high[pairs - 2], high[pairs - 1], high[0], high[1]};
+    synthesize<ScalarLanes>(lappedLow, lappedHigh, 1, level, samples + 2 * (pairs - 1));
+    synthesize<ScalarLanes>(lappedLow + 1, lappedHigh + 1, 1, level, samples);
+}
+}  // namespace
+
+void
+LeGall53Wavelet::forwardTransform(outpost::Slice<Fixpoint> inBuffer,
+                                  outpost::Slice<Fixpoint> outBuffer)
+{
+    const size_t length = inBuffer.getNumberOfElements();
+    int32_t* samples = getRawValues(inBuffer);
+    int32_t* scratch = getRawValues(outBuffer);
+
+    // Every level is calculated from the deinterleaved samples in outBuffer
+    // back into inBuffer, the coefficients of all levels stay in inBuffer.
+    for (size_t pairs = length / 2; pairs >= 2; pairs /= 2)
+    {
+        int32_t* even = scratch;
+        int32_t* odd = scratch + pairs;
+        deinterleave(samples, 1, pairs, even, odd);
+
+        filter<false>(even, odd, samples, samples + pairs, pairs - 2);
+
+        // The last two pairs wrap around to the start of the level
+        const int32_t lappedEven[4] = {even[pairs - 2], even[pairs - 1], even[0], even[1]};
+        const int32_t lappedOdd[3] = {odd[pairs - 2], odd[pairs - 1], odd[0]};
+        filter<ScalarLanes, false>(
+                lappedEven, lappedOdd, samples + pairs - 2, samples + 2 * pairs - 2, 2);
+    }
+
+    memcpy(scratch, samples, length * sizeof(int32_t));
 }
 
 void
 LeGall53Wavelet::forwardTransformInPlace(outpost::Slice<Fixpoint> inBuffer)
 {
-    int16_t length = inBuffer.getNumberOfElements();
-    uint16_t inBufferLength = length;
+    // Number of sample pairs that are transformed at once. The chunk buffers
+    // live on the stack of the calling thread, keep them small (~150 bytes).
+    constexpr size_t chunkSize = 8;
 
-    // Perform log2 passes, bisecting the buffer after each pass
-    for (uint16_t step = 0; length >= 3; step++)
+    const size_t length = inBuffer.getNumberOfElements();
+    int32_t* samples = getRawValues(inBuffer);
+
+    // Perform log2 passes, the samples of a level are `stride` elements apart
+    for (size_t stride = 1; (length / stride) >= 4; stride *= 2)
     {
-        // Temporarily save these for handling of lapping cases
-        const Fixpoint tmpBuffer[3] = {inBuffer[0], inBuffer[1 << step], inBuffer[2 << step]};
+        const size_t pairs = length / stride / 2;
+
+        // Overwritten by the first pair but needed for the lapping of the last ones
+        const int32_t lappedEven[2] = {samples[0], samples[2 * stride]};
+        const int32_t lappedOdd = samples[stride];
 
-        // Calculate highpass and lowpass coefficients using the lifting scheme
-        for (size_t i = 0; ((i + 4) << step) < inBufferLength; i += 2)
+        for (size_t first = 0; first < pairs; first += chunkSize)
         {
-            inBuffer[(i << step)] = h0 * inBuffer[i << step] + h1 * inBuffer[(i + 1) << step]
-                                    + h2 * inBuffer[(i + 2) << step]
-                                    + h3 * inBuffer[(i + 3) << step]
-                                    + h4 * inBuffer[(i + 4) << step];
-            inBuffer[(i + 1) << step] =
-                    ip_g0 * inBuffer[i << step] + ip_g2 * inBuffer[(i + 2) << step]
-                    + ip_g3 * inBuffer[(i + 3) << step] + ip_g4 * inBuffer[(i + 4) << step];
+            const size_t remaining = pairs - first;
+            const size_t count = (remaining < chunkSize) ? remaining : chunkSize;
+
+            int32_t even[chunkSize + 2];
+            int32_t odd[chunkSize + 2];
+            int32_t low[chunkSize];
+            int32_t high[chunkSize];
+
+            // Pairs from `first` on have not been transformed yet
+            const size_t available = (remaining < (count + 2)) ? remaining : (count + 2);
+            deinterleave(&samples[2 * first * stride], stride, available, even, odd);
+            for (size_t k = available; k < count + 2; k++)
+            {
+                even[k] = lappedEven[first + k - pairs];
+                odd[k] = lappedOdd;
+            }
+
+            filter<true>(even, odd, low, high, count);
+
+            interleave(low, high, count, stride, &samples[2 * first * stride]);
         }
-        // Handle corner cases with lapping coefficients.
-        inBuffer[inBufferLength - (4 << step)] = h0 * inBuffer[inBufferLength - (4 << step)]
-                                                 + h1 * inBuffer[inBufferLength - (3 << step)]
-                                                 + h2 * inBuffer[inBufferLength - (2 << step)]
-                                                 + h3 * inBuffer[inBufferLength - (1 << step)]
-                                                 + h4 * tmpBuffer[0];
-        inBuffer[inBufferLength - (3 << step)] = ip_g0 * inBuffer[inBufferLength - (4 << step)]
-                                                 + ip_g2 * inBuffer[inBufferLength - (2 << step)]
-                                                 + ip_g3 * inBuffer[inBufferLength - (1 << step)]
-                                                 + ip_g4 * tmpBuffer[0];
-        inBuffer[inBufferLength - (2 << step)] = h0 * inBuffer[inBufferLength - (2 << step)]
-                                                 + h1 * inBuffer[inBufferLength - (1 << step)]
-                                                 + h2 * tmpBuffer[0] + h3 * tmpBuffer[1]
-                                                 + h4 * tmpBuffer[2];
-        inBuffer[inBufferLength - (1 << step)] = ip_g0 * inBuffer[inBufferLength - (2 << step)]
-                                                 + ip_g2 * tmpBuffer[0] + ip_g3 * tmpBuffer[1]
-                                                 + ip_g4 * tmpBuffer[2];
-        length >>= 1;
     }
 }
 
@@ -198,21 +734,42 @@ LeGall53Wavelet::backwardTransform(outpost::Slice<double> inBuffer,
     }
 }
 
-const Fixpoint LeGall53Wavelet::h0 = -0.125;
-const Fixpoint LeGall53Wavelet::h1 = 0.25;
-const Fixpoint LeGall53Wavelet::h2 = 0.75;
-const Fixpoint LeGall53Wavelet::h3 = 0.25;
-const Fixpoint LeGall53Wavelet::h4 = -0.125;
-
-const Fixpoint LeGall53Wavelet::g0 = -0.5;
-const Fixpoint LeGall53Wavelet::g1 = 1.0;
-const Fixpoint LeGall53Wavelet::g2 = -0.5;
-
-const Fixpoint LeGall53Wavelet::ip_g0 = 4.0;
-const Fixpoint LeGall53Wavelet::ip_g1 = 0.0;
-const Fixpoint LeGall53Wavelet::ip_g2 = -3.5;
-const Fixpoint LeGall53Wavelet::ip_g3 = -1.0;
-const Fixpoint LeGall53Wavelet::ip_g4 = 0.5;
+void
+LeGall53Wavelet::backwardTransform(outpost::Slice<const int16_t> inBuffer,
+                                   outpost::Slice<int32_t> tempBuffer,
+                                   outpost::Slice<int16_t> outBuffer)
+{
+    const size_t length = inBuffer.getNumberOfElements();
+    const int16_t* coefficients = inBuffer.getDataPointer();
+    if (length < 4)
+    {
+        // No level has been transformed
+        for (size_t i = 0; i < length; i++)
+        {
+            outBuffer[i] = coefficients[i];
+        }
+        return;
+    }
+
+    int32_t* low = tempBuffer.getDataPointer();
+    int32_t* samples = low + length / 2;
+
+    // Two fractional bits for the lowpass coefficients of the last level
+    low[0] = ScalarLanes::shiftLeft(coefficients[0], 2);
+    low[1] = ScalarLanes::shiftLeft(coefficients[1], 2);
+
+    int level = 0;
+    for (size_t pairs = 2; pairs < (length / 2); pairs *= 2)
+    {
+        synthesizeLevel(low, coefficients + pairs, pairs, level, samples);
+        level++;
+
+        int32_t* reconstructed = samples;
+        samples = low;
+        low = reconstructed;
+    }
+    synthesizeLevel(low, coefficients + length / 2, length / 2, level, outBuffer.getDataPointer());
+}
 
 const double LeGall53Wavelet::ih0 = -0.25;
 const double LeGall53Wavelet::ih1 = 1.0;
@@ -42,13 +42,19 @@ public:
     /**
      * Runtime optimized forward transformation using two buffers.
      * Lowpass coefficients will always occur before highpass coefficients.
+     *
+     * The samples of each level are split into even and odd samples, which
+     * are filtered with SIMD instructions where available (SSE2, NEON).
+     * The result is bit-exact to the multiplication with the Fixpoint
+     * filter coefficients.
+     *
      * @param inBuffer
      *     Pointer to an array of Fixpoint that shall be transformed to wavelet coefficients.
      *     WARNING: The array will also be used as a temporary buffer, its contents are subject to
      * change!
      * @param bufferLength
      *     Number of elements in inBuffer, which also equals the resulting number of elements in
-     * outBuffer
+     * outBuffer. Must be a power of two.
      * @param outBuffer
      *     Pointer to store the resulting transformed data. Needs to be able to store bufferLength
      * elements.
@@ -60,10 +66,13 @@ public:
      * Memory-optimized forward transformation requiring only one buffer.
      * Coefficients are stored according to the lifting-scheme (i.e. interleaving high- and lowpass
      * coefficients). In order to be NLS encoded, a call to reorder is required.
+     *
+     * The samples of each level are gathered into small contiguous chunks and
+     * filtered like in forwardTransform().
+     *
      * @param inBuffer
      *     Pointer to an array of Fixpoint that shall be transformed to wavelet coefficients.
-     * @param length
-     *     Number of elements in inBuffer
+     *     The number of elements must be a power of two.
      */
     static void
     forwardTransformInPlace(outpost::Slice<Fixpoint> inBuffer);
@@ -89,26 +98,33 @@ public:
     static void
     backwardTransform(outpost::Slice<double> inBuffer, outpost::Slice<double> outBuffer);
 
-private:
-    // Forward lowpass coefficients
-    static const Fixpoint h0;
-    static const Fixpoint h1;
-    static const Fixpoint h2;
-    static const Fixpoint h3;
-    static const Fixpoint h4;
-
-    // Forward highpass coefficients
-    static const Fixpoint g0;
-    static const Fixpoint g1;
-    static const Fixpoint g2;
-
-    // Forward highpass coefficients for in place calculations using the lifting scheme
-    static const Fixpoint ip_g0;
-    static const Fixpoint ip_g1;
-    static const Fixpoint ip_g2;
-    static const Fixpoint ip_g3;
-    static const Fixpoint ip_g4;
+    /**
+     * Backward transformation of the coefficients returned by reorder() or
+     * NLSEncoder::decode() with integer arithmetic.
+     *
+     * The inverse lifting steps only divide by two and four, so the samples
+     * are reconstructed with enough fractional bits to be exact and are
+     * filtered with SIMD instructions where available (SSE2, NEON). The
+     * result equals the floating point backwardTransform() rounded to the
+     * nearest integer (halves rounded up) and saturated to int16_t. This
+     * holds as long as the reconstructed samples lie within
+     * +-2^(30 - log2(bufferLength)), i.e. +-2^17 for 8192 samples.
+     *
+     * @param inBuffer
+     *     Coefficients in the order produced by reorder(). The number of elements must be a
+     * power of two.
+     * @param tempBuffer
+     *     Buffer for the intermediate levels. Needs to be able to store bufferLength elements.
+     * @param outBuffer
+     *     Pointer to store the resulting samples. Needs to be able to store bufferLength
+     * elements, must not overlap with inBuffer.
+     */
+    static void
+    backwardTransform(outpost::Slice<const int16_t> inBuffer,
+                      outpost::Slice<int32_t> tempBuffer,
+                      outpost::Slice<int16_t> outBuffer);
 
+private:
     // Backward (inverse) lowpass coefficients
     static const double ih0;
     static const double ih1;
@@ -19,161 +19,414 @@
 #include <outpost/utils/storage/bitstream.h>
 #include <outpost/utils/storage/serialize.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace outpost
 {
 namespace compression
 {
-void
-NLSEncoder::encode(outpost::Slice<int16_t> inBuffer, Bitstream& outBuffer)
+namespace
 {
-    encode(inBuffer, outBuffer, 2, 0);
-}
-
-void
-NLSEncoder::encode(outpost::Slice<int16_t> inBuffer,
-                   Bitstream& outBuffer,
-                   uint8_t dcComponents,
-                   size_t maxBytes)
+/**
+ * Collects the bits of the encoder in a register and pushes them to the
+ * bitstream 32 bits at a time.
+ */
+class BitWriter
 {
-    if (maxBytes == 0)
+public:
+    BitWriter(Bitstream& stream, size_t maxBytes) :
+        mStream(stream),
+        mBits(0),
+        mNumberOfBits(0),
+        mTotalBits(stream.getNumberOfBits()),
+        mLimit(maxBytes * 8)
     {
-        maxBytes = inBuffer.getNumberOfElements() << 1;
     }
 
-    // Setup the maximum descendant and granddescendant arrays
-    dmax[0] = 0;
-    gmax[0] = 0;
-
-    int16_t max = inBuffer[0];
-    for (uint16_t i = 1; i < dcComponents; i++)
+    inline void
+    push(bool bit)
     {
-        if (max < std::abs(inBuffer[i]))
+        mBits = (mBits << 1) | (bit ? 1U : 0U);
+        mNumberOfBits++;
+        mTotalBits++;
+        if (mNumberOfBits == 32)
         {
-            max = std::abs(inBuffer[i]);
+            flush();
         }
     }
 
-    for (uint16_t i = inBuffer.getNumberOfElements() - 1; i >= 2; i -= 2)
+    inline void
+    push(uint32_t value, uint8_t count)
     {
-        if (std::abs(inBuffer[i]) > max)
+        for (int8_t i = static_cast<int8_t>(count - 1); i >= 0; i--)
         {
-            max = std::abs(inBuffer[i]);
+            push(((value >> i) & 1U) != 0);
         }
+    }
 
-        if (std::abs(inBuffer[i - 1]) > max)
+    /**
+     * Same as Bitstream::getSize() > maxBytes, but without looking at the
+     * bitstream. A full bitstream may stop the encoder earlier, the
+     * remaining bits would have been dropped anyway.
+     */
+    inline bool
+    isLimitExceeded() const
+    {
+        return mTotalBits > mLimit;
+    }
+
+    inline void
+    flush()
+    {
+        mStream.pushBits(mBits, mNumberOfBits);
+        mBits = 0;
+        mNumberOfBits = 0;
+    }
+
+private:
+    Bitstream& mStream;
+    uint32_t mBits;
+    uint8_t mNumberOfBits;
+    size_t mTotalBits;
+    const size_t mLimit;
+};
+
+#if defined(__SSE2__)
+inline __m128i
+magnitude(__m128i v)
+{
+    // Like std::abs() truncated to int16_t, INT16_MIN stays negative
+    const __m128i sign = _mm_srai_epi16(v, 15);
+    return _mm_sub_epi16(_mm_xor_si128(v, sign), sign);
+}
+
+inline __m128i
+maximumOfPairs(__m128i v)
+{
+    // Maximum in the lower half of each 32 bit lane, sign extended
+    const __m128i m = _mm_max_epi16(v, _mm_srli_epi32(v, 16));
+    return _mm_srai_epi32(_mm_slli_epi32(m, 16), 16);
+}
+#endif
+
+/**
+ * result[k] = max(|values[2k]|, |values[2k + 1]|, maxima[2k], maxima[2k + 1])
+ *
+ * \param maxima
+ *      Descendant maxima of the values, nullptr for the last level
+ * \return
+ *      Smallest magnitude, which is only negative for INT16_MIN
+ */
+inline int16_t
+reduceLevel(const int16_t* values, const int16_t* maxima, size_t count, int16_t* result)
+{
+    size_t k = 0;
+    int16_t smallest = INT16_MAX;
+#if defined(__SSE2__)
+    __m128i smallestVector = _mm_set1_epi16(INT16_MAX);
+    for (; (k + 8) <= count; k += 8)
+    {
+        const __m128i a =
+                magnitude(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + 2 * k)));
+        const __m128i b =
+                magnitude(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + 2 * k + 8)));
+        smallestVector = _mm_min_epi16(smallestVector, _mm_min_epi16(a, b));
+
+        __m128i m = _mm_packs_epi32(maximumOfPairs(a), maximumOfPairs(b));
+        if (maxima != nullptr)
         {
-            max = std::abs(inBuffer[i - 1]);
+            const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(maxima + 2 * k));
+            const __m128i d =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(maxima + 2 * k + 8));
+            m = _mm_max_epi16(m, _mm_packs_epi32(maximumOfPairs(c), maximumOfPairs(d)));
         }
-        if (i < inBuffer.getNumberOfElements() >> 1)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(result + k), m);
+    }
+    int16_t lanes[8];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), smallestVector);
+    for (size_t i = 0; i < 8; i++)
+    {
+        smallest = outpost::utils::min<int16_t>(smallest, lanes[i]);
+    }
+#elif defined(__ARM_NEON)
+    int16x8_t smallestVector = vdupq_n_s16(INT16_MAX);
+    for (; (k + 8) <= count; k += 8)
+    {
+        // vabsq_s16() keeps INT16_MIN like std::abs() truncated to int16_t
+        const int16x8x2_t pairs = vld2q_s16(values + 2 * k);
+        const int16x8_t a = vabsq_s16(pairs.val[0]);
+        const int16x8_t b = vabsq_s16(pairs.val[1]);
+        smallestVector = vminq_s16(smallestVector, vminq_s16(a, b));
+
+        int16x8_t m = vmaxq_s16(a, b);
+        if (maxima != nullptr)
         {
-            dmax[i >> 1] = outpost::utils::max<int16_t>(
-                    std::abs(inBuffer[i - 1]), std::abs(inBuffer[i]), dmax[i], dmax[i - 1]);
+            const int16x8x2_t children = vld2q_s16(maxima + 2 * k);
+            m = vmaxq_s16(m, vmaxq_s16(children.val[0], children.val[1]));
+        }
+        vst1q_s16(result + k, m);
+    }
+    int16_t lanes[8];
+    vst1q_s16(lanes, smallestVector);
+    for (size_t i = 0; i < 8; i++)
+    {
+        smallest = outpost::utils::min<int16_t>(smallest, lanes[i]);
+    }
+#endif
+    for (; k < count; k++)
+    {
+        const int16_t a = static_cast<int16_t>(std::abs(values[2 * k]));
+        const int16_t b = static_cast<int16_t>(std::abs(values[2 * k + 1]));
+        smallest = outpost::utils::min<int16_t>(smallest, a, b);
+        if (maxima != nullptr)
+        {
+            result[k] = outpost::utils::max<int16_t>(a, b, maxima[2 * k], maxima[2 * k + 1]);
         }
         else
         {
-            dmax[i >> 1] =
-                    outpost::utils::max<int16_t>(std::abs(inBuffer[i - 1]), std::abs(inBuffer[i]));
+            result[k] = outpost::utils::max<int16_t>(a, b);
         }
     }
+    return smallest;
+}
+inline void
+setBit(uint64_t* map, size_t index)
+{
+    map[index / 64] |= static_cast<uint64_t>(1) << (index % 64);
+}
+
+inline void
+clearBit(uint64_t* map, size_t index)
+{
+    map[index / 64] &= ~(static_cast<uint64_t>(1) << (index % 64));
+}
+}  // namespace
+
+const uint16_t NLSEncoder::skipTable[numberOfMarkers] = {
+        1,  // NM
+        1,  // MIP
+        1,  // MNP
+        1,  // MSP
+        1,  // MCP
+        2,  // MD
+        4,  // MG
+        2,  // MN2
+        4,
+        8,
+        16,
+        32,
+        64,
+        128,
+        256,
+        512,
+        1024,
+        2048,
+        4096,
+        8192  // MN14
+};
+
+const uint16_t NLSEncoder::isSkipTable[numberOfMarkers] = {
+        1,  // NM
+        2,  // MIP
+        2,  // MNP
+        2,  // MSP
+        1,  // MCP
+        2,  // MD
+        4,  // MG
+        2,  // MN2
+        4,
+        8,
+        16,
+        32,
+        64,
+        128,
+        256,
+        512,
+        1024,
+        2048,
+        4096,
+        8192  // MN14
+};
+
+void
+NLSEncoder::encode(outpost::Slice<int16_t> inBuffer, Bitstream& outBuffer)
+{
+    encode(inBuffer, outBuffer, 2, 0);
+}
+
+int16_t
+NLSEncoder::calculateMaxima(const int16_t* coefficients, size_t length, uint8_t dcComponents)
+{
+    dmax[0] = 0;
+    gmax[0] = 0;
+
+    // dmax[k] is the maximum of the pair 2k, 2k + 1 and all its descendants
+    int16_t smallest = INT16_MAX;
+    for (size_t first = length / 4; first >= 1; first /= 2)
+    {
+        const int16_t* children = (first < (length / 4)) ? &dmax[2 * first] : nullptr;
+        smallest = outpost::utils::min<int16_t>(
+                smallest, reduceLevel(&coefficients[2 * first], children, first, &dmax[first]));
+    }
 
-    for (uint16_t i = 1; i < inBuffer.getNumberOfElements() >> 2; i++)
+    for (size_t i = 1; i < (length >> 2); i++)
     {
         gmax[i] = outpost::utils::max<int16_t>(dmax[i << 1], dmax[(i << 1) + 1]);
     }
 
-    // Calculate the number of bitplanes
-    int8_t n = Log2(max);
-    uint16_t s = 1 << n;
-
-    // Put the number of bitplanes in the output stream
-    for (int8_t i = 3; i >= 0; i--)
+    if (smallest >= 0)
     {
-        outBuffer.pushBit(static_cast<uint16_t>(1 << i) & n);
+        // All coefficients from 2 on are descendants of 2 and 3
+        int16_t max = coefficients[0];
+        for (size_t i = 1; (i < dcComponents) && (i < length); i++)
+        {
+            max = outpost::utils::max<int16_t>(max, std::abs(coefficients[i]));
+        }
+        if (length >= 4)
+        {
+            max = outpost::utils::max<int16_t>(max, dmax[1]);
+        }
+        return max;
     }
 
-    // Put the number of DC components in the output stream
-    for (int8_t i = 3; i >= 0; i--)
+    // The magnitude of INT16_MIN does not fit into int16_t. The result
+    // depends on the order of the comparisons, keep the original one.
+    int16_t max = coefficients[0];
+    for (uint16_t i = 1; i < dcComponents; i++)
     {
-        outBuffer.pushBit(static_cast<uint8_t>(1 << i) & dcComponents);
+        if (max < std::abs(coefficients[i]))
+        {
+            max = std::abs(coefficients[i]);
+        }
     }
+    for (uint16_t i = static_cast<uint16_t>(length - 1); i >= 2; i -= 2)
+    {
+        if (std::abs(coefficients[i]) > max)
+        {
+            max = std::abs(coefficients[i]);
+        }
+        if (std::abs(coefficients[i - 1]) > max)
+        {
+            max = std::abs(coefficients[i - 1]);
+        }
+    }
+    return max;
+}
 
-    // Put the number of coefficients in the output stream
-    size_t exponent = Log2(inBuffer.getNumberOfElements());
-    for (int8_t i = 3; i >= 0; i--)
+void
+NLSEncoder::encode(outpost::Slice<int16_t> inBuffer,
+                   Bitstream& outBuffer,
+                   uint8_t dcComponents,
+                   size_t maxBytes)
+{
+    const size_t length = inBuffer.getNumberOfElements();
+    if (maxBytes == 0)
     {
-        size_t tmp = static_cast<size_t>(1 << i) & exponent;
-        outBuffer.pushBit(tmp > 0);
+        maxBytes = length << 1;
     }
+    int16_t* coefficients = inBuffer.getDataPointer();
+
+    // Setup the maximum descendant and granddescendant arrays
+    int16_t max = calculateMaxima(coefficients, length, dcComponents);
+
+    // Calculate the number of bitplanes
+    int8_t n = Log2(max);
+    uint16_t s = 1 << n;
+
+    BitWriter out(outBuffer, maxBytes);
+
+    // Put the number of bitplanes, DC components and coefficients in the output stream
+    out.push(static_cast<uint8_t>(n), 4);
+    out.push(dcComponents, 4);
+    out.push(static_cast<uint32_t>(Log2(length)), 4);
 
     // Initialize the state marker table
+    const size_t numberOfWords = (length + bitsPerWord - 1) / bitsPerWord;
+    for (size_t w = 0; w < numberOfWords; w++)
+    {
+        mInsignificant[w] = 0;
+        mNewlySignificant[w] = 0;
+        mSignificant[w] = 0;
+    }
+
     uint16_t i = 0;
     for (; i < dcComponents; i++)
     {
         mark[i] = MIP;
+        setBit(mInsignificant, i);
     }
 
     for (; i < dcComponents << 1; i++)
     {
         mark[i] = MD;
-        push(i, inBuffer.getNumberOfElements());
+        push(i, length);
     }
 
-    for (; i < inBuffer.getNumberOfElements(); i++)
+    for (; i < length; i++)
     {
         mark[i] = NM;
     }
 
-    // Iterate over all bitplanes
-    while (n >= 0)
+    // With an even number of DC components every set starts at an even
+    // index and the skipped parts of the state marker table never contain
+    // coefficients marked MIP, MNP or MSP. Otherwise the bit maps are
+    // rebuilt from the markers the passes would visit.
+    const bool alignedSets = (dcComponents % 2) == 0;
+
+    // Iterate over all bitplanes, stop as soon as the maximum number of
+    // output bytes is exceeded
+    bool exceeded = false;
+    while ((n >= 0) && !exceeded)
     {
-        // Insignificant Pixel Pass
-        uint16_t j = 0;
-        while (j < inBuffer.getNumberOfElements())
+        if (!alignedSets)
+        {
+            collect(MIP, mInsignificant, length);
+        }
+
+        // Insignificant Pixel Pass, visits all coefficients marked MIP
+        for (size_t w = 0; (w < numberOfWords) && !exceeded; w++)
         {
-            // If the coefficient is not yet tested, test it for significance
-            if (mark[j] == MIP)
+            uint64_t pending = mInsignificant[w];
+            while ((pending != 0) && !exceeded)
             {
+                const size_t j = w * bitsPerWord + __builtin_ctzll(pending);
+                pending &= pending - 1;
+
                 // If the coefficient is significant, mark it MNP and push this information and its
                 // sign bit to the output stream
-                bool sig = std::abs(inBuffer[j]) >= s;
-                outBuffer.pushBit(sig);
+                const int16_t c = coefficients[j];
+                bool sig = std::abs(c) >= s;
+                out.push(sig);
                 if (sig)
                 {
-                    outBuffer.pushBit(inBuffer[j] < 0);
+                    out.push(c < 0);
                     mark[j] = MNP;
-                    inBuffer[j] = std::abs(inBuffer[j]);
+                    clearBit(mInsignificant, j);
+                    setBit(mNewlySignificant, j);
+                    coefficients[j] = std::abs(c);
                 }
-                j++;
-            }
-            else
-            {
-                j += skip(mark[j]);
-            }
-            if (outBuffer.getSize() > maxBytes)
-            {
-                break;
+                exceeded = out.isLimitExceeded();
             }
         }
 
-        // Break if the maximum number of output bytes is reached.
-        if (outBuffer.getSize() > maxBytes)
-        {
-            break;
-        }
-
         // Insignificant Set Pass
-        j = 0;
-        while (j < inBuffer.getNumberOfElements())
+        size_t j = 0;
+        while ((j < length) && !exceeded)
         {
             // Iterate over sets and inspect coefficients marked  MD, MG and MCP
-            if (mark[j] == MD)
+            const Marker m = mark[j];
+            if (m == MD)
             {
                 bool sig = dmax[j >> 1] >= s;
-                outBuffer.pushBit(sig);
+                out.push(sig);
                 if (sig)
                 {
                     mark[j] = mark[j + 1] = MCP;
-                    if (static_cast<size_t>(j << 1) < inBuffer.getNumberOfElements())
+                    if ((j << 1) < length)
                     {
                         mark[j << 1] = MG;
                     }
@@ -182,90 +435,106 @@ NLSEncoder::encode(outpost::Slice<int16_t> inBuffer,
                 {
                     j += 2;
                 }
+                exceeded = out.isLimitExceeded();
             }
-            else if (mark[j] == MG)
+            else if (m == MG)
             {
                 bool sig = gmax[j >> 2] >= s;
-                outBuffer.pushBit(sig);
+                out.push(sig);
                 if (sig)
                 {
                     mark[j] = mark[j + 2] = MD;
-                    push(j, inBuffer.getNumberOfElements());
-                    push(j + 2, inBuffer.getNumberOfElements());
+                    push(static_cast<uint16_t>(j), length);
+                    push(static_cast<uint16_t>(j + 2), length);
                 }
                 else
                 {
                     j += 4;
                 }
+                exceeded = out.isLimitExceeded();
             }
-            else if (mark[j] == MCP)
+            else if (m == MCP)
             {
-                bool sig = std::abs(inBuffer[j]) >= s;
-                outBuffer.pushBit(sig);
+                const int16_t c = coefficients[j];
+                bool sig = std::abs(c) >= s;
+                out.push(sig);
                 if (sig)
                 {
-                    outBuffer.pushBit(inBuffer[j] < 0);
+                    out.push(c < 0);
                     mark[j] = MNP;
-                    inBuffer[j] = std::abs(inBuffer[j]);
+                    setBit(mNewlySignificant, j);
+                    coefficients[j] = std::abs(c);
                 }
                 else
                 {
                     mark[j] = MIP;
+                    setBit(mInsignificant, j);
                 }
+                exceeded = out.isLimitExceeded();
                 j++;
             }
             else
             {
-                j = j + isSkip(mark[j]);
-            }
-            if (outBuffer.getSize() > maxBytes)
-            {
-                break;
+                j += isSkip(m);
             }
         }
 
-        // Break if the maximum number of output bytes is reached.
-        if (outBuffer.getSize() > maxBytes)
+        if (!alignedSets)
         {
-            break;
+            collect(MSP, mSignificant, length);
+            collect(MNP, mNewlySignificant, length);
         }
 
-        // Refinement Pass
-        j = 0;
-        while (j < inBuffer.getNumberOfElements())
+        // Refinement Pass, pushes the current bit of all coefficients marked
+        // MSP. Newly identified significant coefficients shall be refined in
+        // the next pass.
+        for (size_t w = 0; (w < numberOfWords) && !exceeded; w++)
         {
-            // Push significant coefficients to the output stream
-            if (mark[j] == MSP)
+            uint64_t pending = mSignificant[w];
+            while ((pending != 0) && !exceeded)
             {
-                outBuffer.pushBit((inBuffer[j] & s) > 0);
-                j++;
-            }
-            // Newly identified significant coefficients shall be refined in the next pass
-            else if (mark[j] == MNP)
-            {
-                mark[j] = MSP;
-                j++;
-            }
-            else
-            {
-                j += skip(mark[j]);
+                const size_t k = w * bitsPerWord + __builtin_ctzll(pending);
+                pending &= pending - 1;
+
+                out.push((coefficients[k] & s) > 0);
+                exceeded = out.isLimitExceeded();
             }
-            if (outBuffer.getSize() > maxBytes)
+
+            uint64_t newlySignificant = mNewlySignificant[w];
+            mSignificant[w] |= newlySignificant;
+            mNewlySignificant[w] = 0;
+            while (newlySignificant != 0)
             {
-                break;
+                mark[w * bitsPerWord + __builtin_ctzll(newlySignificant)] = MSP;
+                newlySignificant &= newlySignificant - 1;
             }
         }
 
-        // Break if the maximum number of output bytes is reached.
-        if (outBuffer.getSize() > maxBytes)
-        {
-            break;
-        }
-
         // Calculate the next bitplane
         n--;
         s = s >> 1;
     }
+
+    out.flush();
+}
+
+void
+NLSEncoder::collect(Marker marker, uint64_t* map, size_t length)
+{
+    for (size_t w = 0; w < (length + bitsPerWord - 1) / bitsPerWord; w++)
+    {
+        map[w] = 0;
+    }
+
+    size_t j = 0;
+    while (j < length)
+    {
+        if (mark[j] == marker)
+        {
+            setBit(map, j);
+        }
+        j += skip(mark[j]);
+    }
 }
 
 void
@@ -283,13 +552,12 @@ NLSEncoder::push(uint16_t pI, size_t pBufferLength)
 outpost::Slice<int16_t>
 NLSEncoder::decode(Bitstream& inBuffer, outpost::Slice<int16_t> outBuffer)
 {
-    int8_t n;
-    uint8_t dcComponents;
-    n = 0x0F & (inBuffer.getByte(0) >> 4);
-    dcComponents = inBuffer.getByte(0) & 0x0F;
+    inBuffer.setReadPosition(0);
+    int8_t n = static_cast<int8_t>(inBuffer.readBits(4));
+    uint8_t dcComponents = static_cast<uint8_t>(inBuffer.readBits(4));
     uint16_t s = 1 << n;
 
-    size_t outBufferLength = 1 << ((inBuffer.getByte(1) >> 4) & 0x0F);
+    size_t outBufferLength = 1 << inBuffer.readBits(4);
     if (outBufferLength < 8 || outBuffer.getNumberOfElements() < outBufferLength)
     {
         return outpost::Slice<int16_t>::empty();
@@ -314,8 +582,6 @@ NLSEncoder::decode(Bitstream& inBuffer, outpost::Slice<int16_t> outBuffer)
         push(i, outBufferLength);
     }
 
-    uint16_t buffer_bit_pointer = 12;
-
     while (n >= 0)
     {
         // IP Pass
@@ -324,10 +590,10 @@ NLSEncoder::decode(Bitstream& inBuffer, outpost::Slice<int16_t> outBuffer)
         {
             if (mark[i] == MIP)
             {
-                bool sig = inBuffer.getBit(buffer_bit_pointer++);
+                bool sig = inBuffer.readBit();
                 if (sig)
                 {
-                    signs[i] = inBuffer.getBit(buffer_bit_pointer++);
+                    signs[i] = inBuffer.readBit();
                     mark[i] = MNP;
                     outBuffer[i] += (1 - 2 * signs[i]) * (s + (s >> 1));
                 }
@@ -339,7 +605,7 @@ NLSEncoder::decode(Bitstream& inBuffer, outpost::Slice<int16_t> outBuffer)
             }
         }
 
-        if (buffer_bit_pointer >> 3 > inBuffer.getSize())
+        if (inBuffer.getReadPosition() >> 3 > inBuffer.getSize())
         {
             break;
         }
@@ -350,7 +616,7 @@ NLSEncoder::decode(Bitstream& inBuffer, outpost::Slice<int16_t> outBuffer)
         {
             if (mark[i] == MD)
             {
-                bool sig = inBuffer.getBit(buffer_bit_pointer++);
+                bool sig = inBuffer.readBit();
                 if (sig)
                 {
                     mark[i] = mark[i + 1] = MCP;
@@ -366,7 +632,7 @@ NLSEncoder::decode(Bitstream& inBuffer, outpost::Slice<int16_t> outBuffer)
             }
             else if (mark[i] == MG)
             {
-                bool sig = inBuffer.getBit(buffer_bit_pointer++);
+                bool sig = inBuffer.readBit();
                 if (sig)
                 {
                     mark[i] = mark[i + 2] = MD;
@@ -380,10 +646,10 @@ NLSEncoder::decode(Bitstream& inBuffer, outpost::Slice<int16_t> outBuffer)
             }
             else if (mark[i] == MCP)
             {
-                bool sig = inBuffer.getBit(buffer_bit_pointer++);
+                bool sig = inBuffer.readBit();
                 if (sig)
                 {
-                    signs[i] = inBuffer.getBit(buffer_bit_pointer++);
+                    signs[i] = inBuffer.readBit();
                     mark[i] = MNP;
                     outBuffer[i] += (1 - 2 * signs[i]) * (s + (s >> 1));
                 }
@@ -399,7 +665,7 @@ NLSEncoder::decode(Bitstream& inBuffer, outpost::Slice<int16_t> outBuffer)
             }
         }
 
-        if (buffer_bit_pointer >> 3 > inBuffer.getSize())
+        if (inBuffer.getReadPosition() >> 3 > inBuffer.getSize())
         {
             break;
         }
@@ -410,7 +676,7 @@ NLSEncoder::decode(Bitstream& inBuffer, outpost::Slice<int16_t> outBuffer)
         {
             if (mark[i] == MSP)
             {
-                bool sig = inBuffer.getBit(buffer_bit_pointer++);
+                bool sig = inBuffer.readBit();
 
                 if (sig)
                 {
@@ -433,7 +699,7 @@ NLSEncoder::decode(Bitstream& inBuffer, outpost::Slice<int16_t> outBuffer)
             }
         }
 
-        if (buffer_bit_pointer >> 3 > inBuffer.getSize())
+        if (inBuffer.getReadPosition() >> 3 > inBuffer.getSize())
         {
             break;
         }
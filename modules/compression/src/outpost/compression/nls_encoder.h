@@ -41,7 +41,7 @@ private:
 
 public:
     // State table markers
-    enum Marker
+    enum Marker : uint8_t
     {
         NM,   // Not marked
         MIP,  // The coefficient is insignificant or untested for this bitplane
@@ -69,10 +69,12 @@ public:
         MN11,
         MN12,
         MN13,
-        MN14
+        MN14,
+
+        numberOfMarkers
     };
 
-    NLSEncoder() : mark{}, dmax{}, gmax{}
+    NLSEncoder() : mark{}, dmax{}, gmax{}, mInsignificant{}, mNewlySignificant{}, mSignificant{}
     {
     }
 
@@ -136,6 +138,13 @@ private:
     void
     push(uint16_t pI, size_t pBufferLength);
 
+    /**
+     * Set the bits of all coefficients with the given marker that the IP
+     * and REF passes of the state marker table would visit.
+     */
+    void
+    collect(Marker marker, uint64_t* map, size_t length);
+
     /**
      * Number of coefficients to skip during IP and REF passes depending on the current marker
      * @param pM
@@ -146,30 +155,7 @@ private:
     inline static uint16_t
     skip(Marker pM)
     {
-        switch (pM)
-        {
-            case MIP:
-            case MNP:
-            case MCP:
-            case MSP:
-            case NM: return 1;
-            case MD:
-            case MN2: return 2;
-            case MG:
-            case MN3: return 4;
-            case MN4: return 8;
-            case MN5: return 16;
-            case MN6: return 32;
-            case MN7: return 64;
-            case MN8: return 128;
-            case MN9: return 256;
-            case MN10: return 512;
-            case MN11: return 1024;
-            case MN12: return 2048;
-            case MN13: return 4096;
-            case MN14: return 8192;
-            default: return 1;
-        }
+        return skipTable[pM];
     }
 
     /**
@@ -182,31 +168,30 @@ private:
     inline static uint16_t
     isSkip(Marker pM)
     {
-        switch (pM)
-        {
-            case MCP:
-            case NM: return 1;
-            case MD:
-            case MN2:
-            case MIP:
-            case MNP:
-            case MSP: return 2;
-            case MG:
-            case MN3: return 4;
-            case MN4: return 8;
-            case MN5: return 16;
-            case MN6: return 32;
-            case MN7: return 64;
-            case MN8: return 128;
-            case MN9: return 256;
-            case MN10: return 512;
-            case MN11: return 1024;
-            case MN12: return 2048;
-            case MN13: return 4096;
-            case MN14: return 8192;
-            default: return 1;
-        }
+        return isSkipTable[pM];
     }
+
+    /**
+     * Calculate the descendant maxima dmax and gmax bottom-up, one level of
+     * the coefficient tree at a time.
+     *
+     * @return
+     *     Maximum magnitude of all coefficients that are encoded
+     */
+    int16_t
+    calculateMaxima(const int16_t* coefficients, size_t length, uint8_t dcComponents);
+
+    static const uint16_t skipTable[numberOfMarkers];
+    static const uint16_t isSkipTable[numberOfMarkers];
+
+    static constexpr size_t bitsPerWord = 64;
+
+    // Coefficients marked MIP, MNP and MSP, one bit per coefficient. The IP
+    // and REF passes only visit the set bits instead of the whole state
+    // marker table.
+    uint64_t mInsignificant[MAX_LENGTH / bitsPerWord];
+    uint64_t mNewlySignificant[MAX_LENGTH / bitsPerWord];
+    uint64_t mSignificant[MAX_LENGTH / bitsPerWord];
 };
 
 }  // namespace compression
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/base/fixpoint.h>
+#include <outpost/compression/data_block.h>
+#include <outpost/compression/data_processor_pool.h>
+#include <outpost/utils/container/reference_queue.h>
+#include <outpost/utils/container/shared_object_pool.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using namespace testing;
+using namespace outpost;
+using namespace outpost::compression;
+
+namespace data_processor_pool_test
+{
+/**
+ * Advances by one millisecond with every call to now().
+ */
+class SteppingClock : public outpost::time::Clock
+{
+public:
+    SteppingClock() : mTime(outpost::time::SpacecraftElapsedTime::startOfEpoch())
+    {
+    }
+
+    outpost::time::SpacecraftElapsedTime
+    now() const override
+    {
+        mTime += outpost::time::Milliseconds(1);
+        return mTime;
+    }
+
+private:
+    mutable outpost::time::SpacecraftElapsedTime mTime;
+};
+
+class DataProcessorPoolTest : public ::testing::Test
+{
+public:
+    DataProcessorPoolTest() :
+        mProcessorPool(mClock, mPool, mInputQueue, mOutputQueue),
+        mWorker0(mProcessorPool,
+                 123U,
+                 outpost::support::parameter::HeartbeatSource::default0,
+                 outpost::time::Duration::zero()),
+        mWorker1(mProcessorPool,
+                 123U,
+                 outpost::support::parameter::HeartbeatSource::default1,
+                 outpost::time::Duration::zero())
+    {
+    }
+
+    /**
+     * Send a block of 16 samples, the start time identifies the block.
+     */
+    void
+    sendBlock(uint16_t parameterId, uint32_t number)
+    {
+        outpost::utils::SharedBufferPointer p;
+        ASSERT_TRUE(mPool.allocate(p));
+
+        DataBlock block(p,
+                        parameterId,
+                        outpost::time::GpsTime::afterEpoch(outpost::time::Seconds(number)),
+                        SamplingRate::hz05,
+                        Blocksize::bs16);
+        for (int32_t i = 0; i < 16; i++)
+        {
+            block.push(outpost::Fixpoint(i));
+        }
+        ASSERT_TRUE(mInputQueue.send(block));
+    }
+
+    void
+    expectBlock(uint16_t parameterId, uint32_t number)
+    {
+        DataBlock block;
+        ASSERT_TRUE(mOutputQueue.receive(block, outpost::time::Duration::zero()));
+        EXPECT_TRUE(block.isEncoded());
+        EXPECT_EQ(block.getParameterId(), parameterId);
+        EXPECT_EQ(block.getStartTime(),
+                  outpost::time::GpsTime::afterEpoch(outpost::time::Seconds(number)));
+    }
+
+    SteppingClock mClock;
+    outpost::utils::SharedBufferPool<16500, 20> mPool;
+    outpost::utils::ReferenceQueue<DataBlock, 8> mInputQueue;
+    outpost::utils::ReferenceQueue<DataBlock, 4> mOutputQueue;
+
+    DataProcessorPool mProcessorPool;
+    DataProcessorWorker mWorker0;
+    DataProcessorWorker mWorker1;
+};
+
+TEST_F(DataProcessorPoolTest, Constructor)
+{
+    EXPECT_EQ(mProcessorPool.getNumberOfWorkers(), 2U);
+
+    EXPECT_EQ(mProcessorPool.getNumberOfReceivedBlocks(), 0U);
+    EXPECT_EQ(mProcessorPool.getNumberOfProcessedBlocks(), 0U);
+    EXPECT_EQ(mProcessorPool.getNumberOfForwardedBlocks(), 0U);
+    EXPECT_EQ(mProcessorPool.getNumberOfLostBlocks(), 0U);
+
+    EXPECT_FALSE(mWorker0.isEnabled());
+    EXPECT_FALSE(mWorker1.isEnabled());
+}
+
+TEST_F(DataProcessorPoolTest, EnableDisable)
+{
+    mProcessorPool.enable();
+    EXPECT_TRUE(mWorker0.isEnabled());
+    EXPECT_TRUE(mWorker1.isEnabled());
+
+    mProcessorPool.disable();
+    EXPECT_FALSE(mWorker0.isEnabled());
+    EXPECT_FALSE(mWorker1.isEnabled());
+}
+
+TEST_F(DataProcessorPoolTest, workerRemovesItself)
+{
+    {
+        DataProcessorWorker worker(
+                mProcessorPool, 123U, outpost::support::parameter::HeartbeatSource::default0);
+        EXPECT_EQ(mProcessorPool.getNumberOfWorkers(), 3U);
+    }
+    EXPECT_EQ(mProcessorPool.getNumberOfWorkers(), 2U);
+}
+
+TEST_F(DataProcessorPoolTest, removedWorkerLosesItsBlock)
+{
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        sendBlock(7U, i);
+    }
+
+    // Fill the output queue
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        mWorker0.processSingleBlock(outpost::time::Duration::zero());
+    }
+
+    {
+        DataProcessorWorker worker(mProcessorPool,
+                                   123U,
+                                   outpost::support::parameter::HeartbeatSource::default0,
+                                   outpost::time::Duration::zero());
+        worker.processSingleBlock(outpost::time::Duration::zero());
+        EXPECT_EQ(mProcessorPool.getNumberOfProcessedBlocks(), 5U);
+    }
+
+    EXPECT_EQ(mProcessorPool.getNumberOfForwardedBlocks(), 4U);
+    EXPECT_EQ(mProcessorPool.getNumberOfLostBlocks(), 1U);
+}
+
+TEST_F(DataProcessorPoolTest, processSingleInvalidBlock)
+{
+    DataBlock block;
+    mInputQueue.send(block);
+
+    mWorker0.processSingleBlock(outpost::time::Duration::zero());
+
+    EXPECT_EQ(mProcessorPool.getNumberOfReceivedBlocks(), 1U);
+    EXPECT_EQ(mProcessorPool.getNumberOfProcessedBlocks(), 0U);
+    EXPECT_EQ(mProcessorPool.getNumberOfForwardedBlocks(), 0U);
+    EXPECT_EQ(mProcessorPool.getNumberOfLostBlocks(), 1U);
+    EXPECT_EQ(mWorker0.getNumberOfProcessedBlocks(), 0U);
+
+    EXPECT_FALSE(mOutputQueue.receive(block, outpost::time::Duration::zero()));
+}
+
+TEST_F(DataProcessorPoolTest, workersShareInputQueue)
+{
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        sendBlock(7U, i);
+    }
+
+    mWorker0.processSingleBlock(outpost::time::Duration::zero());
+    mWorker1.processSingleBlock(outpost::time::Duration::zero());
+    mWorker1.processSingleBlock(outpost::time::Duration::zero());
+    mWorker0.processSingleBlock(outpost::time::Duration::zero());
+
+    EXPECT_EQ(mProcessorPool.getNumberOfReceivedBlocks(), 4U);
+    EXPECT_EQ(mProcessorPool.getNumberOfProcessedBlocks(), 4U);
+    EXPECT_EQ(mProcessorPool.getNumberOfForwardedBlocks(), 4U);
+    EXPECT_EQ(mProcessorPool.getNumberOfLostBlocks(), 0U);
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        expectBlock(7U, i);
+    }
+}
+
+TEST_F(DataProcessorPoolTest, statisticsPerWorker)
+{
+    sendBlock(7U, 0);
+    sendBlock(7U, 1);
+    sendBlock(7U, 2);
+
+    mWorker0.processSingleBlock(outpost::time::Duration::zero());
+    mWorker0.processSingleBlock(outpost::time::Duration::zero());
+    mWorker1.processSingleBlock(outpost::time::Duration::zero());
+
+    // The clock advances by 1 ms between the start and the end of the processing
+    EXPECT_EQ(mWorker0.getNumberOfProcessedBlocks(), 2U);
+    EXPECT_EQ(mWorker0.getProcessingTime(), outpost::time::Milliseconds(2));
+    EXPECT_EQ(mWorker0.getMaximumProcessingTime(), outpost::time::Milliseconds(1));
+    EXPECT_EQ(mWorker1.getNumberOfProcessedBlocks(), 1U);
+    EXPECT_EQ(mWorker1.getProcessingTime(), outpost::time::Milliseconds(1));
+
+    mWorker0.resetStatistics();
+    EXPECT_EQ(mWorker0.getNumberOfProcessedBlocks(), 0U);
+    EXPECT_EQ(mWorker0.getProcessingTime(), outpost::time::Duration::zero());
+    EXPECT_EQ(mWorker0.getMaximumProcessingTime(), outpost::time::Duration::zero());
+    EXPECT_EQ(mWorker0.getStallTime(), outpost::time::Duration::zero());
+}
+
+TEST_F(DataProcessorPoolTest, fullOutputQueueKeepsEncodedBlocks)
+{
+    for (uint32_t i = 0; i < 8; i++)
+    {
+        sendBlock(7U, i);
+    }
+
+    // Fill the output queue
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        mWorker0.processSingleBlock(outpost::time::Duration::zero());
+    }
+
+    // Both workers hold an encoded block and stop receiving
+    mWorker0.processSingleBlock(outpost::time::Duration::zero());
+    mWorker1.processSingleBlock(outpost::time::Duration::zero());
+    mWorker0.processSingleBlock(outpost::time::Duration::zero());
+    mWorker1.processSingleBlock(outpost::time::Duration::zero());
+
+    EXPECT_EQ(mProcessorPool.getNumberOfReceivedBlocks(), 6U);
+    EXPECT_EQ(mProcessorPool.getNumberOfProcessedBlocks(), 6U);
+    EXPECT_EQ(mProcessorPool.getNumberOfForwardedBlocks(), 4U);
+    EXPECT_EQ(mProcessorPool.getNumberOfLostBlocks(), 0U);
+    EXPECT_EQ(mInputQueue.getNumberOfItems(), 2U);
+
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        expectBlock(7U, i);
+    }
+
+    // The older block is forwarded first, even when the other worker
+    // checks the output queue
+    mWorker1.processSingleBlock(outpost::time::Duration::zero());
+    mWorker0.processSingleBlock(outpost::time::Duration::zero());
+
+    EXPECT_EQ(mProcessorPool.getNumberOfReceivedBlocks(), 8U);
+    EXPECT_EQ(mProcessorPool.getNumberOfForwardedBlocks(), 8U);
+    EXPECT_EQ(mProcessorPool.getNumberOfLostBlocks(), 0U);
+    EXPECT_GT(mWorker0.getStallTime() + mWorker1.getStallTime(), outpost::time::Duration::zero());
+
+    for (uint32_t i = 4; i < 8; i++)
+    {
+        expectBlock(7U, i);
+    }
+}
+
+TEST_F(DataProcessorPoolTest, blocksOfOneParameterStayInOrder)
+{
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        sendBlock(static_cast<uint16_t>(1U + (i % 2)), i);
+    }
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        mWorker0.processSingleBlock(outpost::time::Duration::zero());
+    }
+
+    sendBlock(1U, 4);
+    sendBlock(1U, 5);
+    mWorker1.processSingleBlock(outpost::time::Duration::zero());
+    mWorker0.processSingleBlock(outpost::time::Duration::zero());
+
+    // Only one slot in the output queue, block 5 must wait for block 4
+    expectBlock(1U, 0);
+    mWorker0.processSingleBlock(outpost::time::Duration::zero());
+    EXPECT_EQ(mProcessorPool.getNumberOfForwardedBlocks(), 5U);
+
+    expectBlock(2U, 1);
+    expectBlock(1U, 2);
+    expectBlock(2U, 3);
+    expectBlock(1U, 4);
+
+    mWorker0.processSingleBlock(outpost::time::Duration::zero());
+    expectBlock(1U, 5);
+    EXPECT_EQ(mProcessorPool.getNumberOfForwardedBlocks(), 6U);
+}
+
+TEST_F(DataProcessorPoolTest, resetCounters)
+{
+    sendBlock(7U, 0);
+    mWorker0.processSingleBlock(outpost::time::Duration::zero());
+
+    mProcessorPool.resetCounters();
+
+    EXPECT_EQ(mProcessorPool.getNumberOfReceivedBlocks(), 0U);
+    EXPECT_EQ(mProcessorPool.getNumberOfProcessedBlocks(), 0U);
+    EXPECT_EQ(mProcessorPool.getNumberOfForwardedBlocks(), 0U);
+    EXPECT_EQ(mProcessorPool.getNumberOfLostBlocks(), 0U);
+}
+
+}  // namespace data_processor_pool_test
@@ -12,6 +12,7 @@
 #include <outpost/base/fixpoint.h>
 #include <outpost/base/slice.h>
 #include <outpost/compression/nls_encoder.h>
+#include <outpost/utils/coding/crc32.h>
 #include <outpost/utils/storage/bitstream.h>
 
 #include <gmock/gmock.h>
@@ -33,6 +34,72 @@ static outpost::Slice<int16_t> inputData(inputBuffer);
 static uint8_t bitStreamBuffer[2 * bufferLength];
 static outpost::Slice<uint8_t> bitStreamSlice(bitStreamBuffer);
 
+namespace
+{
+struct EncodedBlock
+{
+    size_t length;
+    uint8_t dcComponents;
+    size_t maxBytes;
+    uint32_t seed;
+    uint32_t crc;
+};
+
+// Checksums of the bitstreams of the original bit by bit encoder
+const EncodedBlock encodedBlocks[] = {
+        {16, 2, 0, 1, 0x0CE2499F},
+        {16, 2, 0, 2, 0x76916B89},
+        {64, 1, 0, 1, 0xA28B96FC},
+        {64, 1, 0, 2, 0xE82DEF05},
+        {256, 2, 40, 1, 0xD73E0906},
+        {256, 2, 40, 2, 0x0491B044},
+        {512, 3, 0, 1, 0xB5AA3ED0},
+        {512, 3, 0, 2, 0x546D4A5D},
+        {1024, 4, 300, 1, 0x3FC66B20},
+        {1024, 4, 300, 2, 0xE02A43CC},
+        {2048, 2, 0, 1, 0x5EC95543},
+        {2048, 2, 0, 2, 0xF577D017},
+        {4096, 2, 0, 1, 0xDDCC06BF},
+        {4096, 2, 0, 2, 0x272E4A81},
+        {4096, 5, 1000, 1, 0x6DC932EE},
+        {4096, 5, 1000, 2, 0xCD96C2E8},
+        {4096, 2, 512, 1, 0x6B77E418},
+        {4096, 2, 512, 2, 0x553AE9BE},
+};
+
+uint32_t
+nextRandom(uint32_t& state)
+{
+    state = state * 1664525U + 1013904223U;
+    return state >> 8;
+}
+
+/**
+ * Coefficients with magnitudes decreasing towards the finer levels like
+ * those of a wavelet transform, some set to INT16_MIN.
+ */
+void
+generateCoefficients(int16_t* coefficients, size_t length, uint32_t seed)
+{
+    uint32_t state = seed;
+    for (size_t i = 0; i < length; i++)
+    {
+        const uint32_t bits = 2 + (13 * (length - i)) / length;
+        const int32_t range = static_cast<int32_t>(1) << bits;
+        const uint32_t r = nextRandom(state);
+        if ((r % 97) == 0)
+        {
+            coefficients[i] = INT16_MIN;
+        }
+        else
+        {
+            coefficients[i] = static_cast<int16_t>(
+                    static_cast<int32_t>((r >> 8) % static_cast<uint32_t>(range)) - range / 2);
+        }
+    }
+}
+}  // namespace
+
 class NLSRegressionTest : public ::testing::Test
 {
 public:
@@ -102,3 +169,27 @@ TEST_F(NLSRegressionTest, Test_Dataset2)
         EXPECT_EQ(res[i], regression_input2[i]);
     }
 }
+
+TEST_F(NLSRegressionTest, bitstreamIsUnchanged)
+{
+    static uint8_t serialized[2 * bufferLength + Bitstream::headerSize];
+
+    for (const EncodedBlock& block : encodedBlocks)
+    {
+        generateCoefficients(inputBuffer, block.length, block.seed);
+        outpost::Bitstream bitstream(bitStreamSlice);
+        encoder.encode(
+                inputData.first(block.length), bitstream, block.dcComponents, block.maxBytes);
+
+        outpost::Slice<uint8_t> serializedSlice(serialized);
+        outpost::Serialize stream(serializedSlice);
+        bitstream.serialize(stream);
+
+        EXPECT_EQ(block.crc,
+                  Crc32Reversed::calculate(
+                          outpost::Slice<const uint8_t>::unsafe(serialized, stream.getPosition())))
+                << "length " << block.length << ", DC components "
+                << static_cast<int>(block.dcComponents) << ", maxBytes " << block.maxBytes
+                << ", seed " << block.seed;
+    }
+}
@@ -341,4 +341,230 @@ TEST_F(TransformTest, ReorderTest)
     }
 }
 
+// Reference implementation with the multiplications by the Fixpoint filter
+// coefficients, the optimized transforms must be bit-exact to it.
+namespace reference
+{
+const FP<16> h0 = -0.125;
+const FP<16> h1 = 0.25;
+const FP<16> h2 = 0.75;
+const FP<16> h3 = 0.25;
+const FP<16> h4 = -0.125;
+
+const FP<16> g0 = -0.5;
+const FP<16> g1 = 1.0;
+const FP<16> g2 = -0.5;
+
+const FP<16> ip_g0 = 4.0;
+const FP<16> ip_g2 = -3.5;
+const FP<16> ip_g3 = -1.0;
+const FP<16> ip_g4 = 0.5;
+
+// Mallat layout: lowpass of the last level first, then the highpass
+// coefficients from the last to the first level
+void
+forwardTransform(FP<16>* buffer, size_t length, FP<16>* scratch)
+{
+    for (size_t half = length / 2; half >= 2; half /= 2)
+    {
+        for (size_t i = 0; i < half; i++)
+        {
+            const FP<16>& x0 = buffer[(2 * i) % (2 * half)];
+            const FP<16>& x1 = buffer[(2 * i + 1) % (2 * half)];
+            const FP<16>& x2 = buffer[(2 * i + 2) % (2 * half)];
+            const FP<16>& x3 = buffer[(2 * i + 3) % (2 * half)];
+            const FP<16>& x4 = buffer[(2 * i + 4) % (2 * half)];
+            scratch[i] = h0 * x0 + h1 * x1 + h2 * x2 + h3 * x3 + h4 * x4;
+            scratch[i + half] = g0 * x0 + g1 * x1 + g2 * x2;
+        }
+        for (size_t i = 0; i < 2 * half; i++)
+        {
+            buffer[i] = scratch[i];
+        }
+    }
+}
+
+void
+forwardTransformInPlace(FP<16>* buffer, size_t length)
+{
+    for (size_t stride = 1; length / stride >= 4; stride *= 2)
+    {
+        const size_t n = length / stride;
+        const FP<16> lapped[3] = {buffer[0], buffer[stride], buffer[2 * stride]};
+        for (size_t i = 0; i < n; i += 2)
+        {
+            const FP<16> x0 = buffer[i * stride];
+            const FP<16> x1 = buffer[(i + 1) * stride];
+            const FP<16> x2 = (i + 2 < n) ? buffer[(i + 2) * stride] : lapped[i + 2 - n];
+            const FP<16> x3 = (i + 3 < n) ? buffer[(i + 3) * stride] : lapped[i + 3 - n];
+            const FP<16> x4 = (i + 4 < n) ? buffer[(i + 4) * stride] : lapped[i + 4 - n];
+            const FP<16> low = h0 * x0 + h1 * x1 + h2 * x2 + h3 * x3 + h4 * x4;
+            buffer[i * stride] = low;
+            buffer[(i + 1) * stride] = ip_g0 * low + ip_g2 * x2 + ip_g3 * x3 + ip_g4 * x4;
+        }
+    }
+}
+
+uint32_t
+random(uint32_t& state)
+{
+    state = state * 1664525U + 1013904223U;
+    return state;
+}
+}  // namespace reference
+
+TEST_F(TransformTest, forwardTransformIsBitExact)
+{
+    uint32_t state = 1;
+    for (size_t length = 4; length <= maxBufferLength; length *= 2)
+    {
+        for (size_t i = 0; i < length; i++)
+        {
+            // Raw values over the full range including the extremes
+            const uint32_t value = reference::random(state);
+            inputBuffer[i].setValue(static_cast<int32_t>(
+                    (i % 7 == 0) ? ((value & 1) ? 0x7FFFFFFFU : 0x80000000U) : value));
+            inputBufferReference[i] = inputBuffer[i];
+        }
+
+        outpost::compression::LeGall53Wavelet::forwardTransform(inputData.first(length),
+                                                                outputData.first(length));
+        reference::forwardTransform(inputBufferReference, length, intermediateBufferReference);
+
+        for (size_t i = 0; i < length; i++)
+        {
+            ASSERT_EQ(inputBufferReference[i].getValue(), outputBuffer[i].getValue())
+                    << "length " << length << ", index " << i;
+        }
+    }
+}
+
+TEST_F(TransformTest, forwardTransformInPlaceIsBitExact)
+{
+    uint32_t state = 2;
+    for (size_t length = 4; length <= maxBufferLength; length *= 2)
+    {
+        for (size_t i = 0; i < length; i++)
+        {
+            const uint32_t value = reference::random(state);
+            if (length > 1024)
+            {
+                // Samples of a sensor
+                inputBuffer[i] = static_cast<int16_t>(value >> 16);
+            }
+            else
+            {
+                inputBuffer[i].setValue(static_cast<int32_t>(
+                        (i % 5 == 0) ? ((value & 1) ? 0x7FFFFFFFU : 0x80000000U) : value));
+            }
+            inputBufferReference[i] = inputBuffer[i];
+        }
+
+        outpost::compression::LeGall53Wavelet::forwardTransformInPlace(inputData.first(length));
+        reference::forwardTransformInPlace(inputBufferReference, length);
+
+        for (size_t i = 0; i < length; i++)
+        {
+            ASSERT_EQ(inputBufferReference[i].getValue(), inputBuffer[i].getValue())
+                    << "length " << length << ", index " << i;
+        }
+    }
+}
+
+int16_t
+roundAndSaturate(double value)
+{
+    const double rounded = floor(value + 0.5);
+    if (rounded > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    else if (rounded < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+    return static_cast<int16_t>(rounded);
+}
+
+TEST_F(TransformTest, integerBackwardTransformEqualsFloatingPoint)
+{
+    int16_t coefficients[maxBufferLength];
+    int32_t tempBuffer[maxBufferLength];
+    int16_t samples[maxBufferLength];
+
+    uint32_t state = 3;
+    for (size_t length = 4; length <= maxBufferLength; length *= 2)
+    {
+        for (size_t i = 0; i < length; i++)
+        {
+            // Large coefficients to also cover saturated samples
+            coefficients[i] = static_cast<int16_t>(
+                    static_cast<int32_t>(reference::random(state) >> 20) - 2048);
+            coefficients[i] *= (i < 2) ? 16 : 2;
+            doubleBuffer[i] = coefficients[i];
+        }
+
+        outpost::compression::LeGall53Wavelet::backwardTransform(
+                outpost::Slice<const int16_t>::unsafe(coefficients, length),
+                outpost::Slice<int32_t>(tempBuffer),
+                outpost::Slice<int16_t>(samples));
+        outpost::compression::LeGall53Wavelet::backwardTransform(doubleSlice.first(length),
+                                                                 outSlice.first(length));
+
+        for (size_t i = 0; i < length; i++)
+        {
+            ASSERT_EQ(roundAndSaturate(outBuffer[i]), samples[i])
+                    << "length " << length << ", index " << i;
+        }
+    }
+}
+
+TEST_F(TransformTest, integerBackwardTransformReconstructsSamples)
+{
+    int32_t tempBuffer[maxBufferLength];
+    int16_t samples[maxBufferLength];
+
+    uint32_t state = 4;
+    int16_t value = 0;
+    for (size_t i = 0; i < maxBufferLength; i++)
+    {
+        // Random walk over the full range of a 16 bit sensor
+        value = static_cast<int16_t>(value + static_cast<int8_t>(reference::random(state) >> 24));
+        inputBuffer[i] = value;
+        inputReference[i] = value;
+    }
+
+    outpost::compression::LeGall53Wavelet::forwardTransformInPlace(inputData);
+    outpost::Slice<int16_t> coefficients =
+            outpost::compression::LeGall53Wavelet::reorder(inputData);
+    for (size_t i = 0; i < maxBufferLength; i++)
+    {
+        doubleBuffer[i] = coefficients[i];
+    }
+
+    outpost::compression::LeGall53Wavelet::backwardTransform(
+            coefficients, outpost::Slice<int32_t>(tempBuffer), outpost::Slice<int16_t>(samples));
+    outpost::compression::LeGall53Wavelet::backwardTransform(doubleSlice, outSlice);
+
+    for (size_t i = 0; i < maxBufferLength; i++)
+    {
+        EXPECT_EQ(roundAndSaturate(outBuffer[i]), samples[i]);
+        EXPECT_NEAR(static_cast<int16_t>(inputReference[i]), samples[i], 2);
+    }
+}
+
+TEST_F(TransformTest, integerBackwardTransformOfShortBlock)
+{
+    const int16_t coefficients[2] = {-5, 7};
+    int32_t tempBuffer[2];
+    int16_t samples[2];
+
+    outpost::compression::LeGall53Wavelet::backwardTransform(
+            outpost::Slice<const int16_t>(coefficients),
+            outpost::Slice<int32_t>(tempBuffer),
+            outpost::Slice<int16_t>(samples));
+
+    EXPECT_THAT(samples, ElementsAreArray(coefficients));
+}
+
 }  // namespace transform_test
@@ -259,8 +259,11 @@ ProtocolDispatcher<protocolType, numberOfQueues>::insertIntoQueue(
 {
     bool inserted = false;
 
+    // Packages larger than the buffers of the pool are truncated
+    const size_t size = outpost::utils::min<size_t>(
+            readBytes, package.getNumberOfElements(), listener.mPool->getElementSize());
     outpost::utils::SharedBufferPointer sharedBuffer;
-    if (listener.mPool->allocate(sharedBuffer))
+    if (listener.mPool->allocate(sharedBuffer, size))
     {
         uint32_t effectiveSize = outpost::utils::min<uint32_t>(
                 readBytes, sharedBuffer.getLength(), package.getNumberOfElements());
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// Publishing of large messages to subscribers which keep the latest
+// message.
+//
+// With a Topic every subscriber copies the message into its own storage.
+// With a LoanedTopic the message is constructed in a buffer from a pool
+// and the subscribers only keep a reference to that buffer.
+
+#include <outpost/smpc/loaned_topic.h>
+#include <outpost/smpc/subscription.h>
+#include <outpost/smpc/topic.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+
+using namespace outpost::smpc;
+using outpost::utils::ConstSharedBufferPointer;
+
+namespace
+{
+constexpr size_t numberOfSubscribers = 4;
+constexpr uint32_t bytesPerRun = 1024 * 1024 * 1024;
+
+template <size_t Size>
+struct Payload
+{
+    uint32_t sequence;
+    uint8_t data[Size - sizeof(uint32_t)];
+};
+
+template <size_t Size>
+class CopyingSubscriber : public Subscriber
+{
+public:
+    CopyingSubscriber() : mLatest()
+    {
+    }
+
+    void
+    onReceive(const Payload<Size>* message)
+    {
+        memcpy(&mLatest, message, sizeof(mLatest));
+    }
+
+    Payload<Size> mLatest;
+};
+
+template <size_t Size>
+class SharingSubscriber : public Subscriber
+{
+public:
+    void
+    onReceive(const ConstSharedBufferPointer* message)
+    {
+        mLatest = *message;
+    }
+
+    ConstSharedBufferPointer mLatest;
+};
+
+template <size_t Size>
+double
+measureCopy(uint32_t numberOfMessages)
+{
+    Topic<const Payload<Size>> topic;
+    static CopyingSubscriber<Size> subscribers[numberOfSubscribers];
+    Subscription* subscriptions[numberOfSubscribers];
+    for (size_t i = 0; i < numberOfSubscribers; i++)
+    {
+        subscriptions[i] =
+                new Subscription(topic, &subscribers[i], &CopyingSubscriber<Size>::onReceive);
+        subscriptions[i]->connect();
+    }
+
+    static Payload<Size> message;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < numberOfMessages; i++)
+    {
+        message.sequence = i;
+        topic.publish(message);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < numberOfSubscribers; i++)
+    {
+        if (subscribers[i].mLatest.sequence != numberOfMessages - 1)
+        {
+            printf("Error: message lost\n");
+        }
+        delete subscriptions[i];
+    }
+    return std::chrono::duration<double>(end - start).count();
+}
+
+template <size_t Size>
+double
+measureLoan(uint32_t numberOfMessages)
+{
+    // Every subscriber keeps one message, one more is lent to the publisher
+    static outpost::utils::SharedBufferPool<Size, numberOfSubscribers + 2, alignof(uint32_t)>
+            pool;
+    LoanedTopic<Payload<Size>> topic(pool);
+    SharingSubscriber<Size> subscribers[numberOfSubscribers];
+    Subscription* subscriptions[numberOfSubscribers];
+    for (size_t i = 0; i < numberOfSubscribers; i++)
+    {
+        subscriptions[i] =
+                new Subscription(topic, &subscribers[i], &SharingSubscriber<Size>::onReceive);
+        subscriptions[i]->connect();
+    }
+
+    typename LoanedTopic<Payload<Size>>::Loan loan;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < numberOfMessages; i++)
+    {
+        if (!topic.loan(loan))
+        {
+            printf("Error: pool exhausted\n");
+            break;
+        }
+        loan->sequence = i;
+        topic.publish(loan);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < numberOfSubscribers; i++)
+    {
+        if (LoanedTopic<Payload<Size>>::getMessage(subscribers[i].mLatest).sequence
+            != numberOfMessages - 1)
+        {
+            printf("Error: message lost\n");
+        }
+        delete subscriptions[i];
+    }
+    return std::chrono::duration<double>(end - start).count();
+}
+
+template <size_t Size>
+void
+compare()
+{
+    const uint32_t numberOfMessages = bytesPerRun / Size;
+    const double copy = measureCopy<Size>(numberOfMessages);
+    const double loan = measureLoan<Size>(numberOfMessages);
+    printf("%5u bytes: copy %10.0f, loan %10.0f messages/s\n",
+           static_cast<unsigned int>(Size),
+           numberOfMessages / copy,
+           numberOfMessages / loan);
+}
+}  // namespace
+
+int
+main(void)
+{
+    printf("Publishing to %u subscribers which keep the latest message\n",
+           static_cast<unsigned int>(numberOfSubscribers));
+
+    compare<4 * 1024>();
+    compare<64 * 1024>();
+
+    return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_SMPC_LOANED_TOPIC_H
+#define OUTPOST_SMPC_LOANED_TOPIC_H
+
+#include "topic.h"
+
+#include <outpost/utils/container/shared_buffer.h>
+#include <outpost/utils/container/shared_object_pool.h>
+
+#include <stdint.h>
+
+#include <new>
+#include <type_traits>
+
+namespace outpost
+{
+namespace smpc
+{
+/**
+ * %Topic for large messages which are passed without a copy.
+ *
+ * With a normal Topic every subscriber that wants to keep a message
+ * beyond its callback has to copy it. A LoanedTopic instead lends a
+ * buffer from a SharedBufferPool to the publisher. The publisher
+ * constructs the message in place and publishes a reference counted
+ * ConstSharedBufferPointer. A subscriber keeps the message by keeping a
+ * copy of that pointer, the buffer returns to the pool when the last
+ * copy is destroyed.
+ *
+ * Subscriptions are created as for every other topic, the bound member
+ * function receives the pointer:
+ *
+ * \code
+ * void
+ * Component::onImage(const outpost::utils::ConstSharedBufferPointer* message)
+ * {
+ *     const Image& image = LoanedTopic<Image>::getMessage(*message);
+ *     ...
+ *     mLastImage = *message;  // keep the image, no copy of the data
+ * }
+ *
+ * Subscription subscription(imageTopic, this, &Component::onImage);
+ * \endcode
+ *
+ * The message is only constructed, never destroyed, so T must be
+ * trivially destructible. The elements of the pool must be large enough
+ * and aligned for T.
+ *
+ * \ingroup smpc
+ * \see     Topic
+ * \param T Type of the message
+ */
+template <typename T>
+class LoanedTopic : public Topic<const outpost::utils::ConstSharedBufferPointer>
+{
+public:
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "Messages are returned to the pool without calling their destructor");
+
+    /**
+     * Buffer lent to the publisher, holds a message under construction.
+     */
+    class Loan
+    {
+    public:
+        Loan() : mBuffer(), mMessage(nullptr)
+        {
+        }
+
+        // disable copy constructor
+        Loan(const Loan&) = delete;
+
+        // disable copy-assignment operator
+        Loan&
+        operator=(const Loan&) = delete;
+
+        inline bool
+        isValid() const
+        {
+            return mMessage != nullptr;
+        }
+
+        inline T&
+        operator*() const
+        {
+            return *mMessage;
+        }
+
+        inline T*
+        operator->() const
+        {
+            return mMessage;
+        }
+
+        /**
+         * Give the buffer back to the pool without publishing it.
+         */
+        inline void
+        release()
+        {
+            mBuffer = outpost::utils::SharedBufferPointer();
+            mMessage = nullptr;
+        }
+
+    private:
+        friend class LoanedTopic;
+
+        outpost::utils::SharedBufferPointer mBuffer;
+        T* mMessage;
+    };
+
+    /**
+     * Constructor.
+     *
+     * \param pool
+     *      Pool from which the messages are lent. May be shared with other
+     *      users.
+     */
+    explicit LoanedTopic(outpost::utils::SharedBufferPoolBase& pool) : mPool(pool)
+    {
+    }
+
+    ~LoanedTopic() = default;
+
+    // disable copy constructor
+    LoanedTopic(const LoanedTopic&) = delete;
+
+    // disable assignment operator
+    LoanedTopic&
+    operator=(const LoanedTopic&) = delete;
+
+    /**
+     * Lend a buffer and default-construct a message in it.
+     *
+     * The message is not value-initialized, for plain structures the
+     * buffer still holds the data of an earlier message. Clearing it
+     * would cost as much as the copy this topic avoids.
+     *
+     * \return
+     *      False if the pool is exhausted or a buffer is too small or
+     *      misaligned for T.
+     */
+    bool
+    loan(Loan& loan)
+    {
+        loan.release();
+        outpost::utils::SharedBufferPointer buffer;
+        if (!mPool.allocate(buffer, sizeof(T)))
+        {
+            return false;
+        }
+
+        uint8_t* memory = buffer;
+        if ((memory == nullptr)
+            || ((reinterpret_cast<uintptr_t>(memory) % alignof(T)) != 0))
+        {
+            return false;
+        }
+
+        loan.mMessage = new (memory) T;
+        loan.mBuffer = buffer;
+        return true;
+    }
+
+    /**
+     * Publish a lent message to all subscribers.
+     *
+     * The loan is invalid afterwards, the message must not be modified
+     * anymore. Invalid loans are not published. This function is thread
+     * safe.
+     */
+    void
+    publish(Loan& loan) const
+    {
+        if (!loan.isValid())
+        {
+            return;
+        }
+        outpost::utils::ConstSharedBufferPointer message(loan.mBuffer);
+        loan.release();
+        Topic<const outpost::utils::ConstSharedBufferPointer>::publish(message);
+    }
+
+    using Topic<const outpost::utils::ConstSharedBufferPointer>::publish;
+
+    /**
+     * Access the message in a buffer published by a LoanedTopic<T>.
+     */
+    static inline const T&
+    getMessage(const outpost::utils::ConstSharedBufferPointer& buffer)
+    {
+        return *reinterpret_cast<const T*>(static_cast<const uint8_t*>(buffer));
+    }
+
+private:
+    outpost::utils::SharedBufferPoolBase& mPool;
+};
+
+}  // namespace smpc
+}  // namespace outpost
+
+#endif
@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_SMPC_QUEUED_SUBSCRIPTION_H
+#define OUTPOST_SMPC_QUEUED_SUBSCRIPTION_H
+
+#include "subscriber.h"
+#include "subscription.h"
+#include "topic.h"
+
+#include <outpost/base/slice.h>
+#include <outpost/rtos/mutex.h>
+#include <outpost/rtos/mutex_guard.h>
+#include <outpost/rtos/semaphore.h>
+#include <outpost/time/duration.h>
+#include <outpost/utils/functor.h>
+#include <outpost/utils/statistics_counter.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+namespace outpost
+{
+namespace smpc
+{
+/**
+ * Behavior of a QueuedSubscription if a message is published while its
+ * queue is full.
+ *
+ * \ingroup smpc
+ */
+enum class OverflowPolicy
+{
+    /// Replace the oldest queued message with the new one
+    dropOldest,
+
+    /// Discard the new message
+    dropNewest,
+
+    /// Let the publisher wait for space, discard the new message if the
+    /// wait times out
+    block
+};
+
+/**
+ * Subscription with deferred delivery.
+ *
+ * A normal Subscription calls the subscriber in the thread of the
+ * publisher, one slow subscriber therefore delays the publisher and all
+ * following subscribers of the topic. A QueuedSubscription only copies
+ * the message into a bounded queue when it is published. The subscriber
+ * takes the messages from the queue in its own thread, either with
+ * receive() or with dispatch(), which calls the bound member function.
+ *
+ * Publishing to a topic with only queued subscriptions costs one copy
+ * per subscription and never waits, unless OverflowPolicy::block is
+ * used. Queued and normal subscriptions can be mixed on the same topic.
+ *
+ * Messages that are discarded because of a full queue are counted per
+ * subscription.
+ *
+ * As for Subscription, the queued subscriptions are connected to their
+ * topics by Subscription::connectSubscriptionsToTopics().
+ *
+ * \ingroup smpc
+ * \see     Subscription
+ * \param T Type of the topic, must be copy-assignable
+ */
+template <typename T>
+class QueuedSubscriptionBase : public Subscriber
+{
+public:
+    typedef typename Topic<T>::NonConstType NonConstType;
+
+    template <typename S>
+    struct SubscriberFunction
+    {
+        typedef void (S::*Type)(typename Topic<T>::Type* message);
+    };
+
+    /**
+     * Subscribe without a member function, messages are taken with receive().
+     *
+     * \param topic
+     *      Topic to subscribe to
+     * \param queue
+     *      Storage for the queued messages
+     * \param policy
+     *      Behavior if the queue is full
+     * \param blockTimeout
+     *      Maximum time the publisher waits for space with OverflowPolicy::block
+     */
+    QueuedSubscriptionBase(Topic<T>& topic,
+                           outpost::Slice<NonConstType> queue,
+                           OverflowPolicy policy,
+                           outpost::time::Duration blockTimeout);
+
+    /**
+     * Subscribe with a member function which is called by dispatch().
+     *
+     * \param subscriber
+     *      Subscribing class. Must be a subclass of outpost::smpc::Subscriber.
+     * \param function
+     *      Member function pointer of the subscribing class.
+     */
+    template <typename S>
+    QueuedSubscriptionBase(Topic<T>& topic,
+                           outpost::Slice<NonConstType> queue,
+                           S* subscriber,
+                           typename SubscriberFunction<S>::Type function,
+                           OverflowPolicy policy,
+                           outpost::time::Duration blockTimeout);
+
+    virtual ~QueuedSubscriptionBase() = default;
+
+    /**
+     * Take the oldest queued message.
+     *
+     * \param message
+     *      Receives a copy of the message
+     * \param timeout
+     *      Time to wait for a message if the queue is empty
+     * \return
+     *      True if a message was received, false on timeout.
+     */
+    bool
+    receive(NonConstType& message,
+            outpost::time::Duration timeout = outpost::time::Duration::zero());
+
+    /**
+     * Take the oldest queued message and pass it to the bound member
+     * function. Must only be called by a single thread.
+     *
+     * \param timeout
+     *      Time to wait for a message if the queue is empty
+     * \return
+     *      True if a message was delivered, false on timeout or if no
+     *      member function is bound.
+     */
+    bool
+    dispatch(outpost::time::Duration timeout = outpost::time::Duration::zero());
+
+    /**
+     * Number of messages discarded because the queue was full.
+     */
+    inline uint32_t
+    getNumberOfDroppedMessages() const
+    {
+        return mNumberOfDroppedMessages.get();
+    }
+
+    /**
+     * Number of messages waiting in the queue.
+     */
+    size_t
+    getNumberOfQueuedMessages() const;
+
+    inline OverflowPolicy
+    getOverflowPolicy() const
+    {
+        return mPolicy;
+    }
+
+private:
+    // disable copy constructor
+    QueuedSubscriptionBase(const QueuedSubscriptionBase&);
+
+    // disable copy-assignment operator
+    QueuedSubscriptionBase&
+    operator=(const QueuedSubscriptionBase&);
+
+    typedef void (Subscriber::*Function)(void*);
+
+    /// Called in the thread of the publisher
+    void
+    enqueue(typename Topic<T>::Type* message);
+
+    outpost::Slice<NonConstType> mQueue;
+    const OverflowPolicy mPolicy;
+    const outpost::time::Duration mBlockTimeout;
+
+    mutable outpost::rtos::Mutex mMutex;
+    outpost::rtos::Semaphore mNumberOfMessages;
+    outpost::rtos::Semaphore mNumberOfFreeSlots;
+    size_t mReadIndex;
+    size_t mItemsInQueue;
+
+    outpost::utils::StatisticsCounter mNumberOfDroppedMessages;
+
+    const Functor<void(void*)> mFunctor;
+
+    /// Copy of the message passed to the member function by dispatch()
+    NonConstType mCurrent;
+
+    Subscription mSubscription;
+};
+
+template <typename T, size_t N>
+class QueuedSubscriptionStorage
+{
+protected:
+    std::array<typename Topic<T>::NonConstType, N> mQueueStorage;
+};
+
+/**
+ * QueuedSubscription with internal storage.
+ *
+ * \ingroup smpc
+ * \param T Type of the topic
+ * \param N Maximum number of queued messages
+ */
+template <typename T, size_t N>
+class QueuedSubscription : private QueuedSubscriptionStorage<T, N>,
+                           public QueuedSubscriptionBase<T>
+{
+    using Storage = QueuedSubscriptionStorage<T, N>;
+
+public:
+    static_assert(N > 0, "Queue must hold at least one message");
+
+    explicit QueuedSubscription(
+            Topic<T>& topic,
+            OverflowPolicy policy = OverflowPolicy::dropOldest,
+            outpost::time::Duration blockTimeout = outpost::time::Duration::myriad()) :
+        Storage(),
+        QueuedSubscriptionBase<T>(
+                topic, outpost::asSlice(Storage::mQueueStorage), policy, blockTimeout)
+    {
+    }
+
+    template <typename S>
+    QueuedSubscription(
+            Topic<T>& topic,
+            S* subscriber,
+            typename QueuedSubscriptionBase<T>::template SubscriberFunction<S>::Type function,
+            OverflowPolicy policy = OverflowPolicy::dropOldest,
+            outpost::time::Duration blockTimeout = outpost::time::Duration::myriad()) :
+        Storage(),
+        QueuedSubscriptionBase<T>(topic,
+                                  outpost::asSlice(Storage::mQueueStorage),
+                                  subscriber,
+                                  function,
+                                  policy,
+                                  blockTimeout)
+    {
+    }
+
+    virtual ~QueuedSubscription() = default;
+};
+
+}  // namespace smpc
+}  // namespace outpost
+
+#include "queued_subscription_impl.h"
+
+#endif
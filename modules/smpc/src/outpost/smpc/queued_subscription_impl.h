@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_SMPC_QUEUED_SUBSCRIPTION_IMPL_H
+#define OUTPOST_SMPC_QUEUED_SUBSCRIPTION_IMPL_H
+
+#include "queued_subscription.h"
+
+namespace outpost
+{
+namespace smpc
+{
+template <typename T>
+QueuedSubscriptionBase<T>::QueuedSubscriptionBase(Topic<T>& topic,
+                                                  outpost::Slice<NonConstType> queue,
+                                                  OverflowPolicy policy,
+                                                  outpost::time::Duration blockTimeout) :
+    mQueue(queue),
+    mPolicy(policy),
+    mBlockTimeout(blockTimeout),
+    mNumberOfMessages(0),
+    mNumberOfFreeSlots(
+            (policy == OverflowPolicy::block) ? static_cast<uint32_t>(queue.getNumberOfElements())
+                                              : 0U),
+    mReadIndex(0),
+    mItemsInQueue(0),
+    mFunctor(),
+    mCurrent(),
+    mSubscription(topic, this, &QueuedSubscriptionBase::enqueue)
+{
+}
+
+template <typename T>
+template <typename S>
+QueuedSubscriptionBase<T>::QueuedSubscriptionBase(Topic<T>& topic,
+                                                  outpost::Slice<NonConstType> queue,
+                                                  S* subscriber,
+                                                  typename SubscriberFunction<S>::Type function,
+                                                  OverflowPolicy policy,
+                                                  outpost::time::Duration blockTimeout) :
+    mQueue(queue),
+    mPolicy(policy),
+    mBlockTimeout(blockTimeout),
+    mNumberOfMessages(0),
+    mNumberOfFreeSlots(
+            (policy == OverflowPolicy::block) ? static_cast<uint32_t>(queue.getNumberOfElements())
+                                              : 0U),
+    mReadIndex(0),
+    mItemsInQueue(0),
+    mFunctor(*reinterpret_cast<Subscriber*>(subscriber), reinterpret_cast<Function>(function)),
+    mCurrent(),
+    mSubscription(topic, this, &QueuedSubscriptionBase::enqueue)
+{
+}
+
+template <typename T>
+void
+QueuedSubscriptionBase<T>::enqueue(typename Topic<T>::Type* message)
+{
+    if ((mPolicy == OverflowPolicy::block) && !mNumberOfFreeSlots.acquire(mBlockTimeout))
+    {
+        mNumberOfDroppedMessages.increment();
+        return;
+    }
+
+    const size_t size = mQueue.getNumberOfElements();
+    {
+        outpost::rtos::MutexGuard lock(mMutex);
+        if (mItemsInQueue == size)
+        {
+            // Only reached with the drop policies, a free slot has been
+            // reserved for OverflowPolicy::block.
+            mNumberOfDroppedMessages.increment();
+            if (mPolicy == OverflowPolicy::dropNewest)
+            {
+                return;
+            }
+            // The number of queued messages stays the same
+            mQueue[mReadIndex] = *message;
+            mReadIndex = (mReadIndex + 1) % size;
+            return;
+        }
+        mQueue[(mReadIndex + mItemsInQueue) % size] = *message;
+        mItemsInQueue++;
+    }
+    mNumberOfMessages.release();
+}
+
+template <typename T>
+bool
+QueuedSubscriptionBase<T>::receive(NonConstType& message, outpost::time::Duration timeout)
+{
+    if (!mNumberOfMessages.acquire(timeout))
+    {
+        return false;
+    }
+    {
+        outpost::rtos::MutexGuard lock(mMutex);
+        message = mQueue[mReadIndex];
+        mReadIndex = (mReadIndex + 1) % mQueue.getNumberOfElements();
+        mItemsInQueue--;
+    }
+    if (mPolicy == OverflowPolicy::block)
+    {
+        mNumberOfFreeSlots.release();
+    }
+    return true;
+}
+
+template <typename T>
+bool
+QueuedSubscriptionBase<T>::dispatch(outpost::time::Duration timeout)
+{
+    if (mFunctor.isEmpty() || !receive(mCurrent, timeout))
+    {
+        return false;
+    }
+    outpost::utils::OperationResult result = outpost::utils::OperationResult::invalid;
+    mFunctor.execute(result, reinterpret_cast<void*>(&mCurrent));
+    return true;
+}
+
+template <typename T>
+size_t
+QueuedSubscriptionBase<T>::getNumberOfQueuedMessages() const
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    return mItemsInQueue;
+}
+
+}  // namespace smpc
+}  // namespace outpost
+
+#endif
@@ -17,11 +17,8 @@ outpost::smpc::Subscription* outpost::smpc::Subscription::listOfAllSubscriptions
 
 outpost::smpc::Subscription::~Subscription()
 {
+    disconnect();
     removeFromList(&Subscription::listOfAllSubscriptions, this);
-
-    // TODO
-    releaseAllSubscriptions();
-    connectSubscriptionsToTopics();
 }
 
 void
@@ -32,18 +29,24 @@ outpost::smpc::Subscription::connectSubscriptionsToTopics()
 
     for (Subscription* it = Subscription::listOfAllSubscriptions; it != 0; it = it->getNext())
     {
-        it->mNextTopicSubscription = it->mTopic->mSubscriptions;
-        it->mTopic->mSubscriptions = it;
+        it->connect();
     }
 }
 
+bool
+outpost::smpc::Subscription::connect()
+{
+    return mTopic->mSubscriptions.prepend(*this);
+}
+
+bool
+outpost::smpc::Subscription::disconnect()
+{
+    return mTopic->mSubscriptions.remove(*this);
+}
+
 void
 outpost::smpc::Subscription::releaseAllSubscriptions()
 {
-    for (Subscription* it = Subscription::listOfAllSubscriptions; it != 0; it = it->getNext())
-    {
-        it->mNextTopicSubscription = 0;
-    }
-
     TopicBase::clearSubscriptions();
 }
@@ -46,6 +46,7 @@ public:
     friend class TestingTopicBase;  // for unit tests
     friend class SubscriptionRaw;
     friend class ImplicitList<Subscription>;
+    friend class SubscriptionList<Subscription>;
 
     template <typename T, typename S>
     struct SubscriberFunction
@@ -71,6 +72,8 @@ public:
     /**
      * Destroy the subscription
      *
+     * Disconnects the subscription from its topic first, see disconnect().
+     *
      * \warning
      *     The destruction and creation of subscriptions during the normal
      *     runtime is not thread-safe. If topics need to be
@@ -92,6 +95,41 @@ public:
     static void
     connectSubscriptionsToTopics();
 
+    /**
+     * Connect this subscription to its topic.
+     *
+     * Thread-safe, also while other threads publish to the topic. The
+     * subscription receives all messages published after this
+     * function returns. Takes O(n) with n subscriptions of the topic.
+     *
+     * \return
+     *      False if the subscription was already connected.
+     */
+    bool
+    connect();
+
+    /**
+     * Disconnect this subscription from its topic.
+     *
+     * Thread-safe, also while other threads publish to the topic. Waits
+     * until all running publish calls of the topic have left the
+     * subscription, afterwards the subscriber is not called anymore.
+     *
+     * The calling thread sleeps until the publish calls have finished.
+     * Publishers preempted inside publish() continue meanwhile even with
+     * a lower priority, but a publisher which is never scheduled (e.g.
+     * suspended) delays the return indefinitely.
+     *
+     * \warning
+     *      Must not be called from a subscriber of the same topic, this
+     *      would never return.
+     *
+     * \return
+     *      False if the subscription was not connected.
+     */
+    bool
+    disconnect();
+
     /**
      * Release all subscriptions.
      *
@@ -135,7 +173,7 @@ private:
      * subscriptions to their corresponding topics.
      */
     TopicBase* const mTopic;
-    Subscription* mNextTopicSubscription;
+    SubscriptionList<Subscription>::Link mNextTopicSubscription;
 
     /**
      * Base-type to cast all member function pointers to. The correct type
@@ -160,7 +198,7 @@ outpost::smpc::Subscription::Subscription(Topic<T>& topic,
                                           typename SubscriberFunction<T, S>::Type function) :
     ImplicitList<Subscription>(listOfAllSubscriptions, this),
     mTopic(&topic),
-    mNextTopicSubscription(0),
+    mNextTopicSubscription(nullptr),
     mFunctor(*reinterpret_cast<Subscriber*>(subscriber), reinterpret_cast<Function>(function))
 {
 }
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_SMPC_SUBSCRIPTION_LIST_H
+#define OUTPOST_SMPC_SUBSCRIPTION_LIST_H
+
+#include <outpost/rtos/mutex.h>
+#include <outpost/rtos/mutex_guard.h>
+#include <outpost/rtos/thread.h>
+#include <outpost/utils/atomic_support.h>
+
+#include <stdint.h>
+
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+#include <atomic>
+#endif
+
+namespace outpost
+{
+namespace smpc
+{
+/**
+ * List of the subscriptions of a topic.
+ *
+ * Publishing only reads the list and does not take a lock. Changes are
+ * serialized by a mutex and follow the read-copy-update scheme: a
+ * subscription is linked in with a single atomic store of a pointer, so
+ * a publisher sees either the old or the new list. A removed
+ * subscription keeps its link to the rest of the list, remove() returns
+ * only after all publishers which might still see it have left the list
+ * (grace period). Afterwards the subscription can be destroyed.
+ *
+ * Publishers announce themselves with a ReadGuard in one of two
+ * counters. remove() switches new publishers to the other counter and
+ * waits until the previous counter drops to zero.
+ *
+ * Targets without lock-free atomic operations take the mutex for
+ * publishing as well (see OUTPOST_UTILS_LOCK_FREE_ATOMICS).
+ *
+ * \param S
+ *      Type of the subscription. Needs a member
+ *      `SubscriptionList<S>::Link mNextTopicSubscription` and must
+ *      declare SubscriptionList<S> as friend.
+ */
+template <typename S>
+class SubscriptionList
+{
+public:
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+    typedef std::atomic<S*> Link;
+#else
+    typedef S* Link;
+#endif
+
+    /**
+     * Read access for a publisher, the list must only be iterated while
+     * the guard exists.
+     */
+    class ReadGuard
+    {
+    public:
+        explicit ReadGuard(const SubscriptionList& list);
+
+        ~ReadGuard();
+
+        inline S*
+        getFirst() const
+        {
+            return load(mList.mFirst);
+        }
+
+    private:
+        // disable copy constructor
+        ReadGuard(const ReadGuard&);
+
+        // disable copy-assignment operator
+        ReadGuard&
+        operator=(const ReadGuard&);
+
+        const SubscriptionList& mList;
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+        uint32_t mEpoch;
+#endif
+    };
+
+    SubscriptionList();
+
+    // disable copy constructor
+    SubscriptionList(const SubscriptionList&) = delete;
+
+    // disable copy-assignment operator
+    SubscriptionList&
+    operator=(const SubscriptionList&) = delete;
+
+    /**
+     * Add a subscription to the front of the list.
+     *
+     * \return False if the subscription is already part of the list.
+     */
+    bool
+    prepend(S& subscription);
+
+    /**
+     * Remove a subscription and wait until no publisher uses it anymore.
+     *
+     * Polls the publishers once per millisecond (at least one tick) while
+     * holding the mutex of the list, publishers of any priority can leave
+     * the list meanwhile.
+     *
+     * \warning
+     *      Must not be called from a subscriber of the same topic, the
+     *      grace period would never end.
+     *
+     * \return False if the subscription is not part of the list.
+     */
+    bool
+    remove(S& subscription);
+
+    /**
+     * Remove all subscriptions without waiting for publishers.
+     *
+     * \warning
+     *      Only for the tear down of a program, not thread-safe.
+     */
+    void
+    clear();
+
+    static inline S*
+    getNext(const S& subscription)
+    {
+        return load(subscription.mNextTopicSubscription);
+    }
+
+private:
+    static inline S*
+    load(const Link& link)
+    {
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+        return link.load(std::memory_order_acquire);
+#else
+        return link;
+#endif
+    }
+
+    static inline void
+    store(Link& link, S* subscription)
+    {
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+        link.store(subscription, std::memory_order_release);
+#else
+        link = subscription;
+#endif
+    }
+
+    /// Serializes changes, on targets without atomics also publishing
+    mutable outpost::rtos::Mutex mMutex;
+
+    Link mFirst;
+
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+    void
+    waitForReaders();
+
+    mutable std::atomic<uint32_t> mEpoch;
+    mutable std::atomic<uint32_t> mReaders[2];
+#endif
+};
+
+}  // namespace smpc
+}  // namespace outpost
+
+#include "subscription_list_impl.h"
+
+#endif
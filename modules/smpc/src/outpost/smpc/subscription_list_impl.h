@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_SMPC_SUBSCRIPTION_LIST_IMPL_H
+#define OUTPOST_SMPC_SUBSCRIPTION_LIST_IMPL_H
+
+#include "subscription_list.h"
+
+namespace outpost
+{
+namespace smpc
+{
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+template <typename S>
+SubscriptionList<S>::ReadGuard::ReadGuard(const SubscriptionList& list) : mList(list), mEpoch(0)
+{
+    while (true)
+    {
+        mEpoch = mList.mEpoch.load(std::memory_order_seq_cst);
+        mList.mReaders[mEpoch].fetch_add(1, std::memory_order_seq_cst);
+
+        // Either remove() sees this reader in the counter or the reader
+        // sees the new epoch and retries with the other counter.
+        if (mList.mEpoch.load(std::memory_order_seq_cst) == mEpoch)
+        {
+            break;
+        }
+        mList.mReaders[mEpoch].fetch_sub(1, std::memory_order_release);
+    }
+}
+
+template <typename S>
+SubscriptionList<S>::ReadGuard::~ReadGuard()
+{
+    mList.mReaders[mEpoch].fetch_sub(1, std::memory_order_release);
+}
+
+template <typename S>
+SubscriptionList<S>::SubscriptionList() : mFirst(nullptr), mEpoch(0)
+{
+    mReaders[0].store(0, std::memory_order_relaxed);
+    mReaders[1].store(0, std::memory_order_relaxed);
+}
+
+template <typename S>
+void
+SubscriptionList<S>::waitForReaders()
+{
+    const uint32_t previous = mEpoch.load(std::memory_order_relaxed);
+    mEpoch.store(previous ^ 1U, std::memory_order_seq_cst);
+    while (mReaders[previous].load(std::memory_order_seq_cst) != 0)
+    {
+        // Sleep instead of yielding: a publisher of lower priority has to
+        // run to leave the list, yield() only gives way to equal priorities
+        outpost::rtos::Thread::sleep(outpost::time::Milliseconds(1));
+    }
+}
+#else
+template <typename S>
+SubscriptionList<S>::ReadGuard::ReadGuard(const SubscriptionList& list) : mList(list)
+{
+    mList.mMutex.acquire();
+}
+
+template <typename S>
+SubscriptionList<S>::ReadGuard::~ReadGuard()
+{
+    mList.mMutex.release();
+}
+
+template <typename S>
+SubscriptionList<S>::SubscriptionList() : mFirst(nullptr)
+{
+}
+#endif
+
+template <typename S>
+bool
+SubscriptionList<S>::prepend(S& subscription)
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    for (S* it = load(mFirst); it != nullptr; it = getNext(*it))
+    {
+        if (it == &subscription)
+        {
+            return false;
+        }
+    }
+
+    // Publishers only see the subscription after its link is complete
+    store(subscription.mNextTopicSubscription, load(mFirst));
+    store(mFirst, &subscription);
+    return true;
+}
+
+template <typename S>
+bool
+SubscriptionList<S>::remove(S& subscription)
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    Link* previous = &mFirst;
+    S* it = load(mFirst);
+    while ((it != nullptr) && (it != &subscription))
+    {
+        previous = &it->mNextTopicSubscription;
+        it = load(*previous);
+    }
+    if (it == nullptr)
+    {
+        return false;
+    }
+
+    // Publishers which are currently at the subscription can still follow
+    // its link to the rest of the list.
+    store(*previous, getNext(subscription));
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+    waitForReaders();
+#endif
+    store(subscription.mNextTopicSubscription, nullptr);
+    return true;
+}
+
+template <typename S>
+void
+SubscriptionList<S>::clear()
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    S* it = load(mFirst);
+    store(mFirst, nullptr);
+    while (it != nullptr)
+    {
+        S* next = getNext(*it);
+        store(it->mNextTopicSubscription, nullptr);
+        it = next;
+    }
+}
+
+}  // namespace smpc
+}  // namespace outpost
+
+#endif
@@ -17,10 +17,8 @@ outpost::smpc::SubscriptionRaw* outpost::smpc::SubscriptionRaw::listOfAllSubscri
 
 outpost::smpc::SubscriptionRaw::~SubscriptionRaw()
 {
+    disconnect();
     removeFromList(&SubscriptionRaw::listOfAllSubscriptions, this);
-
-    releaseAllSubscriptions();
-    connectSubscriptionsToTopics();
 }
 
 void
@@ -30,18 +28,24 @@ outpost::smpc::SubscriptionRaw::connectSubscriptionsToTopics()
 
     for (SubscriptionRaw* it = listOfAllSubscriptions; it != 0; it = it->getNext())
     {
-        it->mNextTopicSubscription = it->mTopic->mSubscriptions;
-        it->mTopic->mSubscriptions = it;
+        it->connect();
     }
 }
 
+bool
+outpost::smpc::SubscriptionRaw::connect()
+{
+    return mTopic->mSubscriptions.prepend(*this);
+}
+
+bool
+outpost::smpc::SubscriptionRaw::disconnect()
+{
+    return mTopic->mSubscriptions.remove(*this);
+}
+
 void
 outpost::smpc::SubscriptionRaw::releaseAllSubscriptions()
 {
-    for (SubscriptionRaw* it = listOfAllSubscriptions; it != 0; it = it->getNext())
-    {
-        it->mNextTopicSubscription = 0;
-    }
-
     TopicRaw::clearSubscriptions();
 }
@@ -45,6 +45,7 @@ class SubscriptionRaw : public ImplicitList<SubscriptionRaw>,
 {
 public:
     friend class TopicRaw;
+    friend class SubscriptionList<SubscriptionRaw>;
 
     /**
      * Constructor.
@@ -64,6 +65,8 @@ public:
     /**
      * Destroy the subscription
      *
+     * Disconnects the subscription from its topic first, see disconnect().
+     *
      * \warning    The destruction and creation of subscriptions during the normal
      *             runtime is not thread-safe. If topics need to be
      *             destroyed outside the initialization of the application
@@ -84,6 +87,38 @@ public:
     static void
     connectSubscriptionsToTopics();
 
+    /**
+     * Connect this subscription to its topic.
+     *
+     * Thread-safe, also while other threads publish to the topic.
+     *
+     * \return
+     *      False if the subscription was already connected.
+     */
+    bool
+    connect();
+
+    /**
+     * Disconnect this subscription from its topic.
+     *
+     * Thread-safe, waits until all running publish calls of the topic
+     * have left the subscription.
+     *
+     * The calling thread sleeps until the publish calls have finished.
+     * Publishers preempted inside publish() continue meanwhile even with
+     * a lower priority, but a publisher which is never scheduled (e.g.
+     * suspended) delays the return indefinitely.
+     *
+     * \warning
+     *      Must not be called from a subscriber of the same topic, this
+     *      would never return.
+     *
+     * \return
+     *      False if the subscription was not connected.
+     */
+    bool
+    disconnect();
+
 protected:
     /**
      * Release all subscriptions.
@@ -112,7 +147,7 @@ private:
     // Used by Subscription::connect to map the subscriptions to
     // their corresponding topics.
     TopicRaw* const mTopic;
-    SubscriptionRaw* mNextTopicSubscription;
+    SubscriptionList<SubscriptionRaw>::Link mNextTopicSubscription;
 };
 
 // ----------------------------------------------------------------------------
@@ -124,7 +159,7 @@ SubscriptionRaw::SubscriptionRaw(TopicRaw& topic,
     ImplicitList<SubscriptionRaw>(listOfAllSubscriptions, this),
     Functor<void(const void* message, size_t length)>(*subscriber, function),
     mTopic(&topic),
-    mNextTopicSubscription(0)
+    mNextTopicSubscription(nullptr)
 {
 }
 
@@ -15,12 +15,10 @@
 
 #include "subscription.h"
 
-#include <outpost/rtos/mutex_guard.h>
-
 outpost::smpc::TopicBase* outpost::smpc::TopicBase::listOfAllTopics = nullptr;
 
 outpost::smpc::TopicBase::TopicBase() :
-    ImplicitList<TopicBase>(listOfAllTopics, this), mSubscriptions(nullptr)
+    ImplicitList<TopicBase>(listOfAllTopics, this), mSubscriptions()
 {
 }
 
@@ -32,10 +30,10 @@ outpost::smpc::TopicBase::~TopicBase()
 void
 outpost::smpc::TopicBase::publishTypeUnsafe(void* message) const
 {
-    rtos::MutexGuard lock(mMutex);
+    SubscriptionList<Subscription>::ReadGuard guard(mSubscriptions);
 
-    for (Subscription* subscription = mSubscriptions; subscription != nullptr;
-         subscription = subscription->mNextTopicSubscription)
+    for (Subscription* subscription = guard.getFirst(); subscription != nullptr;
+         subscription = SubscriptionList<Subscription>::getNext(*subscription))
     {
         subscription->execute(message);
     }
@@ -46,6 +44,6 @@ outpost::smpc::TopicBase::clearSubscriptions()
 {
     for (TopicBase* it = listOfAllTopics; it != nullptr; it = it->getNext())
     {
-        it->mSubscriptions = nullptr;
+        it->mSubscriptions.clear();
     }
 }
@@ -14,7 +14,8 @@
 #ifndef OUTPOST_SMPC_TOPIC_H
 #define OUTPOST_SMPC_TOPIC_H
 
-#include <outpost/rtos/mutex.h>
+#include "subscription_list.h"
+
 #include <outpost/utils/container/implicit_list.h>
 
 #include <stdint.h>
@@ -75,7 +76,8 @@ public:
      * Publish new data.
      *
      * Forwards the pointer to all connected subscribers. This
-     * function is thread safe.
+     * function is thread safe and does not take a lock, several
+     * threads can publish to the same topic in parallel.
      */
     void
     publishTypeUnsafe(void* message) const;
@@ -88,11 +90,8 @@ private:
     static void
     clearSubscriptions();
 
-    /// Used to protect the publish() method
-    mutable rtos::Mutex mMutex;
-
-    /// Pointer to the list of subscriptions
-    Subscription* mSubscriptions;
+    /// Subscriptions connected to this topic
+    SubscriptionList<Subscription> mSubscriptions;
 };
 
 /**
@@ -15,12 +15,10 @@
 
 #include "subscription_raw.h"
 
-#include <outpost/rtos/mutex_guard.h>
-
 outpost::smpc::TopicRaw* outpost::smpc::TopicRaw::listOfAllTopics = 0;
 
 outpost::smpc::TopicRaw::TopicRaw() :
-    ImplicitList<TopicRaw>(listOfAllTopics, this), mSubscriptions(0)
+    ImplicitList<TopicRaw>(listOfAllTopics, this), mSubscriptions()
 {
 }
 
@@ -32,10 +30,10 @@ outpost::smpc::TopicRaw::~TopicRaw()
 void
 outpost::smpc::TopicRaw::publish(const void* message, size_t length)
 {
-    rtos::MutexGuard lock(mMutex);
+    SubscriptionList<SubscriptionRaw>::ReadGuard guard(mSubscriptions);
 
-    for (SubscriptionRaw* subscription = mSubscriptions; subscription != 0;
-         subscription = subscription->mNextTopicSubscription)
+    for (SubscriptionRaw* subscription = guard.getFirst(); subscription != 0;
+         subscription = SubscriptionList<SubscriptionRaw>::getNext(*subscription))
     {
         subscription->execute(message, length);
     }
@@ -46,6 +44,6 @@ outpost::smpc::TopicRaw::clearSubscriptions()
 {
     for (TopicRaw* it = listOfAllTopics; it != 0; it = it->getNext())
     {
-        it->mSubscriptions = 0;
+        it->mSubscriptions.clear();
     }
 }
@@ -14,7 +14,8 @@
 #ifndef OUTPOST_SMPC_TOPIC_RAW_H
 #define OUTPOST_SMPC_TOPIC_RAW_H
 
-#include <outpost/rtos/mutex.h>
+#include "subscription_list.h"
+
 #include <outpost/utils/container/implicit_list.h>
 
 #include <stddef.h>
@@ -71,7 +72,8 @@ public:
     /**
      * Publish new data.
      *
-     * Forwards the pointer to all connected subscribers.
+     * Forwards the pointer to all connected subscribers. This
+     * function is thread safe and does not take a lock.
      */
     void
     publish(const void* message, size_t length);
@@ -90,11 +92,8 @@ private:
     /// List of all raw topics currently active.
     static TopicRaw* listOfAllTopics;
 
-    /// Mutex used to protect the publish() method.
-    rtos::Mutex mMutex;
-
-    /// Pointer to the list of mSubscriptions
-    SubscriptionRaw* mSubscriptions;
+    /// Subscriptions connected to this topic
+    SubscriptionList<SubscriptionRaw> mSubscriptions;
 };
 
 }  // namespace smpc
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/smpc/loaned_topic.h>
+#include <outpost/smpc/subscription.h>
+
+#include <unittest/harness.h>
+#include <unittest/smpc/testing_subscription.h>
+
+#include <stdint.h>
+
+using namespace outpost::smpc;
+using outpost::utils::ConstSharedBufferPointer;
+
+namespace
+{
+struct Tile
+{
+    uint32_t sequence;
+    uint16_t pixels[62];
+};
+
+class Component : public Subscriber
+{
+public:
+    Component() : mNumberOfMessages(0), mLastSequence(0), mKept()
+    {
+    }
+
+    void
+    onReceive(const ConstSharedBufferPointer* message)
+    {
+        mNumberOfMessages++;
+        mLastSequence = LoanedTopic<Tile>::getMessage(*message).sequence;
+    }
+
+    void
+    onReceiveAndKeep(const ConstSharedBufferPointer* message)
+    {
+        onReceive(message);
+        mKept = *message;
+    }
+
+    uint32_t mNumberOfMessages;
+    uint32_t mLastSequence;
+    ConstSharedBufferPointer mKept;
+};
+}  // namespace
+
+class LoanedTopicTest : public ::testing::Test
+{
+public:
+    LoanedTopicTest() : pool(), topic(pool)
+    {
+    }
+
+    virtual void
+    TearDown() override
+    {
+        unittest::smpc::TestingSubscription::releaseAllSubscriptions();
+    }
+
+    outpost::utils::SharedBufferPool<sizeof(Tile), 2, alignof(Tile)> pool;
+    LoanedTopic<Tile> topic;
+};
+
+TEST_F(LoanedTopicTest, subscriberReceivesMessageInPlace)
+{
+    Component component;
+    Subscription subscription(topic, &component, &Component::onReceive);
+    unittest::smpc::TestingSubscription::connectSubscriptionsToTopics();
+
+    LoanedTopic<Tile>::Loan loan;
+    ASSERT_TRUE(topic.loan(loan));
+    ASSERT_TRUE(loan.isValid());
+    EXPECT_EQ(1U, pool.numberOfFreeElements());
+
+    loan->sequence = 42;
+    topic.publish(loan);
+    EXPECT_FALSE(loan.isValid());
+
+    EXPECT_EQ(1U, component.mNumberOfMessages);
+    EXPECT_EQ(42U, component.mLastSequence);
+
+    // Nobody kept the message
+    EXPECT_EQ(2U, pool.numberOfFreeElements());
+}
+
+TEST_F(LoanedTopicTest, subscriberKeepsMessageWithoutCopy)
+{
+    Component component;
+    Component other;
+    Subscription subscription(topic, &component, &Component::onReceiveAndKeep);
+    Subscription otherSubscription(topic, &other, &Component::onReceiveAndKeep);
+    unittest::smpc::TestingSubscription::connectSubscriptionsToTopics();
+
+    LoanedTopic<Tile>::Loan loan;
+    ASSERT_TRUE(topic.loan(loan));
+    loan->sequence = 7;
+    const Tile* data = &(*loan);
+    topic.publish(loan);
+
+    // Both subscribers share the buffer of the publisher
+    EXPECT_EQ(data, &LoanedTopic<Tile>::getMessage(component.mKept));
+    EXPECT_EQ(data, &LoanedTopic<Tile>::getMessage(other.mKept));
+    EXPECT_EQ(1U, pool.numberOfFreeElements());
+
+    component.mKept = ConstSharedBufferPointer();
+    EXPECT_EQ(1U, pool.numberOfFreeElements());
+    other.mKept = ConstSharedBufferPointer();
+    EXPECT_EQ(2U, pool.numberOfFreeElements());
+}
+
+TEST_F(LoanedTopicTest, loanFailsIfPoolIsExhausted)
+{
+    LoanedTopic<Tile>::Loan first;
+    LoanedTopic<Tile>::Loan second;
+    LoanedTopic<Tile>::Loan third;
+    EXPECT_TRUE(topic.loan(first));
+    EXPECT_TRUE(topic.loan(second));
+    EXPECT_FALSE(topic.loan(third));
+    EXPECT_FALSE(third.isValid());
+
+    first.release();
+    EXPECT_TRUE(topic.loan(third));
+}
+
+TEST_F(LoanedTopicTest, loanFailsIfElementsAreTooSmall)
+{
+    outpost::utils::SharedBufferPool<sizeof(Tile) / 2, 2, alignof(Tile)> smallPool;
+    LoanedTopic<Tile> smallTopic(smallPool);
+
+    LoanedTopic<Tile>::Loan loan;
+    EXPECT_FALSE(smallTopic.loan(loan));
+    EXPECT_EQ(2U, smallPool.numberOfFreeElements());
+}
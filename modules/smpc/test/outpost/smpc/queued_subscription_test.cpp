@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/smpc/queued_subscription.h>
+#include <outpost/smpc/subscription.h>
+#include <outpost/smpc/topic.h>
+
+#include <unittest/harness.h>
+#include <unittest/smpc/testing_subscription.h>
+
+#include <stdint.h>
+
+#include <functional>
+#include <future>
+
+using namespace outpost::smpc;
+
+namespace
+{
+struct Data
+{
+    uint32_t value;
+    uint32_t padding[7];
+};
+
+class Component : public Subscriber
+{
+public:
+    Component() : mNumberOfMessages(0), mLastValue(0)
+    {
+    }
+
+    void
+    onReceive(const Data* data)
+    {
+        mNumberOfMessages++;
+        mLastValue = data->value;
+    }
+
+    uint32_t mNumberOfMessages;
+    uint32_t mLastValue;
+};
+
+/**
+ * Drains a subscription until the expected number of messages has been
+ * received.
+ *
+ * \return Number of messages received in order
+ */
+uint32_t
+receiveSequence(QueuedSubscriptionBase<const Data>& subscription, uint32_t expected)
+{
+    uint32_t received = 0;
+    Data data;
+    while ((received < expected) && subscription.receive(data, outpost::time::Seconds(10)))
+    {
+        if (data.value != received)
+        {
+            break;
+        }
+        received++;
+    }
+    return received;
+}
+}  // namespace
+
+class QueuedSubscriptionTest : public ::testing::Test
+{
+public:
+    virtual void
+    TearDown() override
+    {
+        unittest::smpc::TestingSubscription::releaseAllSubscriptions();
+    }
+
+    void
+    publish(uint32_t value)
+    {
+        Data data = {value, {}};
+        topic.publish(data);
+    }
+
+    Topic<const Data> topic;
+    Component component;
+};
+
+TEST_F(QueuedSubscriptionTest, deliversInSubscriberThread)
+{
+    QueuedSubscription<const Data, 4> subscription(
+            topic, &component, &Component::onReceive, OverflowPolicy::dropNewest);
+    unittest::smpc::TestingSubscription::connectSubscriptionsToTopics();
+
+    publish(1);
+    publish(2);
+    EXPECT_EQ(0U, component.mNumberOfMessages);
+    EXPECT_EQ(2U, subscription.getNumberOfQueuedMessages());
+
+    EXPECT_TRUE(subscription.dispatch());
+    EXPECT_EQ(1U, component.mNumberOfMessages);
+    EXPECT_EQ(1U, component.mLastValue);
+
+    EXPECT_TRUE(subscription.dispatch());
+    EXPECT_EQ(2U, component.mLastValue);
+    EXPECT_FALSE(subscription.dispatch());
+    EXPECT_EQ(0U, subscription.getNumberOfDroppedMessages());
+}
+
+TEST_F(QueuedSubscriptionTest, dropsNewest)
+{
+    QueuedSubscription<const Data, 2> subscription(topic, OverflowPolicy::dropNewest);
+    unittest::smpc::TestingSubscription::connectSubscriptionsToTopics();
+
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        publish(i);
+    }
+    EXPECT_EQ(3U, subscription.getNumberOfDroppedMessages());
+
+    Data data;
+    ASSERT_TRUE(subscription.receive(data));
+    EXPECT_EQ(0U, data.value);
+    ASSERT_TRUE(subscription.receive(data));
+    EXPECT_EQ(1U, data.value);
+    EXPECT_FALSE(subscription.receive(data));
+}
+
+TEST_F(QueuedSubscriptionTest, dropsOldest)
+{
+    QueuedSubscription<const Data, 2> subscription(topic, OverflowPolicy::dropOldest);
+    unittest::smpc::TestingSubscription::connectSubscriptionsToTopics();
+
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        publish(i);
+    }
+    EXPECT_EQ(3U, subscription.getNumberOfDroppedMessages());
+    EXPECT_EQ(2U, subscription.getNumberOfQueuedMessages());
+
+    Data data;
+    ASSERT_TRUE(subscription.receive(data));
+    EXPECT_EQ(3U, data.value);
+    ASSERT_TRUE(subscription.receive(data));
+    EXPECT_EQ(4U, data.value);
+    EXPECT_FALSE(subscription.receive(data));
+}
+
+TEST_F(QueuedSubscriptionTest, blockTimesOut)
+{
+    QueuedSubscription<const Data, 1> subscription(
+            topic, OverflowPolicy::block, outpost::time::Milliseconds(1));
+    unittest::smpc::TestingSubscription::connectSubscriptionsToTopics();
+
+    publish(1);
+    publish(2);
+    EXPECT_EQ(1U, subscription.getNumberOfDroppedMessages());
+
+    Data data;
+    ASSERT_TRUE(subscription.receive(data));
+    EXPECT_EQ(1U, data.value);
+
+    // Space is available again
+    publish(3);
+    ASSERT_TRUE(subscription.receive(data));
+    EXPECT_EQ(3U, data.value);
+    EXPECT_EQ(1U, subscription.getNumberOfDroppedMessages());
+}
+
+TEST_F(QueuedSubscriptionTest, blockWaitsForReceiver)
+{
+    constexpr uint32_t numberOfMessages = 1000;
+    QueuedSubscription<const Data, 4> subscription(topic, OverflowPolicy::block);
+    unittest::smpc::TestingSubscription::connectSubscriptionsToTopics();
+
+    std::future<uint32_t> receiver = std::async(
+            std::launch::async, receiveSequence, std::ref(subscription), numberOfMessages);
+    for (uint32_t i = 0; i < numberOfMessages; i++)
+    {
+        publish(i);
+    }
+
+    EXPECT_EQ(numberOfMessages, receiver.get());
+    EXPECT_EQ(0U, subscription.getNumberOfDroppedMessages());
+}
+
+TEST_F(QueuedSubscriptionTest, mixesWithSynchronousSubscriptions)
+{
+    Component direct;
+    Subscription synchronous(topic, &direct, &Component::onReceive);
+    QueuedSubscription<const Data, 4> queued(topic, &component, &Component::onReceive);
+    unittest::smpc::TestingSubscription::connectSubscriptionsToTopics();
+
+    publish(7);
+    EXPECT_EQ(1U, direct.mNumberOfMessages);
+    EXPECT_EQ(0U, component.mNumberOfMessages);
+
+    EXPECT_TRUE(queued.dispatch());
+    EXPECT_EQ(7U, component.mLastValue);
+}
@@ -11,6 +11,7 @@
  * - 2013-2017, Fabian Greif (DLR RY-AVS)
  */
 
+#include <outpost/rtos/thread.h>
 #include <outpost/smpc/subscription.h>
 #include <outpost/smpc/topic.h>
 
@@ -20,6 +21,10 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <atomic>
+#include <functional>
+#include <future>
+
 struct Data
 {
     uint32_t foo;
@@ -70,6 +75,43 @@ public:
     bool received[4];
 };
 
+namespace
+{
+class Counter : public outpost::smpc::Subscriber
+{
+public:
+    Counter() : mCount(0)
+    {
+    }
+
+    void
+    onReceive(const Data*)
+    {
+        mCount++;
+    }
+
+    uint32_t mCount;
+};
+
+/**
+ * Publishes messages to a topic until stopped.
+ *
+ * \return Number of published messages
+ */
+uint32_t
+publishUntilStopped(outpost::smpc::Topic<const Data>& topic, const std::atomic<bool>& stop)
+{
+    uint32_t numberOfMessages = 0;
+    Data data = {0, 0};
+    while (!stop)
+    {
+        topic.publish(data);
+        numberOfMessages++;
+    }
+    return numberOfMessages;
+}
+}  // namespace
+
 class SubscriptionTest : public ::testing::Test
 {
 public:
@@ -206,3 +248,75 @@ TEST_F(SubscriptionTest, receiveFourWithDelete2)
     delete subscription1;
     delete subscription2;
 }
+
+TEST_F(SubscriptionTest, connectAndDisconnectSingleSubscription)
+{
+    outpost::smpc::Subscription subscription0(topic, &component, &Component::onReceiveData0);
+    outpost::smpc::Subscription subscription1(topic, &component, &Component::onReceiveData1);
+
+    EXPECT_TRUE(subscription1.connect());
+    EXPECT_FALSE(subscription1.connect());
+
+    topic.publish(data);
+    EXPECT_FALSE(component.received[0]);
+    EXPECT_TRUE(component.received[1]);
+
+    component.reset();
+    EXPECT_TRUE(subscription0.connect());
+    EXPECT_TRUE(subscription1.disconnect());
+    EXPECT_FALSE(subscription1.disconnect());
+
+    topic.publish(data);
+    EXPECT_TRUE(component.received[0]);
+    EXPECT_FALSE(component.received[1]);
+}
+
+TEST_F(SubscriptionTest, connectSubscriptionsToTopicsAfterConnect)
+{
+    outpost::smpc::Subscription subscription0(topic, &component, &Component::onReceiveData0);
+    outpost::smpc::Subscription subscription1(topic, &component, &Component::onReceiveData1);
+
+    subscription0.connect();
+    unittest::smpc::TestingSubscription::connectSubscriptionsToTopics();
+
+    // Every subscription is called exactly once
+    Counter counter;
+    outpost::smpc::Subscription subscription2(topic, &counter, &Counter::onReceive);
+    subscription2.connect();
+    unittest::smpc::TestingSubscription::connectSubscriptionsToTopics();
+
+    topic.publish(data);
+    EXPECT_TRUE(component.received[0]);
+    EXPECT_TRUE(component.received[1]);
+    EXPECT_EQ(1U, counter.mCount);
+}
+
+TEST_F(SubscriptionTest, disconnectWhilePublishing)
+{
+    Counter permanent;
+    outpost::smpc::Subscription permanentSubscription(topic, &permanent, &Counter::onReceive);
+    unittest::smpc::TestingSubscription::connectSubscriptionsToTopics();
+
+    std::atomic<bool> stop(false);
+    std::future<uint32_t> publisher = std::async(
+            std::launch::async, publishUntilStopped, std::ref(topic), std::cref(stop));
+
+    Counter temporary;
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        outpost::smpc::Subscription subscription(topic, &temporary, &Counter::onReceive);
+        EXPECT_TRUE(subscription.connect());
+        outpost::rtos::Thread::yield();
+        EXPECT_TRUE(subscription.disconnect());
+    }
+    stop = true;
+    const uint32_t numberOfMessages = publisher.get();
+
+    // Nothing is delivered to the temporary subscriber after disconnect()
+    const uint32_t receivedByTemporary = temporary.mCount;
+    Data message = {0, 0};
+    topic.publish(message);
+
+    EXPECT_EQ(numberOfMessages + 1, permanent.mCount);
+    EXPECT_EQ(receivedByTemporary, temporary.mCount);
+}
@@ -34,8 +34,9 @@ TestingTopicBase::dumpConnectedSubscriptions(const outpost::smpc::TopicBase& bas
 {
     printf("topic %p\n", reinterpret_cast<const void*>(this));
 
-    for (Subscription* topic = base.mSubscriptions; topic != 0;
-         topic = topic->mNextTopicSubscription)
+    SubscriptionList<Subscription>::ReadGuard guard(base.mSubscriptions);
+    for (Subscription* topic = guard.getFirst(); topic != 0;
+         topic = SubscriptionList<Subscription>::getNext(*topic))
     {
         printf("- %p\n", reinterpret_cast<void*>(topic));
     }
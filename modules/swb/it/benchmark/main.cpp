@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// Dispatch of messages by the SoftwareBus for an increasing number of
+// channels.
+//
+// Every channel subscribes to one message id, every message matches
+// exactly one channel. Messages are dispatched by the distributor of the
+// bus without its thread, either by offering every message to every
+// channel, through a RoutingTable, or in batches of queued messages.
+
+#include <outpost/swb/routing_table.h>
+#include <outpost/swb/software_bus.h>
+#include <outpost/utils/container/mpsc_reference_queue.h>
+#include <outpost/utils/container/shared_object_pool.h>
+
+#include <stdio.h>
+
+#include <chrono>
+
+using namespace outpost::swb;
+
+namespace
+{
+typedef uint16_t MessageId;
+typedef BufferedBusChannelWithMemory<4, MessageId, SubscriptionFilter<MessageId>> Channel;
+
+constexpr size_t maximumNumberOfChannels = 400;
+constexpr size_t queueSize = 16;
+constexpr uint32_t messagesPerRun = 200000;
+
+/**
+ * Exposes the dispatch of the bus distributor without starting its thread.
+ */
+class Bus : public SoftwareBus<MessageId>
+{
+public:
+    Bus(outpost::utils::SharedBufferPoolBase& pool,
+        outpost::utils::ReferenceQueueBase<Message<MessageId>>& queue) :
+        SoftwareBus<MessageId>(
+                pool, queue, 1, outpost::support::parameter::HeartbeatSource::default0)
+    {
+    }
+
+    void
+    dispatch()
+    {
+        handleAllMessages();
+    }
+};
+
+Channel channels[maximumNumberOfChannels];
+BusSubscription<MessageId>* subscriptions[maximumNumberOfChannels];
+
+outpost::utils::SharedBufferPool<16, 4> pool;
+outpost::utils::MpscReferenceQueue<Message<MessageId>, queueSize> queue;
+RoutingTable<MessageId, maximumNumberOfChannels, maximumNumberOfChannels> routingTable;
+MessageBatch<MessageId, queueSize> batch;
+
+enum class Mode
+{
+    linear,
+    routed,
+    batched
+};
+
+void
+subscribeChannels()
+{
+    for (size_t i = 0; i < maximumNumberOfChannels; i++)
+    {
+        subscriptions[i] = new BusSubscription<MessageId>(static_cast<MessageId>(i));
+        channels[i].getFilter().registerSubscription(*subscriptions[i]);
+    }
+}
+
+double
+measure(size_t numberOfChannels, Mode mode)
+{
+    Bus bus(pool, queue);
+    for (size_t i = 0; i < numberOfChannels; i++)
+    {
+        bus.registerChannel(channels[i]);
+    }
+    if (mode == Mode::routed)
+    {
+        bus.setRoutingTable(routingTable);
+    }
+    else if (mode == Mode::batched)
+    {
+        bus.setMessageBatch(batch);
+    }
+
+    outpost::utils::ConstSharedBufferPointer empty;
+    Message<MessageId> received;
+    size_t next = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t sent = 0; sent < messagesPerRun; sent += queueSize)
+    {
+        const size_t first = next;
+        for (size_t i = 0; i < queueSize; i++)
+        {
+            Message<MessageId> message{static_cast<MessageId>(next), empty};
+            bus.sendMessage(message);
+            next = (next + 1) % numberOfChannels;
+        }
+        bus.dispatch();
+
+        for (size_t i = 0, index = first; i < queueSize; i++)
+        {
+            channels[index].receiveMessage(received);
+            index = (index + 1) % numberOfChannels;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    if (bus.getNumberOfForwardedMessages() != messagesPerRun)
+    {
+        printf("Error: %u messages not forwarded\n",
+               static_cast<unsigned int>(messagesPerRun - bus.getNumberOfForwardedMessages()));
+    }
+    for (size_t i = 0; i < numberOfChannels; i++)
+    {
+        bus.unregisterChannel(channels[i]);
+    }
+    return std::chrono::duration<double>(end - start).count();
+}
+}  // namespace
+
+int
+main(void)
+{
+    printf("SoftwareBus dispatch to channels with one subscription each\n");
+    subscribeChannels();
+
+    const size_t channelCounts[] = {10, 50, 200, 400};
+    for (size_t numberOfChannels : channelCounts)
+    {
+        const double linear = measure(numberOfChannels, Mode::linear);
+        const double routed = measure(numberOfChannels, Mode::routed);
+        const double batched = measure(numberOfChannels, Mode::batched);
+        printf("%3u channels: linear %8.1f, routing table %8.1f, batch %8.1f ns/message\n",
+               static_cast<unsigned int>(numberOfChannels),
+               linear * 1e9 / messagesPerRun,
+               routed * 1e9 / messagesPerRun,
+               batched * 1e9 / messagesPerRun);
+    }
+
+    return 0;
+}
@@ -62,6 +62,17 @@ public:
     virtual OperationResult
     sendMessage(const Message<IDType>& m) = 0;
 
+    /**
+     * Sends several Message to the channel at once. This method is supposed to be used by a
+     * SoftwareBus instance only. The default implementation calls sendMessage() for each Message.
+     * \param messages Message to be sent to the channel.
+     * \param accepted Set to true for each Message that was accepted, entries of rejected Message
+     *                 are left unchanged.
+     * \return Number of accepted Message.
+     */
+    virtual size_t
+    sendMessages(outpost::Slice<const Message<IDType>> messages, outpost::Slice<bool> accepted);
+
     /**
      * Retrieves a single Message from the channel within a given timeout.
      * \param m Reference of the received Message
@@ -79,6 +90,17 @@ public:
     virtual bool
     matches(const Message<IDType>& m) const = 0;
 
+    /**
+     * Access to the filter of the channel if it only filters by subscriptions. Allows a
+     * RoutingTable to forward only matching Message to the channel.
+     * \return Returns the filter used by matches(), or nullptr if the channel uses another filter.
+     */
+    virtual const SubscriptionFilter<IDType>*
+    getSubscriptionFilter() const
+    {
+        return nullptr;
+    }
+
     /**
      * Getter for the number of incoming Message to the BusChannel. This includes Messages that
      * will be filtered out.
@@ -158,6 +180,13 @@ public:
     virtual OperationResult
     sendMessage(const Message<IDType>& m) override;
 
+    /**
+     * Appends all matching Message under a single lock.
+     */
+    virtual size_t
+    sendMessages(outpost::Slice<const Message<IDType>> messages,
+                 outpost::Slice<bool> accepted) override;
+
     virtual OperationResult
     receiveMessage(Message<IDType>& m,
                    outpost::time::Duration timeout = outpost::time::Duration::zero()) override;
@@ -230,7 +259,25 @@ public:
         return mFilter;
     }
 
+    const SubscriptionFilter<IDType>*
+    getSubscriptionFilter() const override
+    {
+        return asSubscriptionFilter(&mFilter);
+    }
+
 private:
+    static const SubscriptionFilter<IDType>*
+    asSubscriptionFilter(const SubscriptionFilter<IDType>* filter)
+    {
+        return filter;
+    }
+
+    static const SubscriptionFilter<IDType>*
+    asSubscriptionFilter(const void*)
+    {
+        return nullptr;
+    }
+
     Filter mFilter;
 };
 
@@ -32,6 +32,23 @@ BusChannel<IDType>::BusChannel() :
 {
 }
 
+template <typename IDType>
+size_t
+BusChannel<IDType>::sendMessages(outpost::Slice<const Message<IDType>> messages,
+                                 outpost::Slice<bool> accepted)
+{
+    size_t numberOfAccepted = 0;
+    for (size_t i = 0; i < messages.getNumberOfElements(); i++)
+    {
+        if (OperationResult::success == sendMessage(messages[i]))
+        {
+            accepted[i] = true;
+            numberOfAccepted++;
+        }
+    }
+    return numberOfAccepted;
+}
+
 template <typename IDType>
 BufferedBusChannel<IDType>::BufferedBusChannel(outpost::Slice<Message<IDType>> buffer) :
     mBuffer(buffer), mMessageAvailable(0U)
@@ -63,6 +80,47 @@ BufferedBusChannel<IDType>::sendMessage(const Message<IDType>& m)
     return res;
 }
 
+template <typename IDType>
+size_t
+BufferedBusChannel<IDType>::sendMessages(outpost::Slice<const Message<IDType>> messages,
+                                         outpost::Slice<bool> accepted)
+{
+    const size_t numberOfMessages = messages.getNumberOfElements();
+    BusChannel<IDType>::mNumIncomingMessages += static_cast<uint32_t>(numberOfMessages);
+
+    // Channels without a matching Message are not locked at all
+    size_t first = 0;
+    while ((first < numberOfMessages) && !matches(messages[first]))
+    {
+        first++;
+    }
+    if (first == numberOfMessages)
+    {
+        return 0;
+    }
+
+    size_t numberOfAccepted = 0;
+    outpost::rtos::MutexGuard lock(mMutex);
+    for (size_t i = first; i < numberOfMessages; i++)
+    {
+        if ((i == first) || matches(messages[i]))
+        {
+            if (mBuffer.append(messages[i]))
+            {
+                BusChannel<IDType>::mNumAppendedMessages++;
+                mMessageAvailable.release();
+                accepted[i] = true;
+                numberOfAccepted++;
+            }
+            else
+            {
+                BusChannel<IDType>::mNumFailedReceptions++;
+            }
+        }
+    }
+    return numberOfAccepted;
+}
+
 template <typename IDType>
 OperationResult
 BufferedBusChannel<IDType>::receiveMessage(Message<IDType>& m, outpost::time::Duration timeout)
@@ -16,14 +16,19 @@
 
 #include "bus_channel.h"
 #include "bus_handler_thread.h"
+#include "message_batch.h"
 #include "message_handler.h"
+#include "routing_table.h"
 #include "types.h"
 
 #include <outpost/rtos/mutex.h>
 #include <outpost/utils/container/shared_buffer.h>
+#include <outpost/utils/statistics_counter.h>
 
 #include <stdint.h>
 
+#include <type_traits>
+
 namespace outpost
 {
 namespace utils
@@ -100,6 +105,31 @@ public:
     OperationResult
     setDefaultChannel(BusChannel<IDType>& channel);
 
+    /**
+     * Sets a RoutingTable which is used to forward Message only to the matching channels instead
+     * of offering every Message to every channel. The table is rebuilt automatically when
+     * channels are registered or subscriptions are added to a SubscriptionFilter.
+     *
+     * Recommended for buses with many channels using a SubscriptionFilter. Note that channels
+     * only count the Message forwarded to them as incoming messages when a table is used.
+     *
+     * \param table The RoutingTable, must be valid for the lifetime of the distributor.
+     */
+    void
+    setRoutingTable(RoutingTableBase<IDType>& table);
+
+    /**
+     * Enables the batch mode. The BusHandlerThread then takes several Message from the queue per
+     * wakeup and offers them to each BusChannel together, a BufferedBusChannel appends all
+     * matching Message under a single lock. Reduces the overhead per Message under bursty load.
+     *
+     * Must be called before the distributor is started.
+     *
+     * \param batch Buffer for one batch, must be valid for the lifetime of the distributor.
+     */
+    void
+    setMessageBatch(MessageBatchBase<IDType>& batch);
+
     /**
      * Getter for the current number of BusChannel.
      * \return Number of BusChannel.
@@ -161,13 +191,37 @@ protected:
     bool
     handleSingleMessage() override;
 
+    /**
+     * Forwards a Message through the RoutingTable. The table is rebuilt first if channels or
+     * subscriptions have changed.
+     *
+     * \param message The Message to forward.
+     * \param isForwarded Set to true if at least one channel has accepted the Message.
+     * \return Returns false if no valid RoutingTable is available, the Message has to be
+     *         offered to every channel then.
+     */
+    bool
+    routeMessage(const Message<IDType>& message, bool& isForwarded);
+
 private:
+    bool
+    routeMessage(const Message<IDType>& message, bool& isForwarded, std::true_type);
+
+    // Only integral message ids can be indexed
+    bool
+    routeMessage(const Message<IDType>& message, bool& isForwarded, std::false_type);
+
     BusHandlerThread<IDType> mHandlerThread;
 
     outpost::utils::Receiver<Message<IDType>>& mReceiver;
     outpost::List<BusChannel<IDType>> mChannels;
     BusChannel<IDType>* mDefaultChannel;
     outpost::rtos::Mutex mChannelMutex;
+
+    RoutingTableBase<IDType>* mRoutingTable;
+    outpost::utils::StatisticsCounter mNumberOfChannelChanges;
+    uint32_t mRoutedChannelChanges;
+    uint32_t mRoutedSubscriptionChanges;
 };
 
 }  // namespace swb
@@ -30,7 +30,10 @@ BusDistributor<IDType>::BusDistributor(
         outpost::support::parameter::HeartbeatSource heartbeatSource) :
     mHandlerThread(*this, receiver, heartbeatSource, priority),
     mReceiver(receiver),
-    mDefaultChannel(nullptr)
+    mDefaultChannel(nullptr),
+    mRoutingTable(nullptr),
+    mRoutedChannelChanges(0),
+    mRoutedSubscriptionChanges(0)
 {
 }
 
@@ -47,6 +50,7 @@ BusDistributor<IDType>::registerChannel(BusChannel<IDType>& channel)
 {
     outpost::rtos::MutexGuard lock(mChannelMutex);
     mChannels.append(&channel);
+    mNumberOfChannelChanges.increment();
     return OperationResult::success;
 }
 
@@ -57,6 +61,7 @@ BusDistributor<IDType>::unregisterChannel(BusChannel<IDType>& channel)
     outpost::rtos::MutexGuard lock(mChannelMutex);
     if (mChannels.removeNode(&channel))
     {
+        mNumberOfChannelChanges.increment();
         return OperationResult::success;
     }
     else
@@ -81,6 +86,64 @@ BusDistributor<IDType>::setDefaultChannel(BusChannel<IDType>& channel)
     }
 }
 
+template <typename IDType>
+void
+BusDistributor<IDType>::setRoutingTable(RoutingTableBase<IDType>& table)
+{
+    outpost::rtos::MutexGuard lock(mChannelMutex);
+    mRoutingTable = &table;
+    mRoutingTable->build(mChannels);
+    mRoutedChannelChanges = mNumberOfChannelChanges.get();
+    mRoutedSubscriptionChanges = SubscriptionFilter<IDType>::getNumberOfModifications();
+}
+
+template <typename IDType>
+void
+BusDistributor<IDType>::setMessageBatch(MessageBatchBase<IDType>& batch)
+{
+    mHandlerThread.mBatch = &batch;
+}
+
+template <typename IDType>
+bool
+BusDistributor<IDType>::routeMessage(const Message<IDType>& message, bool& isForwarded)
+{
+    if (mRoutingTable == nullptr)
+    {
+        return false;
+    }
+    return routeMessage(message, isForwarded, std::is_integral<IDType>());
+}
+
+template <typename IDType>
+bool
+BusDistributor<IDType>::routeMessage(const Message<IDType>& message,
+                                     bool& isForwarded,
+                                     std::true_type)
+{
+    if ((mRoutedChannelChanges != mNumberOfChannelChanges.get())
+        || (mRoutedSubscriptionChanges != SubscriptionFilter<IDType>::getNumberOfModifications()))
+    {
+        outpost::rtos::MutexGuard lock(mChannelMutex);
+        mRoutedChannelChanges = mNumberOfChannelChanges.get();
+        mRoutedSubscriptionChanges = SubscriptionFilter<IDType>::getNumberOfModifications();
+        mRoutingTable->build(mChannels);
+    }
+    if (!mRoutingTable->isValid())
+    {
+        return false;
+    }
+    isForwarded = mRoutingTable->forward(message);
+    return true;
+}
+
+template <typename IDType>
+bool
+BusDistributor<IDType>::routeMessage(const Message<IDType>&, bool&, std::false_type)
+{
+    return false;
+}
+
 template <typename IDType>
 void
 BusDistributor<IDType>::handleAllMessages()
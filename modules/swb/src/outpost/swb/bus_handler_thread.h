@@ -15,7 +15,10 @@
 #ifndef OUTPOST_SWB_BUS_HANDLER_THREAD_H_
 #define OUTPOST_SWB_BUS_HANDLER_THREAD_H_
 
+#include "message_batch.h"
+
 #include <outpost/parameter/support.h>
+#include <outpost/rtos/clock.h>
 #include <outpost/rtos/thread.h>
 
 namespace outpost
@@ -69,7 +72,8 @@ public:
     virtual ~BusHandlerThread() = default;
 
     /**
-     * Performs a single step of processing for a single Message.
+     * Performs a single step of processing for a single Message, or for a batch of Message if a
+     * MessageBatch has been set for the BusDistributor.
      * \param timeout Timeout for a single step after which the software watchdog is fed.
      * \return true if a message was handled, false if timeout occurred
      */
@@ -115,8 +119,28 @@ protected:
 
     static constexpr outpost::time::Duration RECEIVE_TIMEOUT = outpost::time::Seconds(5);
 
+    /**
+     * Receives up to the size of the batch, waits at most the latency of the batch for further
+     * Message after the first one.
+     * \return Number of received Message
+     */
+    size_t
+    receiveBatch(MessageBatchBase<IDType>& batch, outpost::time::Duration timeout);
+
+    bool
+    stepBatch(MessageBatchBase<IDType>& batch, outpost::time::Duration timeout);
+
+    /**
+     * Updates the counters and hands the Message to the default channel if no regular
+     * BusChannel has accepted it.
+     */
+    void
+    finishMessage(const Message<IDType>& message, bool isForwarded);
+
     BusDistributor<IDType>& mBus;
     outpost::utils::Receiver<Message<IDType>>& mReceiver;
+    MessageBatchBase<IDType>* mBatch;
+    outpost::rtos::SystemClock mClock;
 
     outpost::support::parameter::HeartbeatSource mHeartbeatSource;
 
@@ -38,6 +38,7 @@ BusHandlerThread<IDType>::BusHandlerThread(BusDistributor<IDType>& bus,
     outpost::rtos::Thread(priority, stackSize, "SWB"),
     mBus(bus),
     mReceiver(receiver),
+    mBatch(nullptr),
     mHeartbeatSource(heartbeat),
     mNumberOfIncomingMessages(0U),
     mNumberOfForwardedMessages(0U),
@@ -60,38 +61,135 @@ template <typename IDType>
 bool
 BusHandlerThread<IDType>::step(outpost::time::Duration timeout)
 {
+    if (mBatch != nullptr)
+    {
+        return stepBatch(*mBatch, timeout);
+    }
+
     Message<IDType> message;
     if (mReceiver.receive(message, timeout))
     {
         mNumberOfIncomingMessages++;
-        auto channelIterator = mBus.getChannels().begin();
         bool isForwarded = false;
-        while (channelIterator != mBus.getChannels().end())
+        if (!mBus.routeMessage(message, isForwarded))
         {
-            if (OperationResult::success == channelIterator->sendMessage(message))
+            auto channelIterator = mBus.getChannels().begin();
+            while (channelIterator != mBus.getChannels().end())
             {
-                isForwarded = true;
+                if (OperationResult::success == channelIterator->sendMessage(message))
+                {
+                    isForwarded = true;
+                }
+                ++channelIterator;
             }
-            ++channelIterator;
-        }
-        if (isForwarded)
-        {
-            mNumberOfForwardedMessages++;
         }
-        else
+        finishMessage(message, isForwarded);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+template <typename IDType>
+size_t
+BusHandlerThread<IDType>::receiveBatch(MessageBatchBase<IDType>& batch,
+                                       outpost::time::Duration timeout)
+{
+    outpost::Slice<Message<IDType>> messages = batch.mMessages;
+    if (!mReceiver.receive(messages[0], timeout))
+    {
+        return 0;
+    }
+
+    const outpost::time::Duration latency = batch.getMaximumLatency();
+    const bool wait = (latency > outpost::time::Duration::zero());
+    outpost::time::SpacecraftElapsedTime deadline;
+    if (wait)
+    {
+        deadline = mClock.now() + latency;
+    }
+
+    size_t count = 1;
+    while (count < messages.getNumberOfElements())
+    {
+        // Message already waiting in the queue are always taken
+        outpost::time::Duration remaining = outpost::time::Duration::zero();
+        if (wait)
         {
-            if (mBus.mDefaultChannel != nullptr
-                && (OperationResult::success == mBus.mDefaultChannel->sendMessage(message)))
+            const outpost::time::SpacecraftElapsedTime now = mClock.now();
+            if (now < deadline)
             {
-                mNumberOfDefaultedMessages++;
+                remaining = deadline - now;
             }
         }
-        return true;
+        if (!mReceiver.receive(messages[count], remaining))
+        {
+            break;
+        }
+        count++;
     }
-    else
+    return count;
+}
+
+template <typename IDType>
+bool
+BusHandlerThread<IDType>::stepBatch(MessageBatchBase<IDType>& batch,
+                                    outpost::time::Duration timeout)
+{
+    const size_t count = receiveBatch(batch, timeout);
+    if (count == 0)
     {
         return false;
     }
+    mNumberOfIncomingMessages += static_cast<uint32_t>(count);
+
+    outpost::Slice<Message<IDType>> messages = batch.mMessages.first(count);
+    outpost::Slice<bool> accepted = batch.mAccepted.first(count);
+    accepted.fill(false);
+
+    if (mBus.routeMessage(messages[0], accepted[0]))
+    {
+        // The routing table selects the channels per Message
+        for (size_t i = 1; i < count; i++)
+        {
+            mBus.routeMessage(messages[i], accepted[i]);
+        }
+    }
+    else
+    {
+        for (auto it = mBus.getChannels().begin(); it != mBus.getChannels().end(); ++it)
+        {
+            it->sendMessages(messages, accepted);
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        finishMessage(messages[i], accepted[i]);
+        // Drop the references held by the batch
+        messages[i] = Message<IDType>();
+    }
+    return true;
+}
+
+template <typename IDType>
+void
+BusHandlerThread<IDType>::finishMessage(const Message<IDType>& message, bool isForwarded)
+{
+    if (isForwarded)
+    {
+        mNumberOfForwardedMessages++;
+    }
+    else
+    {
+        if (mBus.mDefaultChannel != nullptr
+            && (OperationResult::success == mBus.mDefaultChannel->sendMessage(message)))
+        {
+            mNumberOfDefaultedMessages++;
+        }
+    }
 }
 
 }  // namespace swb
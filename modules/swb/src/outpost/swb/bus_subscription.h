@@ -68,6 +68,21 @@ public:
         return res;
     }
 
+    /**
+     * Getter for the message id, the bits not covered by the mask are zero.
+     */
+    inline IDType
+    getMessageId() const
+    {
+        return mMessageId;
+    }
+
+    inline IDType
+    getMask() const
+    {
+        return mMask;
+    }
+
     /**
      * Getter for the number of matched Message
      * \return Number of matched Message.
@@ -19,6 +19,7 @@
 #include <outpost/base/slice.h>
 #include <outpost/swb/types.h>
 #include <outpost/utils/container/list.h>
+#include <outpost/utils/statistics_counter.h>
 
 #include <stdint.h>
 
@@ -113,6 +114,7 @@ public:
     {
         mSubscriptions.append(&subscription);
         mSubscriptionCount++;
+        mNumberOfModifications.increment();
     }
 
     size_t
@@ -121,6 +123,22 @@ public:
         return mSubscriptionCount;
     }
 
+    inline const outpost::List<BusSubscription<IDType>>&
+    getSubscriptions() const
+    {
+        return mSubscriptions;
+    }
+
+    /**
+     * Number of subscriptions registered at any SubscriptionFilter for this IDType. Used to
+     * detect when a RoutingTable has to be rebuilt.
+     */
+    static inline uint32_t
+    getNumberOfModifications()
+    {
+        return mNumberOfModifications.get();
+    }
+
 protected:
     bool
     filter(const IDType& id, const outpost::Slice<const uint8_t>&) const override
@@ -136,10 +154,15 @@ protected:
     }
 
 private:
+    static outpost::utils::StatisticsCounter mNumberOfModifications;
+
     outpost::List<BusSubscription<IDType>> mSubscriptions;
     size_t mSubscriptionCount = 0;
 };
 
+template <typename IDType>
+outpost::utils::StatisticsCounter SubscriptionFilter<IDType>::mNumberOfModifications;
+
 /**
  * Only allows IDs within range [min, max], requires IDType to have boolean <= and >= operators.
  * \ingroup swb
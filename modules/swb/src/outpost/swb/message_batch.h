@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_SWB_MESSAGE_BATCH_H
+#define OUTPOST_SWB_MESSAGE_BATCH_H
+
+#include "types.h"
+
+#include <outpost/base/slice.h>
+#include <outpost/time/duration.h>
+
+#include <stddef.h>
+
+#include <array>
+
+namespace outpost
+{
+namespace swb
+{
+template <typename IDType>
+class BusHandlerThread;
+
+/**
+ * Buffer for the batch mode of a BusDistributor.
+ *
+ * In batch mode the BusHandlerThread takes up to getMaximumNumberOfMessages()
+ * Message from its queue per wakeup and offers all of them to a BusChannel at
+ * once, a BufferedBusChannel appends them under a single lock.
+ *
+ * After the first Message of a batch has arrived, the thread waits at most
+ * getMaximumLatency() for further Message to fill the batch. With a latency
+ * of zero only the Message already waiting in the queue are batched, which
+ * adds no delay.
+ *
+ * \ingroup swb
+ * \param IDType type of the message ID
+ */
+template <typename IDType>
+class MessageBatchBase
+{
+    friend class BusHandlerThread<IDType>;
+
+public:
+    /**
+     * \param messages Storage for the Message of one batch.
+     * \param accepted Storage for the result of one batch, same size as messages.
+     * \param maximumLatency Time to wait for further Message after the first one.
+     */
+    MessageBatchBase(outpost::Slice<Message<IDType>> messages,
+                     outpost::Slice<bool> accepted,
+                     outpost::time::Duration maximumLatency) :
+        mMessages(messages), mAccepted(accepted), mMaximumLatency(maximumLatency)
+    {
+    }
+
+    virtual ~MessageBatchBase() = default;
+
+    inline size_t
+    getMaximumNumberOfMessages() const
+    {
+        return mMessages.getNumberOfElements();
+    }
+
+    inline outpost::time::Duration
+    getMaximumLatency() const
+    {
+        return mMaximumLatency;
+    }
+
+private:
+    // disable copy constructor
+    MessageBatchBase(const MessageBatchBase&);
+
+    // disable copy-assignment operator
+    MessageBatchBase&
+    operator=(const MessageBatchBase&);
+
+    outpost::Slice<Message<IDType>> mMessages;
+    outpost::Slice<bool> mAccepted;
+    const outpost::time::Duration mMaximumLatency;
+};
+
+template <typename IDType, size_t N>
+class MessageBatchMemory
+{
+protected:
+    std::array<Message<IDType>, N> mMessageStorage;
+    std::array<bool, N> mAcceptedStorage;
+};
+
+/**
+ * MessageBatch with internal storage.
+ *
+ * \ingroup swb
+ * \param IDType type of the message ID
+ * \param N maximum number of Message per batch
+ */
+template <typename IDType, size_t N>
+class MessageBatch : private MessageBatchMemory<IDType, N>, public MessageBatchBase<IDType>
+{
+    using Memory = MessageBatchMemory<IDType, N>;
+
+public:
+    static_assert(N > 0, "A batch needs at least one Message");
+
+    explicit MessageBatch(
+            outpost::time::Duration maximumLatency = outpost::time::Duration::zero()) :
+        Memory(),
+        MessageBatchBase<IDType>(outpost::asSlice(Memory::mMessageStorage),
+                                 outpost::asSlice(Memory::mAcceptedStorage),
+                                 maximumLatency)
+    {
+    }
+
+    virtual ~MessageBatch() = default;
+};
+
+}  // namespace swb
+}  // namespace outpost
+
+#endif
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_SWB_ROUTING_TABLE_H
+#define OUTPOST_SWB_ROUTING_TABLE_H
+
+#include "bus_channel.h"
+#include "types.h"
+
+#include <outpost/base/slice.h>
+#include <outpost/utils/container/list.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <type_traits>
+
+namespace outpost
+{
+namespace swb
+{
+/**
+ * Index of the BusChannel of a SoftwareBus by message id.
+ *
+ * Channels whose filter is a SubscriptionFilter are indexed by their
+ * subscriptions. The subscriptions are grouped by their mask, each
+ * (mask, id & mask) pair is stored in a hash table. Exact subscriptions
+ * are the group with all bits of the mask set. Forwarding a Message
+ * therefore costs one hash lookup per distinct mask plus the matching
+ * channels, independent of the total number of channels.
+ *
+ * Channels with other filters are treated as matching every id, they
+ * receive every Message as without a routing table and filter it
+ * themselves.
+ *
+ * The table is built by the BusDistributor when it is set and rebuilt
+ * when channels or subscriptions are registered. If the capacity of
+ * the table is too small, the BusDistributor forwards every Message to
+ * every channel as without a routing table.
+ *
+ * \ingroup swb
+ * \param IDType type of the message ID
+ */
+template <typename IDType>
+class RoutingTableBase
+{
+    static_assert(std::is_integral<IDType>::value, "Message id must be an integral type");
+
+public:
+    struct Entry
+    {
+        IDType id;
+        IDType mask;
+        uint16_t channel;
+        uint16_t next;
+    };
+
+    struct Channel
+    {
+        BusChannel<IDType>* channel;
+
+        // Number of the last Message forwarded to the channel
+        uint32_t lastMessage;
+    };
+
+    static constexpr uint16_t noEntry = 0xFFFFU;
+
+    /**
+     * \param channels Storage for the indexed channels.
+     * \param entries Storage for the subscriptions of all channels.
+     * \param buckets Hash table, should be larger than the number of entries.
+     * \param masks Storage for the distinct masks of the subscriptions.
+     */
+    RoutingTableBase(outpost::Slice<Channel> channels,
+                     outpost::Slice<Entry> entries,
+                     outpost::Slice<uint16_t> buckets,
+                     outpost::Slice<IDType> masks);
+
+    virtual ~RoutingTableBase() = default;
+
+    /**
+     * Rebuild the table for the given channels.
+     * \return Returns false if the capacity of the table is too small.
+     */
+    bool
+    build(outpost::List<BusChannel<IDType>>& channels);
+
+    /**
+     * Forward a Message to all matching channels.
+     * \return Returns true if at least one channel has accepted the Message.
+     */
+    bool
+    forward(const Message<IDType>& message);
+
+    inline bool
+    isValid() const
+    {
+        return mValid;
+    }
+
+    inline size_t
+    getNumberOfChannels() const
+    {
+        return mNumberOfChannels;
+    }
+
+    inline size_t
+    getNumberOfEntries() const
+    {
+        return mNumberOfEntries;
+    }
+
+    inline size_t
+    getNumberOfMasks() const
+    {
+        return mNumberOfMasks;
+    }
+
+private:
+    // disable copy constructor
+    RoutingTableBase(const RoutingTableBase&);
+
+    // disable copy-assignment operator
+    RoutingTableBase&
+    operator=(const RoutingTableBase&);
+
+    size_t
+    getBucket(IDType id, IDType mask) const;
+
+    bool
+    addEntry(IDType id, IDType mask, uint16_t channel);
+
+    bool
+    addMask(IDType mask);
+
+    outpost::Slice<Channel> mChannels;
+    outpost::Slice<Entry> mEntries;
+    outpost::Slice<uint16_t> mBuckets;
+    outpost::Slice<IDType> mMasks;
+
+    size_t mNumberOfChannels;
+    size_t mNumberOfEntries;
+    size_t mNumberOfMasks;
+
+    uint32_t mMessageNumber;
+    bool mValid;
+};
+
+template <typename IDType, size_t numberOfChannels, size_t numberOfEntries, size_t numberOfMasks>
+class RoutingTableMemory
+{
+protected:
+    typename RoutingTableBase<IDType>::Channel mChannelStorage[numberOfChannels];
+    typename RoutingTableBase<IDType>::Entry mEntryStorage[numberOfEntries];
+    uint16_t mBucketStorage[2 * numberOfEntries];
+    IDType mMaskStorage[numberOfMasks];
+};
+
+/**
+ * RoutingTable with internal storage.
+ *
+ * \ingroup swb
+ * \param IDType type of the message ID
+ * \param numberOfChannels maximum number of registered channels
+ * \param numberOfEntries maximum number of subscriptions of all channels, channels without
+ *                        SubscriptionFilter need one entry
+ * \param numberOfMasks maximum number of distinct subscription masks
+ */
+template <typename IDType,
+          size_t numberOfChannels,
+          size_t numberOfEntries,
+          size_t numberOfMasks = 8>
+class RoutingTable
+    : private RoutingTableMemory<IDType, numberOfChannels, numberOfEntries, numberOfMasks>,
+      public RoutingTableBase<IDType>
+{
+    using Memory = RoutingTableMemory<IDType, numberOfChannels, numberOfEntries, numberOfMasks>;
+
+public:
+    static_assert(numberOfChannels < RoutingTableBase<IDType>::noEntry, "Too many channels");
+    static_assert(numberOfEntries < RoutingTableBase<IDType>::noEntry, "Too many entries");
+
+    RoutingTable() :
+        Memory(),
+        RoutingTableBase<IDType>(outpost::asSlice(Memory::mChannelStorage),
+                                 outpost::asSlice(Memory::mEntryStorage),
+                                 outpost::asSlice(Memory::mBucketStorage),
+                                 outpost::asSlice(Memory::mMaskStorage))
+    {
+    }
+
+    virtual ~RoutingTable() = default;
+};
+
+}  // namespace swb
+}  // namespace outpost
+
+#include "routing_table_impl.h"
+
+#endif
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_SWB_ROUTING_TABLE_IMPL_H
+#define OUTPOST_SWB_ROUTING_TABLE_IMPL_H
+
+#include "routing_table.h"
+
+namespace outpost
+{
+namespace swb
+{
+template <typename IDType>
+constexpr uint16_t RoutingTableBase<IDType>::noEntry;
+
+template <typename IDType>
+RoutingTableBase<IDType>::RoutingTableBase(outpost::Slice<Channel> channels,
+                                           outpost::Slice<Entry> entries,
+                                           outpost::Slice<uint16_t> buckets,
+                                           outpost::Slice<IDType> masks) :
+    mChannels(channels),
+    mEntries(entries),
+    mBuckets(buckets),
+    mMasks(masks),
+    mNumberOfChannels(0),
+    mNumberOfEntries(0),
+    mNumberOfMasks(0),
+    mMessageNumber(0),
+    mValid(false)
+{
+}
+
+template <typename IDType>
+size_t
+RoutingTableBase<IDType>::getBucket(IDType id, IDType mask) const
+{
+    uint32_t hash = static_cast<uint32_t>(id) ^ (static_cast<uint32_t>(mask) * 0x9E3779B9U);
+    hash *= 0x85EBCA6BU;
+    hash ^= hash >> 16;
+    return hash % mBuckets.getNumberOfElements();
+}
+
+template <typename IDType>
+bool
+RoutingTableBase<IDType>::addMask(IDType mask)
+{
+    for (size_t i = 0; i < mNumberOfMasks; i++)
+    {
+        if (mMasks[i] == mask)
+        {
+            return true;
+        }
+    }
+    if (mNumberOfMasks >= mMasks.getNumberOfElements())
+    {
+        return false;
+    }
+    mMasks[mNumberOfMasks] = mask;
+    mNumberOfMasks++;
+    return true;
+}
+
+template <typename IDType>
+bool
+RoutingTableBase<IDType>::addEntry(IDType id, IDType mask, uint16_t channel)
+{
+    const size_t bucket = getBucket(id, mask);
+    for (uint16_t index = mBuckets[bucket]; index != noEntry; index = mEntries[index].next)
+    {
+        const Entry& entry = mEntries[index];
+        if ((entry.id == id) && (entry.mask == mask) && (entry.channel == channel))
+        {
+            // Duplicate subscription of the same channel
+            return true;
+        }
+    }
+
+    if ((mNumberOfEntries >= mEntries.getNumberOfElements()) || !addMask(mask))
+    {
+        return false;
+    }
+    Entry& entry = mEntries[mNumberOfEntries];
+    entry.id = id;
+    entry.mask = mask;
+    entry.channel = channel;
+    entry.next = mBuckets[bucket];
+    mBuckets[bucket] = static_cast<uint16_t>(mNumberOfEntries);
+    mNumberOfEntries++;
+    return true;
+}
+
+template <typename IDType>
+bool
+RoutingTableBase<IDType>::build(outpost::List<BusChannel<IDType>>& channels)
+{
+    mNumberOfChannels = 0;
+    mNumberOfEntries = 0;
+    mNumberOfMasks = 0;
+    mMessageNumber = 0;
+    mBuckets.fill(noEntry);
+
+    mValid = (mBuckets.getNumberOfElements() > 0);
+    for (auto it = channels.begin(); mValid && (it != channels.end()); ++it)
+    {
+        if (mNumberOfChannels >= mChannels.getNumberOfElements())
+        {
+            mValid = false;
+            break;
+        }
+        const uint16_t index = static_cast<uint16_t>(mNumberOfChannels);
+        mChannels[index].channel = &(*it);
+        mChannels[index].lastMessage = 0;
+        mNumberOfChannels++;
+
+        const SubscriptionFilter<IDType>* filter = it->getSubscriptionFilter();
+        if (filter == nullptr)
+        {
+            // Channel has to check every message itself
+            mValid = addEntry(IDType(), IDType(), index);
+        }
+        else
+        {
+            const outpost::List<BusSubscription<IDType>>& subscriptions =
+                    filter->getSubscriptions();
+            for (auto sub = subscriptions.begin(); mValid && (sub != subscriptions.end()); ++sub)
+            {
+                mValid = addEntry(sub->getMessageId(), sub->getMask(), index);
+            }
+        }
+    }
+    return mValid;
+}
+
+template <typename IDType>
+bool
+RoutingTableBase<IDType>::forward(const Message<IDType>& message)
+{
+    mMessageNumber++;
+    if (mMessageNumber == 0)
+    {
+        // Numbers of earlier messages must not match after the wrap-around
+        for (size_t i = 0; i < mNumberOfChannels; i++)
+        {
+            mChannels[i].lastMessage = 0;
+        }
+        mMessageNumber = 1;
+    }
+
+    bool isForwarded = false;
+    for (size_t i = 0; i < mNumberOfMasks; i++)
+    {
+        const IDType mask = mMasks[i];
+        const IDType id = message.id & mask;
+        for (uint16_t index = mBuckets[getBucket(id, mask)]; index != noEntry;
+             index = mEntries[index].next)
+        {
+            const Entry& entry = mEntries[index];
+            Channel& channel = mChannels[entry.channel];
+            // A channel may match several subscriptions but gets the message only once
+            if ((entry.id == id) && (entry.mask == mask) && (channel.lastMessage != mMessageNumber))
+            {
+                channel.lastMessage = mMessageNumber;
+                if (OperationResult::success == channel.channel->sendMessage(message))
+                {
+                    isForwarded = true;
+                }
+            }
+        }
+    }
+    return isForwarded;
+}
+
+}  // namespace swb
+}  // namespace outpost
+
+#endif
@@ -21,6 +21,7 @@
 #include "types.h"
 
 #include <outpost/utils/container/shared_buffer.h>
+#include <outpost/utils/statistics_counter.h>
 
 #include <stdint.h>
 
@@ -62,6 +63,10 @@ enum class CopyMode : uint8_t
  * Senders can sent Message from their own memory pool or use the bus' pool. Receiver can register
  * channels that filter for certain types of Message using their id and/ or data. Houskeeping is
  * also provided through a number of counters.
+ *
+ * Sending does not take a lock of the bus. Several threads may send concurrently, they are only
+ * serialized by the queue. With an outpost::utils::MpscReferenceQueue sending is lock-free if
+ * the pool of the bus is lock-free as well.
  * \ingroup swb
  * \param IDType type of the message ID
  */
@@ -120,7 +125,7 @@ public:
     inline uint32_t
     getNumberOfDeclinedMessages() const
     {
-        return mNumberOfInvalidMessages;
+        return mNumberOfInvalidMessages.get();
     }
 
     /**
@@ -131,7 +136,7 @@ public:
     inline uint32_t
     getNumberOfFailedCopyOperations() const
     {
-        return mNumberOfFailedCopyOperations;
+        return mNumberOfFailedCopyOperations.get();
     }
 
     /**
@@ -141,7 +146,7 @@ public:
     inline uint32_t
     getNumberOfFailedSendOperations() const
     {
-        return mNumberOfFailedSendOperations;
+        return mNumberOfFailedSendOperations.get();
     }
 
     /**
@@ -151,12 +156,15 @@ public:
     inline uint32_t
     getNumberOfAcceptedMessages() const
     {
-        return mNumberOfAcceptedMessages;
+        return mNumberOfAcceptedMessages.get();
     }
 
 protected:
     /**
-     * Checks an incoming message for validity.
+     * Checks an incoming message for validity. Called once per message.
+     *
+     * May be called concurrently by several sending threads and must therefore not modify
+     * shared state.
      * \return Returns true if the message is valid for sending, false otherwise.
      */
     virtual bool
@@ -170,15 +178,19 @@ private:
     copySliceToBuffer(const outpost::Slice<const uint8_t>& slice,
                       outpost::utils::ConstSharedBufferPointer& buffer);
 
-    outpost::rtos::Mutex mMutex;
+    /**
+     * Adds an already validated message to the queue.
+     */
+    OperationResult
+    enqueue(Message<IDType>& msg);
 
     outpost::utils::SharedBufferPoolBase& mPool;
     outpost::utils::ReferenceQueueBase<Message<IDType>>& mQueue;
 
-    uint32_t mNumberOfInvalidMessages;
-    uint32_t mNumberOfFailedCopyOperations;
-    uint32_t mNumberOfFailedSendOperations;
-    uint32_t mNumberOfAcceptedMessages;
+    outpost::utils::StatisticsCounter mNumberOfInvalidMessages;
+    outpost::utils::StatisticsCounter mNumberOfFailedCopyOperations;
+    outpost::utils::StatisticsCounter mNumberOfFailedSendOperations;
+    outpost::utils::StatisticsCounter mNumberOfAcceptedMessages;
 };
 
 /**
@@ -29,13 +29,7 @@ SoftwareBus<IDType>::SoftwareBus(outpost::utils::SharedBufferPoolBase& pool,
                                  outpost::utils::ReferenceQueueBase<Message<IDType>>& queue,
                                  uint8_t priority,
                                  outpost::support::parameter::HeartbeatSource heartbeatSource) :
-    BusDistributor<IDType>(queue, priority, heartbeatSource),
-    mPool(pool),
-    mQueue(queue),
-    mNumberOfInvalidMessages(0U),
-    mNumberOfFailedCopyOperations(0U),
-    mNumberOfFailedSendOperations(0U),
-    mNumberOfAcceptedMessages(0U)
+    BusDistributor<IDType>(queue, priority, heartbeatSource), mPool(pool), mQueue(queue)
 {
 }
 
@@ -43,23 +37,21 @@ template <typename IDType>
 OperationResult
 SoftwareBus<IDType>::sendMessage(const IDType id, const outpost::Slice<const uint8_t>& data)
 {
-    outpost::rtos::MutexGuard lock(mMutex);
     if (!valid(id, data))
     {
-        mNumberOfInvalidMessages++;
+        mNumberOfInvalidMessages.increment();
         return OperationResult::invalidMessage;
     }
     outpost::utils::ConstSharedBufferPointer buffer;
     OperationResult res = copySliceToBuffer(data, buffer);
-    if (OperationResult::success == res)
+    if (OperationResult::success != res)
     {
-        return sendMessage(id, buffer, CopyMode::zero_copy);
+        mNumberOfFailedCopyOperations.increment();
+        return res;
     }
-    else
-    {
-        mNumberOfFailedCopyOperations++;
-    }
-    return res;
+
+    Message<IDType> msg = {id, buffer};
+    return enqueue(msg);
 }
 
 template <typename IDType>
@@ -68,10 +60,9 @@ SoftwareBus<IDType>::sendMessage(const IDType id,
                                  const outpost::utils::ConstSharedBufferPointer& buffer,
                                  CopyMode mode)
 {
-    outpost::rtos::MutexGuard lock(mMutex);
     if (!valid(id, buffer.asSlice()))
     {
-        mNumberOfInvalidMessages++;
+        mNumberOfInvalidMessages.increment();
         return OperationResult::invalidMessage;
     }
 
@@ -81,7 +72,7 @@ SoftwareBus<IDType>::sendMessage(const IDType id,
         OperationResult res = copySliceToBuffer(buffer.asSlice(), tmpBuffer);
         if (OperationResult::success != res)
         {
-            mNumberOfFailedCopyOperations++;
+            mNumberOfFailedCopyOperations.increment();
             return res;
         }
     }
@@ -91,28 +82,33 @@ SoftwareBus<IDType>::sendMessage(const IDType id,
     }
 
     Message<IDType> msg = {id, tmpBuffer};
-    return sendMessage(msg);
+    return enqueue(msg);
 }
 
 template <typename IDType>
 OperationResult
 SoftwareBus<IDType>::sendMessage(Message<IDType>& msg)
 {
-    outpost::rtos::MutexGuard lock(mMutex);
     if (!valid(msg.id, msg.buffer.asSlice()))
     {
-        mNumberOfInvalidMessages++;
+        mNumberOfInvalidMessages.increment();
         return OperationResult::invalidMessage;
     }
+    return enqueue(msg);
+}
 
+template <typename IDType>
+OperationResult
+SoftwareBus<IDType>::enqueue(Message<IDType>& msg)
+{
     if (mQueue.send(msg))
     {
-        mNumberOfAcceptedMessages++;
+        mNumberOfAcceptedMessages.increment();
         return OperationResult::success;
     }
     else
     {
-        mNumberOfFailedSendOperations++;
+        mNumberOfFailedSendOperations.increment();
         return OperationResult::sendFailed;
     }
 }
@@ -131,7 +127,7 @@ SoftwareBus<IDType>::copySliceToBuffer(const outpost::Slice<const uint8_t>& slic
     else if (slice.getNumberOfElements() <= mPool.getElementSize())
     {
         outpost::utils::SharedBufferPointer tmp;
-        if (mPool.allocate(tmp))
+        if (mPool.allocate(tmp, slice.getNumberOfElements()))
         {
             tmp.asSlice().copyFrom(slice);
             outpost::utils::SharedChildPointer c;
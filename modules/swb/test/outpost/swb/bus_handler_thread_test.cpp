@@ -104,3 +104,175 @@ TEST_F(BusHandlerThreadTest, handlerTest)
 
     EXPECT_TRUE(channel.receiveMessage(m) == outpost::swb::OperationResult::noMessageAvailable);
 }
+
+// ----------------------------------------------------------------------------
+class BusHandlerThreadBatchTest : public ::testing::Test
+{
+public:
+    BusHandlerThreadBatchTest() :
+        mBus(mPool, mQueue, 1U, outpost::support::parameter::HeartbeatSource::default0),
+        mTestingBus(mBus),
+        mFirst(1U),
+        mSecond(2U)
+    {
+        mFirstChannel.getFilter().registerSubscription(mFirst);
+        mSecondChannel.getFilter().registerSubscription(mSecond);
+        mBus.registerChannel(mFirstChannel);
+        mBus.registerChannel(mSecondChannel);
+        mBus.registerChannel(mAllChannel);
+        mBus.setDefaultChannel(mDefaultChannel);
+    }
+
+    void
+    send(uint16_t id)
+    {
+        outpost::utils::SharedBufferPointer p;
+        ASSERT_TRUE(mPool.allocate(p));
+        p[0] = static_cast<uint8_t>(mNumberOfSentMessages++);
+        outpost::swb::Message<uint16_t> message = {id, p};
+        ASSERT_EQ(OperationResult::success, mBus.sendMessage(message));
+    }
+
+    using SubscriptionChannel =
+            BufferedBusChannelWithMemory<10, uint16_t, SubscriptionFilter<uint16_t>>;
+
+    outpost::utils::SharedBufferPool<16, 10> mPool;
+    outpost::utils::ReferenceQueue<outpost::swb::Message<uint16_t>, 10> mQueue;
+    outpost::swb::SoftwareBus<uint16_t> mBus;
+    unittest::swb::TestingSoftwareBus mTestingBus;
+
+    BusSubscription<uint16_t> mFirst;
+    BusSubscription<uint16_t> mSecond;
+    SubscriptionChannel mFirstChannel;
+    SubscriptionChannel mSecondChannel;
+    BufferedBusChannelWithMemory<10, uint16_t> mAllChannel;
+    BufferedBusChannelWithMemory<10, uint16_t> mDefaultChannel;
+
+    uint8_t mNumberOfSentMessages = 0;
+};
+
+TEST_F(BusHandlerThreadBatchTest, handlesBatchPerStep)
+{
+    outpost::swb::MessageBatch<uint16_t, 4> batch;
+    mBus.setMessageBatch(batch);
+
+    const uint16_t ids[] = {1, 2, 1, 3, 2, 1};
+    for (uint16_t id : ids)
+    {
+        send(id);
+    }
+
+    EXPECT_TRUE(mTestingBus.singleMessage());
+    EXPECT_EQ(4U, mBus.getNumberOfHandledMessages());
+    EXPECT_EQ(2U, mFirstChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(1U, mSecondChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(4U, mAllChannel.getCurrentNumberOfMessages());
+
+    EXPECT_TRUE(mTestingBus.singleMessage());
+    EXPECT_FALSE(mTestingBus.singleMessage());
+    EXPECT_EQ(6U, mBus.getNumberOfHandledMessages());
+    EXPECT_EQ(3U, mFirstChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(2U, mSecondChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(6U, mAllChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(6U, mAllChannel.getNumberOfIncomingMessages());
+}
+
+TEST_F(BusHandlerThreadBatchTest, keepsOrderOfMessages)
+{
+    outpost::swb::MessageBatch<uint16_t, 4> batch;
+    mBus.setMessageBatch(batch);
+
+    const uint16_t ids[] = {1, 2, 1, 3, 2, 1};
+    for (uint16_t id : ids)
+    {
+        send(id);
+    }
+    mTestingBus.allMessages();
+
+    outpost::swb::Message<uint16_t> message;
+    for (uint8_t i = 0; i < 6; i++)
+    {
+        ASSERT_EQ(OperationResult::success, mAllChannel.receiveMessage(message));
+        EXPECT_EQ(ids[i], message.id);
+        EXPECT_EQ(i, message.buffer[0]);
+    }
+
+    const uint8_t first[] = {0, 2, 5};
+    for (uint8_t expected : first)
+    {
+        ASSERT_EQ(OperationResult::success, mFirstChannel.receiveMessage(message));
+        EXPECT_EQ(expected, message.buffer[0]);
+    }
+}
+
+TEST_F(BusHandlerThreadBatchTest, countsDefaultedMessages)
+{
+    outpost::swb::MessageBatch<uint16_t, 4> batch;
+    mBus.setMessageBatch(batch);
+
+    // Only accepted by the unfiltered channel
+    send(3);
+    mTestingBus.allMessages();
+    mBus.unregisterChannel(mAllChannel);
+    send(3);
+    send(1);
+    mTestingBus.allMessages();
+
+    EXPECT_EQ(3U, mBus.getNumberOfHandledMessages());
+    EXPECT_EQ(2U, mBus.getNumberOfForwardedMessages());
+    EXPECT_EQ(1U, mBus.getNumberOfDefaultedMessages());
+}
+
+TEST_F(BusHandlerThreadBatchTest, releasesBuffers)
+{
+    outpost::swb::MessageBatch<uint16_t, 8> batch;
+    mBus.setMessageBatch(batch);
+
+    send(1);
+    send(2);
+    mTestingBus.allMessages();
+
+    outpost::swb::Message<uint16_t> message;
+    while (mAllChannel.receiveMessage(message) == OperationResult::success)
+    {
+    }
+    while (mFirstChannel.receiveMessage(message) == OperationResult::success)
+    {
+    }
+    while (mSecondChannel.receiveMessage(message) == OperationResult::success)
+    {
+    }
+    message = outpost::swb::Message<uint16_t>();
+    EXPECT_EQ(10U, mPool.numberOfFreeElements());
+}
+
+TEST_F(BusHandlerThreadBatchTest, takesWaitingMessagesWithinLatency)
+{
+    outpost::swb::MessageBatch<uint16_t, 4> batch(outpost::time::Milliseconds(5));
+    mBus.setMessageBatch(batch);
+
+    send(1);
+    send(2);
+    EXPECT_TRUE(mTestingBus.singleMessage());
+    EXPECT_EQ(2U, mBus.getNumberOfHandledMessages());
+    EXPECT_EQ(1U, mFirstChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(1U, mSecondChannel.getCurrentNumberOfMessages());
+}
+
+TEST_F(BusHandlerThreadBatchTest, usesRoutingTable)
+{
+    outpost::swb::MessageBatch<uint16_t, 4> batch;
+    outpost::swb::RoutingTable<uint16_t, 4, 4> table;
+    mBus.setMessageBatch(batch);
+    mBus.setRoutingTable(table);
+
+    send(1);
+    send(2);
+    send(1);
+    mTestingBus.allMessages();
+
+    EXPECT_EQ(2U, mFirstChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(1U, mSecondChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(3U, mAllChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(2U, mFirstChannel.getNumberOfIncomingMessages());
+}
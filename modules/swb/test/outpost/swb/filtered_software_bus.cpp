@@ -41,6 +41,27 @@ public:
 };
 using MessageId = uint16_t;
 
+namespace
+{
+class CountingFilter : public MessageFilter<MessageId>
+{
+public:
+    CountingFilter() : mCalls(0)
+    {
+    }
+
+    mutable size_t mCalls;
+
+protected:
+    bool
+    filter(const MessageId&, const outpost::Slice<const uint8_t>&) const override
+    {
+        mCalls++;
+        return true;
+    }
+};
+}  // namespace
+
 TEST_F(FilteredSoftwareBusTest, constructor)
 {
     SoftwareBusFiltered<MessageId, RangeFilter<MessageId>> bus(
@@ -176,3 +197,26 @@ TEST_F(FilteredSoftwareBusTest, configureFilter)
     EXPECT_EQ(bus.getNumberOfHandledMessages(), 6U);
     EXPECT_EQ(bus.getNumberOfForwardedMessages(), 0U);
 }
+
+TEST_F(FilteredSoftwareBusTest, filterRunsOncePerMessage)
+{
+    SoftwareBusFiltered<MessageId, CountingFilter> bus(
+            mPool, mQueue, 123U, outpost::support::parameter::HeartbeatSource::default0);
+
+    uint8_t data[4] = {1, 2, 3, 4};
+    EXPECT_EQ(OperationResult::success, bus.sendMessage(1, outpost::asSlice(data)));
+    EXPECT_EQ(1U, bus.getFilter().mCalls);
+
+    outpost::utils::ConstSharedBufferPointer p;
+    ASSERT_TRUE(mPool.allocate(p));
+    EXPECT_EQ(OperationResult::success, bus.sendMessage(1, p, CopyMode::copy_once));
+    EXPECT_EQ(2U, bus.getFilter().mCalls);
+
+    EXPECT_EQ(OperationResult::success, bus.sendMessage(1, p, CopyMode::zero_copy));
+    EXPECT_EQ(3U, bus.getFilter().mCalls);
+
+    Message<MessageId> m{1, p};
+    EXPECT_EQ(OperationResult::success, bus.sendMessage(m));
+    EXPECT_EQ(4U, bus.getFilter().mCalls);
+    EXPECT_EQ(4U, bus.getNumberOfAcceptedMessages());
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/swb/bus_subscription.h>
+#include <outpost/swb/routing_table.h>
+#include <outpost/swb/software_bus.h>
+#include <outpost/utils/container/reference_queue.h>
+#include <outpost/utils/container/shared_object_pool.h>
+
+#include <unittest/harness.h>
+#include <unittest/swb/testing_software_bus.h>
+
+using namespace outpost::swb;
+
+using MessageId = uint16_t;
+using SubscriptionChannel =
+        BufferedBusChannelWithMemory<10, MessageId, SubscriptionFilter<MessageId>>;
+using UnfilteredChannel = BufferedBusChannelWithMemory<10, MessageId>;
+
+class RoutingTableTest : public ::testing::Test
+{
+public:
+    RoutingTableTest() :
+        mBus(mPool, mQueue, 123U, outpost::support::parameter::HeartbeatSource::default0),
+        mTestingBus(mBus),
+        mExact(0x0102),
+        mGroup(0x0200, 0xFF00),
+        mOverlapping(0x0205)
+    {
+        mExactChannel.getFilter().registerSubscription(mExact);
+        mGroupChannel.getFilter().registerSubscription(mGroup);
+        mGroupChannel.getFilter().registerSubscription(mOverlapping);
+        mBus.registerChannel(mExactChannel);
+        mBus.registerChannel(mGroupChannel);
+    }
+
+    void
+    send(MessageId id)
+    {
+        outpost::utils::ConstSharedBufferPointer p;
+        Message<MessageId> message{id, p};
+        ASSERT_EQ(OperationResult::success, mBus.sendMessage(message));
+        mTestingBus.allMessages();
+    }
+
+    outpost::utils::SharedBufferPool<16, 10> mPool;
+    outpost::utils::ReferenceQueue<Message<MessageId>, 10U> mQueue;
+    SoftwareBus<MessageId> mBus;
+    unittest::swb::TestingSoftwareBus mTestingBus;
+
+    BusSubscription<MessageId> mExact;
+    BusSubscription<MessageId> mGroup;
+    BusSubscription<MessageId> mOverlapping;
+
+    SubscriptionChannel mExactChannel;
+    SubscriptionChannel mGroupChannel;
+};
+
+TEST_F(RoutingTableTest, indexesSubscriptions)
+{
+    RoutingTable<MessageId, 4, 8> table;
+    mBus.setRoutingTable(table);
+
+    EXPECT_TRUE(table.isValid());
+    EXPECT_EQ(2U, table.getNumberOfChannels());
+    EXPECT_EQ(3U, table.getNumberOfEntries());
+    EXPECT_EQ(2U, table.getNumberOfMasks());
+}
+
+TEST_F(RoutingTableTest, forwardsOnlyToMatchingChannels)
+{
+    RoutingTable<MessageId, 4, 8> table;
+    mBus.setRoutingTable(table);
+
+    send(0x0102);
+    EXPECT_EQ(1U, mExactChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(0U, mGroupChannel.getCurrentNumberOfMessages());
+
+    // Matches both subscriptions of the group channel, delivered once
+    send(0x0205);
+    EXPECT_EQ(1U, mExactChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(1U, mGroupChannel.getCurrentNumberOfMessages());
+
+    // The exact channel is never asked for this message
+    EXPECT_EQ(1U, mExactChannel.getNumberOfIncomingMessages());
+    EXPECT_EQ(2U, mBus.getNumberOfForwardedMessages());
+}
+
+TEST_F(RoutingTableTest, keepsDefaultChannel)
+{
+    RoutingTable<MessageId, 4, 8> table;
+    mBus.setRoutingTable(table);
+    UnfilteredChannel defaultChannel;
+    ASSERT_EQ(OperationResult::success, mBus.setDefaultChannel(defaultChannel));
+
+    send(0x0300);
+    EXPECT_EQ(1U, defaultChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(1U, mBus.getNumberOfDefaultedMessages());
+    EXPECT_EQ(0U, mBus.getNumberOfForwardedMessages());
+
+    send(0x0102);
+    EXPECT_EQ(1U, defaultChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(1U, mBus.getNumberOfForwardedMessages());
+}
+
+TEST_F(RoutingTableTest, channelsWithOtherFiltersGetEveryMessage)
+{
+    RoutingTable<MessageId, 4, 8> table;
+    mBus.setRoutingTable(table);
+    UnfilteredChannel unfiltered;
+    mBus.registerChannel(unfiltered);
+
+    send(0x0300);
+    send(0x0102);
+    EXPECT_EQ(2U, unfiltered.getCurrentNumberOfMessages());
+    EXPECT_EQ(1U, mExactChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(3U, table.getNumberOfMasks());
+}
+
+TEST_F(RoutingTableTest, rebuildsForNewSubscriptions)
+{
+    RoutingTable<MessageId, 4, 8> table;
+    mBus.setRoutingTable(table);
+
+    BusSubscription<MessageId> late(0x0400);
+    mExactChannel.getFilter().registerSubscription(late);
+
+    send(0x0400);
+    EXPECT_EQ(1U, mExactChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(4U, table.getNumberOfEntries());
+}
+
+TEST_F(RoutingTableTest, fallsBackIfTableIsTooSmall)
+{
+    RoutingTable<MessageId, 4, 2> table;
+    mBus.setRoutingTable(table);
+    EXPECT_FALSE(table.isValid());
+
+    send(0x0205);
+    send(0x0102);
+    EXPECT_EQ(1U, mExactChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(1U, mGroupChannel.getCurrentNumberOfMessages());
+    EXPECT_EQ(2U, mExactChannel.getNumberOfIncomingMessages());
+}
+
+TEST_F(RoutingTableTest, deliversLikeLinearDispatch)
+{
+    RoutingTable<MessageId, 4, 8> table;
+    SubscriptionChannel linearExact;
+    SubscriptionChannel linearGroup;
+    BusSubscription<MessageId> exact(0x0102);
+    BusSubscription<MessageId> group(0x0200, 0xFF00);
+    BusSubscription<MessageId> overlapping(0x0205);
+    linearExact.getFilter().registerSubscription(exact);
+    linearGroup.getFilter().registerSubscription(group);
+    linearGroup.getFilter().registerSubscription(overlapping);
+
+    outpost::utils::ReferenceQueue<Message<MessageId>, 10U> queue;
+    SoftwareBus<MessageId> linearBus(
+            mPool, queue, 123U, outpost::support::parameter::HeartbeatSource::default0);
+    unittest::swb::TestingSoftwareBus testingLinearBus(linearBus);
+    linearBus.registerChannel(linearExact);
+    linearBus.registerChannel(linearGroup);
+    mBus.setRoutingTable(table);
+
+    Message<MessageId> received;
+    for (uint32_t i = 0; i < 0x400; i += 3)
+    {
+        const MessageId id = static_cast<MessageId>(i);
+        send(id);
+        outpost::utils::ConstSharedBufferPointer p;
+        Message<MessageId> message{id, p};
+        ASSERT_EQ(OperationResult::success, linearBus.sendMessage(message));
+        testingLinearBus.allMessages();
+
+        EXPECT_EQ(linearExact.getCurrentNumberOfMessages(),
+                  mExactChannel.getCurrentNumberOfMessages());
+        EXPECT_EQ(linearGroup.getCurrentNumberOfMessages(),
+                  mGroupChannel.getCurrentNumberOfMessages());
+        while (linearExact.receiveMessage(received) == OperationResult::success)
+        {
+            ASSERT_EQ(OperationResult::success, mExactChannel.receiveMessage(received));
+            EXPECT_EQ(id, received.id);
+        }
+        while (linearGroup.receiveMessage(received) == OperationResult::success)
+        {
+            ASSERT_EQ(OperationResult::success, mGroupChannel.receiveMessage(received));
+            EXPECT_EQ(id, received.id);
+        }
+    }
+}
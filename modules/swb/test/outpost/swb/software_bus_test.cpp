@@ -13,10 +13,16 @@
 
 #include <outpost/swb/default_message_filter.h>
 #include <outpost/swb/software_bus.h>
+#include <outpost/utils/container/mpsc_reference_queue.h>
+#include <outpost/utils/container/segregated_shared_buffer_pool.h>
 
 #include <unittest/harness.h>
 #include <unittest/swb/testing_software_bus.h>
 
+#include <array>
+#include <functional>
+#include <future>
+
 using namespace outpost::swb;
 
 class SoftwareBusTest : public ::testing::Test
@@ -41,6 +47,25 @@ public:
 };
 using MessageId = uint16_t;
 
+namespace
+{
+constexpr uint32_t numberOfSenders = 4;
+constexpr uint32_t messagesPerSender = 16;
+
+/**
+ * Sends a numbered sequence of messages with its own id.
+ */
+void
+sendSequence(SoftwareBus<MessageId>& bus, MessageId id)
+{
+    for (uint32_t i = 0; i < messagesPerSender; i++)
+    {
+        uint8_t data[2] = {static_cast<uint8_t>(id), static_cast<uint8_t>(i)};
+        bus.sendMessage(id, outpost::asSlice(data));
+    }
+}
+}  // namespace
+
 TEST_F(SoftwareBusTest, constructorTest)
 {
     SoftwareBus<MessageId> bus(
@@ -222,6 +247,66 @@ TEST_F(SoftwareBusTest, sendOverlongSlice)
     EXPECT_EQ(bus.getNumberOfDefaultedMessages(), 0U);
 }
 
+TEST_F(SoftwareBusTest, sendSliceUsesSmallestSizeClass)
+{
+    outpost::utils::SharedBufferPool<32, 2> smallBuffers;
+    outpost::utils::SharedBufferPool<1024, 1> largeBuffers;
+    outpost::utils::SharedBufferPoolBase* sizeClasses[] = {&smallBuffers, &largeBuffers};
+    outpost::utils::SegregatedSharedBufferPool pool(outpost::asSlice(sizeClasses));
+    SoftwareBus<MessageId> bus(
+            pool, mQueue, 123U, outpost::support::parameter::HeartbeatSource::default0);
+
+    uint8_t buffer[1025] = {};
+    outpost::Slice<uint8_t> slice(buffer);
+    EXPECT_EQ(OperationResult::success, bus.sendMessage(0, slice.first(20)));
+    EXPECT_EQ(OperationResult::success, bus.sendMessage(0, slice.first(32)));
+    EXPECT_EQ(OperationResult::success, bus.sendMessage(0, slice.first(20)));
+    EXPECT_EQ(0U, smallBuffers.numberOfFreeElements());
+    EXPECT_EQ(0U, largeBuffers.numberOfFreeElements());
+
+    EXPECT_EQ(OperationResult::messageTooLong, bus.sendMessage(0, slice));
+    EXPECT_EQ(3U, bus.getNumberOfAcceptedMessages());
+}
+
+TEST_F(SoftwareBusTest, concurrentSenders)
+{
+    outpost::utils::SharedBufferPool<2, numberOfSenders * messagesPerSender> pool;
+    outpost::utils::MpscReferenceQueue<Message<MessageId>, numberOfSenders * messagesPerSender>
+            queue;
+    SoftwareBus<MessageId> bus(
+            pool, queue, 123U, outpost::support::parameter::HeartbeatSource::default0);
+
+    std::array<std::future<void>, numberOfSenders> senders;
+    for (uint32_t i = 0; i < numberOfSenders; i++)
+    {
+        senders[i] = std::async(
+                std::launch::async, sendSequence, std::ref(bus), static_cast<MessageId>(i));
+    }
+    for (auto& sender : senders)
+    {
+        sender.get();
+    }
+
+    EXPECT_EQ(numberOfSenders * messagesPerSender, bus.getNumberOfAcceptedMessages());
+    EXPECT_EQ(0U, bus.getNumberOfFailedCopyOperations());
+
+    // Messages of each sender arrive in the order they were sent
+    std::array<uint8_t, numberOfSenders> next = {};
+    Message<MessageId> message;
+    while (queue.receive(message, outpost::time::Duration::zero()))
+    {
+        ASSERT_LT(message.id, numberOfSenders);
+        ASSERT_EQ(2U, message.buffer.getLength());
+        EXPECT_EQ(message.id, message.buffer[0]);
+        EXPECT_EQ(next[message.id], message.buffer[1]);
+        next[message.id]++;
+    }
+    for (auto count : next)
+    {
+        EXPECT_EQ(messagesPerSender, count);
+    }
+}
+
 TEST_F(SoftwareBusTest, sendValidSlice)
 {
     SoftwareBus<MessageId> bus(
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "benchmark.h"
+
+#include <outpost/rtos/semaphore.h>
+#include <outpost/rtos/thread.h>
+
+#include <stdio.h>
+
+#include <chrono>
+
+namespace
+{
+class BenchmarkThread : public outpost::rtos::Thread
+{
+public:
+    BenchmarkThread() :
+        outpost::rtos::Thread(1),
+        mIndex(0),
+        mFunction(nullptr),
+        mArgument(nullptr),
+        mStart(0),
+        mReady(nullptr),
+        mGo(nullptr),
+        mFinished(nullptr)
+    {
+    }
+
+    void
+    prepare(uint32_t index,
+            benchmark::Function function,
+            void* argument,
+            outpost::rtos::Semaphore& ready,
+            outpost::rtos::Semaphore& go,
+            outpost::rtos::Semaphore& finished)
+    {
+        mIndex = index;
+        mFunction = function;
+        mArgument = argument;
+        mReady = &ready;
+        mGo = &go;
+        mFinished = &finished;
+        mStart.release();
+    }
+
+protected:
+    void
+    run() override
+    {
+        while (true)
+        {
+            if (mStart.acquire())
+            {
+                mReady->release();
+                mGo->acquire();
+                mFunction(mIndex, mArgument);
+                mFinished->release();
+            }
+        }
+    }
+
+private:
+    uint32_t mIndex;
+    benchmark::Function mFunction;
+    void* mArgument;
+
+    outpost::rtos::Semaphore mStart;
+    outpost::rtos::Semaphore* mReady;
+    outpost::rtos::Semaphore* mGo;
+    outpost::rtos::Semaphore* mFinished;
+};
+
+BenchmarkThread threads[benchmark::maximumNumberOfThreads];
+bool threadsStarted = false;
+}  // namespace
+
+double
+benchmark::run(uint32_t numberOfThreads, Function function, void* argument)
+{
+    if (!threadsStarted)
+    {
+        for (auto& thread : threads)
+        {
+            thread.start();
+        }
+        threadsStarted = true;
+    }
+    if (numberOfThreads > maximumNumberOfThreads)
+    {
+        numberOfThreads = maximumNumberOfThreads;
+    }
+
+    outpost::rtos::Semaphore ready(0);
+    outpost::rtos::Semaphore go(0);
+    outpost::rtos::Semaphore finished(0);
+    for (uint32_t i = 0; i < numberOfThreads; i++)
+    {
+        threads[i].prepare(i, function, argument, ready, go, finished);
+    }
+    for (uint32_t i = 0; i < numberOfThreads; i++)
+    {
+        ready.acquire();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < numberOfThreads; i++)
+    {
+        go.release();
+    }
+    for (uint32_t i = 0; i < numberOfThreads; i++)
+    {
+        finished.acquire();
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return elapsed.count();
+}
+
+void
+benchmark::printResult(const char* name,
+                       uint32_t numberOfThreads,
+                       uint64_t operations,
+                       double seconds)
+{
+    printf("%-40s %2u threads: %8.2f Mops/s, %7.1f ns/op\n",
+           name,
+           static_cast<unsigned int>(numberOfThreads),
+           static_cast<double>(operations) / seconds / 1e6,
+           seconds * 1e9 / static_cast<double>(operations));
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdint.h>
+
+namespace benchmark
+{
+static constexpr uint32_t maximumNumberOfThreads = 16;
+
+/**
+ * Function executed by every thread of a benchmark run.
+ *
+ * \param threadIndex
+ *     Index of the thread in the range [0, numberOfThreads).
+ * \param argument
+ *     Argument given to run().
+ */
+typedef void (*Function)(uint32_t threadIndex, void* argument);
+
+/**
+ * Execute the function concurrently on the given number of threads.
+ *
+ * The threads are released at the same time, the measurement ends when
+ * the last thread has finished.
+ *
+ * \return
+ *     Elapsed wall clock time in seconds.
+ */
+double
+run(uint32_t numberOfThreads, Function function, void* argument);
+
+/**
+ * Print one line of results.
+ */
+void
+printResult(const char* name, uint32_t numberOfThreads, uint64_t operations, double seconds);
+
+// Benchmarks
+void
+sharedBufferContention();
+
+void
+sharedBufferPoolOccupancy();
+
+void
+sharedBufferCacheScaling();
+
+void
+referenceQueueThroughput();
+
+void
+crc32Throughput();
+
+}  // namespace benchmark
+
+#endif
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// Throughput of Crc32Reversed for blocks from 64 B to 1 MiB.
+//
+// The byte-wise path calls update(uint8_t) for every byte. The
+// slicing-by-8 path feeds update(Slice) with pieces shorter than the
+// minimum length of the carry-less multiplication kernel (64 bytes), the
+// PCLMUL path passes the whole block at once. All paths must yield the
+// same checksum.
+
+#include "benchmark.h"
+
+#include <outpost/base/slice.h>
+#include <outpost/utils/coding/crc32.h>
+
+#include <stdio.h>
+
+#include <chrono>
+
+using outpost::Crc32Reversed;
+
+namespace
+{
+constexpr size_t minimumBlockSize = 64;
+constexpr size_t maximumBlockSize = 1024 * 1024;
+
+// Number of bytes processed per measurement and path
+constexpr size_t bytesPerRun = 64 * 1024 * 1024;
+constexpr size_t bytesPerByteWiseRun = 8 * 1024 * 1024;
+
+// Multiple of the eight bytes of a slice, below the folding threshold
+constexpr size_t slicePieceSize = 56;
+
+uint8_t data[maximumBlockSize];
+
+uint32_t
+byteWise(outpost::Slice<const uint8_t> block)
+{
+    Crc32Reversed crc;
+    for (size_t i = 0; i < block.getNumberOfElements(); i++)
+    {
+        crc.update(block[i]);
+    }
+    return crc.getValue();
+}
+
+uint32_t
+slicingBy8(outpost::Slice<const uint8_t> block)
+{
+    Crc32Reversed crc;
+    size_t offset = 0;
+    while (offset < block.getNumberOfElements())
+    {
+        const size_t remaining = block.getNumberOfElements() - offset;
+        const size_t length = (remaining < slicePieceSize) ? remaining : slicePieceSize;
+        crc.update(block.subSlice(offset, length));
+        offset += length;
+    }
+    return crc.getValue();
+}
+
+uint32_t
+folded(outpost::Slice<const uint8_t> block)
+{
+    return Crc32Reversed::calculate(block);
+}
+
+/**
+ * \return Throughput in MiB/s
+ */
+double
+measure(uint32_t (*function)(outpost::Slice<const uint8_t>),
+        size_t blockSize,
+        size_t bytes,
+        uint32_t& checksum)
+{
+    const outpost::Slice<const uint8_t> block =
+            outpost::Slice<const uint8_t>(data).first(blockSize);
+    const size_t numberOfBlocks = (bytes + blockSize - 1) / blockSize;
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < numberOfBlocks; i++)
+    {
+        checksum = function(block);
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return static_cast<double>(numberOfBlocks * blockSize) / elapsed.count()
+           / (1024.0 * 1024.0);
+}
+}  // namespace
+
+void
+benchmark::crc32Throughput()
+{
+    uint32_t state = 1;
+    for (auto& value : data)
+    {
+        state = state * 1664525U + 1013904223U;
+        value = static_cast<uint8_t>(state >> 24);
+    }
+
+#if OUTPOST_CRC_CLMUL
+    const bool clmul = outpost::hasCarrylessMultiply();
+#else
+    const bool clmul = false;
+#endif
+
+    printf("Crc32Reversed, PCLMUL %s\n", clmul ? "available" : "not available");
+    printf("block size | byte-wise MiB/s | slicing-by-8 MiB/s | PCLMUL MiB/s\n");
+    for (size_t blockSize = minimumBlockSize; blockSize <= maximumBlockSize; blockSize *= 4)
+    {
+        uint32_t byteWiseChecksum = 0;
+        uint32_t slicingChecksum = 0;
+        uint32_t foldedChecksum = 0;
+        const double byteWiseSpeed =
+                measure(&byteWise, blockSize, bytesPerByteWiseRun, byteWiseChecksum);
+        const double slicingSpeed = measure(&slicingBy8, blockSize, bytesPerRun, slicingChecksum);
+        const double foldedSpeed = measure(&folded, blockSize, bytesPerRun, foldedChecksum);
+
+        printf("%10u | %15.1f | %18.1f | %12.1f\n",
+               static_cast<unsigned int>(blockSize),
+               byteWiseSpeed,
+               slicingSpeed,
+               foldedSpeed);
+        if ((slicingChecksum != byteWiseChecksum) || (foldedChecksum != byteWiseChecksum))
+        {
+            printf("Error: checksums differ for block size %u\n",
+                   static_cast<unsigned int>(blockSize));
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// Passing SharedBufferPointer from one thread to another.
+//
+// Thread 0 sends references to the same buffer, thread 1 receives them
+// with a blocking receive. The sender yields while the queue is full.
+
+#include "benchmark.h"
+
+#include <outpost/rtos/thread.h>
+#include <outpost/utils/container/mpsc_reference_queue.h>
+#include <outpost/utils/container/reference_queue.h>
+#include <outpost/utils/container/shared_object_pool.h>
+#include <outpost/utils/container/spsc_reference_queue.h>
+
+#include <stdio.h>
+
+using namespace outpost::utils;
+
+namespace
+{
+constexpr uint32_t numberOfMessages = 200000;
+constexpr size_t queueSize = 32;
+
+SharedBufferPool<64, 1> pool;
+
+template <typename Queue>
+void
+transfer(uint32_t threadIndex, void* argument)
+{
+    Queue& queue = *static_cast<Queue*>(argument);
+    if (threadIndex == 0)
+    {
+        SharedBufferPointer pointer;
+        pool.allocate(pointer);
+        for (uint32_t i = 0; i < numberOfMessages; i++)
+        {
+            while (!queue.send(pointer))
+            {
+                outpost::rtos::Thread::yield();
+            }
+        }
+    }
+    else
+    {
+        SharedBufferPointer pointer;
+        for (uint32_t i = 0; i < numberOfMessages; i++)
+        {
+            if (!queue.receive(pointer, outpost::time::Seconds(10)))
+            {
+                printf("Error: message %u not received\n", static_cast<unsigned int>(i));
+                return;
+            }
+        }
+    }
+}
+
+template <typename Queue>
+void
+measure(const char* name)
+{
+    static Queue queue;
+    const double seconds = benchmark::run(2, &transfer<Queue>, &queue);
+    benchmark::printResult(name, 2, numberOfMessages, seconds);
+}
+}  // namespace
+
+void
+benchmark::referenceQueueThroughput()
+{
+    printf("Passing SharedBufferPointer from one thread to another\n");
+
+    measure<ReferenceQueue<SharedBufferPointer, queueSize>>("ReferenceQueue");
+    measure<MpscReferenceQueue<SharedBufferPointer, queueSize>>("MpscReferenceQueue");
+    measure<SpscReferenceQueue<SharedBufferPointer, queueSize>>("SpscReferenceQueue");
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// Allocation from one pool by several threads.
+//
+// Every thread allocates a few buffers and releases them again, either
+// directly from the pool or through a SharedBufferCache of its own with
+// different magazine sizes. The released buffers are always returned to
+// the free list of the pool, only the allocation is batched.
+
+#include "benchmark.h"
+
+#include <outpost/utils/container/shared_buffer_cache.h>
+
+#include <stdio.h>
+
+#include <array>
+
+using namespace outpost::utils;
+
+namespace
+{
+constexpr uint32_t iterations = 200000;
+constexpr size_t buffersPerIteration = 4;
+
+// Enough buffers for the largest magazine of every thread
+constexpr size_t poolSize = 1024;
+typedef SharedBufferPool<64, poolSize> Pool;
+
+template <typename Allocator>
+void
+allocateAndRelease(Allocator& allocator)
+{
+    std::array<SharedBufferPointer, buffersPerIteration> pointers;
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        for (auto& pointer : pointers)
+        {
+            allocator.allocate(pointer);
+        }
+        for (auto& pointer : pointers)
+        {
+            pointer = SharedBufferPointer();
+        }
+    }
+}
+
+void
+allocateFromPool(uint32_t, void* argument)
+{
+    allocateAndRelease(*static_cast<Pool*>(argument));
+}
+
+template <size_t magazineSize>
+void
+allocateFromCache(uint32_t, void* argument)
+{
+    SharedBufferCache<magazineSize> cache(*static_cast<Pool*>(argument));
+    allocateAndRelease(cache);
+}
+
+void
+measure(const char* name, benchmark::Function function, Pool& pool)
+{
+    for (uint32_t threads = 1; threads <= benchmark::maximumNumberOfThreads; threads *= 2)
+    {
+        const double seconds = benchmark::run(threads, function, &pool);
+        benchmark::printResult(
+                name, threads, 2ULL * buffersPerIteration * iterations * threads, seconds);
+        if (pool.numberOfFreeElements() != poolSize)
+        {
+            printf("Error: %u buffers not released\n",
+                   static_cast<unsigned int>(poolSize - pool.numberOfFreeElements()));
+        }
+    }
+}
+}  // namespace
+
+void
+benchmark::sharedBufferCacheScaling()
+{
+    printf("SharedBufferPool allocation with per-thread caches\n");
+
+    static Pool pool;
+    measure("Pool", &allocateFromPool, pool);
+    measure("Cache, magazine size 8", &allocateFromCache<8>, pool);
+    measure("Cache, magazine size 32", &allocateFromCache<32>, pool);
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// Contention of the SharedBuffer reference counter.
+//
+// Every thread repeatedly takes and releases references. The counter
+// policies are measured directly to compare the mutex protected fallback
+// with the lock-free counter on the same target. The last benchmark copies
+// SharedBufferPointer instances of a single buffer, which uses the
+// default policy of the target.
+
+#include "benchmark.h"
+
+#include <outpost/utils/container/reference_counter.h>
+#include <outpost/utils/container/shared_buffer.h>
+
+#include <stdio.h>
+
+#include <array>
+
+using namespace outpost::utils;
+
+namespace
+{
+constexpr uint32_t iterations = 1000000;
+
+// Separate counters for every thread, placed on different cache lines
+constexpr uint32_t padding = 64;
+
+template <typename Counter>
+struct Counters
+{
+    Counter shared;
+    struct alignas(padding) Private
+    {
+        Counter counter;
+    };
+    std::array<Private, benchmark::maximumNumberOfThreads> separate;
+};
+
+template <typename Counter>
+void
+takeSharedReferences(uint32_t, void* argument)
+{
+    Counter& counter = static_cast<Counters<Counter>*>(argument)->shared;
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        counter.increment();
+        counter.decrement();
+    }
+}
+
+template <typename Counter>
+void
+takeSeparateReferences(uint32_t threadIndex, void* argument)
+{
+    Counter& counter = static_cast<Counters<Counter>*>(argument)->separate[threadIndex].counter;
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        counter.increment();
+        counter.decrement();
+    }
+}
+
+void
+copyPointers(uint32_t, void* argument)
+{
+    const SharedBufferPointer& pointer = *static_cast<const SharedBufferPointer*>(argument);
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        SharedBufferPointer copy(pointer);
+    }
+}
+
+template <typename Counter>
+void
+measureCounter(const char* name)
+{
+    static Counters<Counter> counters;
+    char description[64];
+    for (uint32_t threads = 1; threads <= benchmark::maximumNumberOfThreads; threads *= 2)
+    {
+        snprintf(description, sizeof(description), "%s, one counter", name);
+        double seconds = benchmark::run(threads, &takeSharedReferences<Counter>, &counters);
+        benchmark::printResult(description, threads, 2ULL * iterations * threads, seconds);
+
+        snprintf(description, sizeof(description), "%s, counter per thread", name);
+        seconds = benchmark::run(threads, &takeSeparateReferences<Counter>, &counters);
+        benchmark::printResult(description, threads, 2ULL * iterations * threads, seconds);
+    }
+}
+}  // namespace
+
+void
+benchmark::sharedBufferContention()
+{
+    printf("SharedBuffer reference counter contention\n");
+
+    measureCounter<reference_counter::MutexProtected>("MutexProtected");
+#if OUTPOST_UTILS_ATOMIC_REFERENCE_COUNTER
+    measureCounter<reference_counter::Atomic>("Atomic");
+#endif
+
+    std::array<uint8_t, 16> data;
+    SharedBuffer buffer(outpost::asSlice(data));
+    SharedBufferPointer pointer(&buffer);
+    for (uint32_t threads = 1; threads <= maximumNumberOfThreads; threads *= 2)
+    {
+        double seconds = run(threads, &copyPointers, &pointer);
+        printResult("SharedBufferPointer copy", threads, 2ULL * iterations * threads, seconds);
+    }
+}
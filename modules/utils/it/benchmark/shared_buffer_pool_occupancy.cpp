@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+// Allocation from a SharedBufferPool with most of the buffers in use.
+//
+// The first buffers of the pool are held during the measurement, every
+// thread then allocates and releases the remaining buffers. The pool is
+// compared with a linear search through the buffers starting after the
+// last allocated buffer, which was used by the pool before the
+// introduction of the free list. Besides the throughput the longest single
+// allocation is measured, for the linear search it grows with the number
+// of used buffers.
+
+#include "benchmark.h"
+
+#include <outpost/rtos/mutex_guard.h>
+#include <outpost/utils/container/shared_object_pool.h>
+
+#include <stdio.h>
+
+#include <array>
+#include <chrono>
+
+using namespace outpost::utils;
+
+namespace
+{
+constexpr size_t elementSize = 64;
+constexpr size_t numberOfElements = 4096;
+constexpr uint32_t iterations = 100000;
+
+/**
+ * Reference implementation with a linear search for unused buffers.
+ */
+class LinearSearchPool
+{
+public:
+    LinearSearchPool() : mLastIndex(0)
+    {
+        for (size_t i = 0; i < numberOfElements; i++)
+        {
+            mBuffer[i].setPointer(outpost::Slice<uint8_t>::unsafe(&mData[i][0], elementSize));
+        }
+    }
+
+    bool
+    allocate(SharedBufferPointer& pointer)
+    {
+        outpost::rtos::MutexGuard lock(mMutex);
+        size_t i = mLastIndex;
+        bool res = false;
+        do
+        {
+            if (!mBuffer[i].isUsed())
+            {
+                pointer = SharedBufferPointer(&mBuffer[i]);
+                res = true;
+                mLastIndex = (i + 1) % numberOfElements;
+            }
+            i = (i + 1) % numberOfElements;
+        } while (i != mLastIndex && !res);
+        return res;
+    }
+
+private:
+    std::array<std::array<uint8_t, elementSize>, numberOfElements> mData;
+    SharedBuffer mBuffer[numberOfElements];
+    size_t mLastIndex;
+    outpost::rtos::Mutex mMutex;
+};
+
+template <typename Pool>
+void
+allocateAndRelease(uint32_t, void* argument)
+{
+    Pool& pool = *static_cast<Pool*>(argument);
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        SharedBufferPointer pointer;
+        pool.allocate(pointer);
+    }
+}
+
+template <typename Pool>
+int64_t
+measureLongestAllocation(Pool& pool)
+{
+    int64_t longest = 0;
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        SharedBufferPointer pointer;
+        auto start = std::chrono::steady_clock::now();
+        pool.allocate(pointer);
+        auto duration = std::chrono::steady_clock::now() - start;
+
+        int64_t nanoseconds =
+                std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        if (nanoseconds > longest)
+        {
+            longest = nanoseconds;
+        }
+    }
+    return longest;
+}
+
+template <typename Pool>
+void
+measurePool(const char* name, Pool& pool, size_t numberOfHeldElements)
+{
+    static std::array<SharedBufferPointer, numberOfElements> pointers;
+    for (size_t i = 0; i < numberOfHeldElements; i++)
+    {
+        pool.allocate(pointers[i]);
+    }
+
+    for (uint32_t threads = 1; threads <= benchmark::maximumNumberOfThreads; threads *= 2)
+    {
+        double seconds = benchmark::run(threads, &allocateAndRelease<Pool>, &pool);
+        benchmark::printResult(name, threads, static_cast<uint64_t>(iterations) * threads, seconds);
+    }
+    printf("%-40s longest allocation: %lld ns\n",
+           name,
+           static_cast<long long>(measureLongestAllocation(pool)));
+
+    for (auto& pointer : pointers)
+    {
+        pointer = SharedBufferPointer();
+    }
+}
+
+void
+measureOccupancy(uint32_t percent)
+{
+    const size_t numberOfHeldElements = numberOfElements * percent / 100;
+    printf("SharedBufferPool allocation at %u%% occupancy (%u of %u buffers used)\n",
+           static_cast<unsigned int>(percent),
+           static_cast<unsigned int>(numberOfHeldElements),
+           static_cast<unsigned int>(numberOfElements));
+
+    static LinearSearchPool linearSearchPool;
+    measurePool("Linear search", linearSearchPool, numberOfHeldElements);
+
+    static SharedBufferPool<elementSize, numberOfElements> pool;
+    measurePool("SharedBufferPool", pool, numberOfHeldElements);
+}
+}  // namespace
+
+void
+benchmark::sharedBufferPoolOccupancy()
+{
+    measureOccupancy(90);
+    measureOccupancy(99);
+}
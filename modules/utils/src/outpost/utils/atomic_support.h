@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_ATOMIC_SUPPORT_H
+#define OUTPOST_UTILS_ATOMIC_SUPPORT_H
+
+// Lock-free data structures require native atomic operations on pointer
+// sized values. Targets without them (e.g. SPARC V8) fall back to mutex
+// protected implementations. Can be overridden by defining the macro to
+// 0 or 1 in the build configuration.
+#if !defined(OUTPOST_UTILS_LOCK_FREE_ATOMICS)
+#if defined(__GCC_ATOMIC_POINTER_LOCK_FREE) && (__GCC_ATOMIC_POINTER_LOCK_FREE == 2)
+#define OUTPOST_UTILS_LOCK_FREE_ATOMICS 1
+#else
+#define OUTPOST_UTILS_LOCK_FREE_ATOMICS 0
+#endif
+#endif
+
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+#include <atomic>
+#endif
+
+#endif
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_BYTE_SCAN_H
+#define OUTPOST_UTILS_BYTE_SCAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>  // for memcpy
+
+namespace outpost
+{
+namespace utils
+{
+/**
+ * Search byte arrays for special values one machine word at a time.
+ *
+ * Uses the "SWAR" (SIMD within a register) zero byte detection [1]:
+ * For a word \c v the expression
+ *
+ *     (v - 0x0101...01) & ~v & 0x8080...80
+ *
+ * is non-zero if and only if at least one byte of \c v is zero. Other
+ * values are found by XORing the word with the value repeated in every
+ * byte beforehand. Words are loaded from aligned addresses, so the
+ * functions are usable on targets without support for unaligned
+ * accesses. The result does not depend on the byte order of the target.
+ *
+ * [1] https://graphics.stanford.edu/~seander/bithacks.html#ZeroInWord
+ */
+class ByteScan
+{
+public:
+    /**
+     * Find the first zero byte.
+     *
+     * \param data
+     *     Data to search.
+     * \param length
+     *     Number of bytes to search.
+     *
+     * \return
+     *     Index of the first zero byte or \p length if the data contains
+     *     no zero byte.
+     */
+    static inline size_t
+    findZero(const uint8_t* data, size_t length)
+    {
+        return search(data, length, MatchOne(0));
+    }
+
+    /**
+     * Find the first byte with the given value.
+     *
+     * \return
+     *     Index of the first matching byte or \p length if no byte matches.
+     */
+    static inline size_t
+    find(const uint8_t* data, size_t length, uint8_t value)
+    {
+        return search(data, length, MatchOne(value));
+    }
+
+    /**
+     * Find the first byte matching one of two values.
+     *
+     * \return
+     *     Index of the first matching byte or \p length if no byte matches.
+     */
+    static inline size_t
+    findAnyOf(const uint8_t* data, size_t length, uint8_t first, uint8_t second)
+    {
+        return search(data, length, MatchTwo(first, second));
+    }
+
+private:
+    typedef uintptr_t Word;
+
+    /// 0x0101...01 for the width of a word
+    static constexpr Word lowBits = static_cast<Word>(~static_cast<Word>(0)) / 0xFF;
+
+    /// 0x8080...80 for the width of a word
+    static constexpr Word highBits = lowBits * 0x80;
+
+    static inline bool
+    isAligned(const uint8_t* data)
+    {
+        return (reinterpret_cast<uintptr_t>(data) % sizeof(Word)) == 0;
+    }
+
+    static inline Word
+    loadAligned(const uint8_t* data)
+    {
+        Word word;
+#if defined(__GNUC__)
+        // Allows the compiler to use a single load instruction on targets
+        // where unaligned accesses are not available.
+        data = static_cast<const uint8_t*>(__builtin_assume_aligned(data, sizeof(Word)));
+#endif
+        memcpy(&word, data, sizeof(Word));
+        return word;
+    }
+
+    static inline bool
+    hasZero(Word word)
+    {
+        return ((word - lowBits) & ~word & highBits) != 0;
+    }
+
+    /// Bytes equal to \p value become zero when XORed with the result
+    static constexpr Word
+    broadcast(uint8_t value)
+    {
+        return lowBits * value;
+    }
+
+    struct MatchOne
+    {
+        explicit constexpr MatchOne(uint8_t value) : mValue(value), mPattern(broadcast(value))
+        {
+        }
+
+        inline bool
+        matches(uint8_t byte) const
+        {
+            return byte == mValue;
+        }
+
+        inline bool
+        matches(Word word) const
+        {
+            return hasZero(word ^ mPattern);
+        }
+
+        uint8_t mValue;
+        Word mPattern;
+    };
+
+    struct MatchTwo
+    {
+        constexpr MatchTwo(uint8_t first, uint8_t second) :
+            mFirst(first), mSecond(second), mFirstPattern(broadcast(first)),
+            mSecondPattern(broadcast(second))
+        {
+        }
+
+        inline bool
+        matches(uint8_t byte) const
+        {
+            return (byte == mFirst) || (byte == mSecond);
+        }
+
+        inline bool
+        matches(Word word) const
+        {
+            return hasZero(word ^ mFirstPattern) || hasZero(word ^ mSecondPattern);
+        }
+
+        uint8_t mFirst;
+        uint8_t mSecond;
+        Word mFirstPattern;
+        Word mSecondPattern;
+    };
+
+    template <typename Matcher>
+    static inline size_t
+    search(const uint8_t* data, size_t length, const Matcher& matcher)
+    {
+        size_t index = 0;
+        while ((index < length) && !isAligned(&data[index]))
+        {
+            if (matcher.matches(data[index]))
+            {
+                return index;
+            }
+            index++;
+        }
+
+        while ((length - index) >= sizeof(Word))
+        {
+            if (matcher.matches(loadAligned(&data[index])))
+            {
+                break;
+            }
+            index += sizeof(Word);
+        }
+
+        // Locate the matching byte within the word or process the
+        // remaining bytes
+        while ((index < length) && !matcher.matches(data[index]))
+        {
+            index++;
+        }
+
+        return index;
+    }
+};
+
+}  // namespace utils
+}  // namespace outpost
+
+#endif
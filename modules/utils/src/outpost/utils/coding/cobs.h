@@ -85,6 +85,9 @@ private:
  * modifications allow to specify the available output buffer space and to
  * return the number of bytes actually needed.
  *
+ * Runs of non-zero bytes are located a machine word at a time (see
+ * ByteScan) and copied as a whole.
+ *
  * \author  Fabian Greif
  *
  * \see     http://conferences.sigcomm.org/sigcomm/1997/papers/p062.pdf
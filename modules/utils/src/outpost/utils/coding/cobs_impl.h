@@ -14,6 +14,7 @@
 #ifndef OUTPOST_UTILS_COBS_IMPL_H
 #define OUTPOST_UTILS_COBS_IMPL_H
 
+#include "byte_scan.h"
 #include "cobs.h"
 
 #include <string.h>  // for memcpy
@@ -107,19 +108,19 @@ uint8_t
 CobsEncodingGeneratorBase<blockLength>::findNextBlock() const
 {
     uint8_t blockSize = 0;
-    size_t position = mCurrentPosition;
 
-    // Loop until either:
-    // - A zero is found which determines the block length
-    // - No zero is found for 254 consecutive bytes
-    // - The end of the input array is reached.
-    if (nullptr != mData)
+    // The block ends at either:
+    // - A zero which determines the block length
+    // - After 254 consecutive non-zero bytes
+    // - The end of the input array.
+    if ((nullptr != mData) && (mCurrentPosition < mLength))
     {
-        while ((position < mLength) && (mData[position] != 0) && (blockSize < blockLength))
+        size_t available = mLength - mCurrentPosition;
+        if (available > blockLength)
         {
-            position++;
-            blockSize++;
+            available = blockLength;
         }
+        blockSize = static_cast<uint8_t>(ByteScan::findZero(&mData[mCurrentPosition], available));
     }
 
     return blockSize;
@@ -133,27 +134,37 @@ CobsBase<blockLength>::encode(outpost::Slice<const uint8_t> input, outpost::Slic
     const uint8_t* inputPtr = input.getDataPointer();
     const uint8_t* inputEnd = inputPtr + input.getNumberOfElements();
     uint8_t* outputPtr = output.getDataPointer();
+    const size_t outputLength = output.getNumberOfElements();
 
     // Pointer to the position where later the block length is inserted
     uint8_t* blockLengthPtr = outputPtr++;
     size_t length = 1;
     uint8_t currentBlockLength = 0;
 
-    while ((inputPtr < inputEnd) && (length < output.getNumberOfElements()))
+    while ((inputPtr < inputEnd) && (length < outputLength))
     {
-        if (*inputPtr == 0)
+        // Copy the run of non-zero bytes up to the next zero, the end of
+        // the current block or the end of one of the buffers at once.
+        size_t available = static_cast<size_t>(inputEnd - inputPtr);
+        if (available > (outputLength - length))
         {
-            *blockLengthPtr = currentBlockLength + 1;
-            blockLengthPtr = outputPtr++;
-            length++;
-            currentBlockLength = 0;
+            available = outputLength - length;
         }
-        else
+        if (available > static_cast<size_t>(blockLength - currentBlockLength))
         {
-            *outputPtr++ = *inputPtr;
-            length++;
-            currentBlockLength++;
-            if ((currentBlockLength == blockLength) && (length < output.getNumberOfElements()))
+            available = blockLength - currentBlockLength;
+        }
+
+        const size_t run = ByteScan::findZero(inputPtr, available);
+        memcpy(outputPtr, inputPtr, run);
+        inputPtr += run;
+        outputPtr += run;
+        length += run;
+        currentBlockLength = static_cast<uint8_t>(currentBlockLength + run);
+
+        if (currentBlockLength == blockLength)
+        {
+            if (length < outputLength)
             {
                 *blockLengthPtr = currentBlockLength + 1;
                 blockLengthPtr = outputPtr++;
@@ -161,7 +172,15 @@ CobsBase<blockLength>::encode(outpost::Slice<const uint8_t> input, outpost::Slic
                 currentBlockLength = 0;
             }
         }
-        inputPtr++;
+        else if (run < available)
+        {
+            // Zero byte found, it is replaced by the block length
+            *blockLengthPtr = currentBlockLength + 1;
+            blockLengthPtr = outputPtr++;
+            length++;
+            currentBlockLength = 0;
+            inputPtr++;
+        }
     }
     *blockLengthPtr = currentBlockLength + 1;
 
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_COBS_STREAM_DECODER_H
+#define OUTPOST_UTILS_COBS_STREAM_DECODER_H
+
+#include <outpost/base/slice.h>
+#include <outpost/utils/container/shared_buffer.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace outpost
+{
+namespace utils
+{
+/**
+ * Incremental COBS decoder for zero delimited frames.
+ *
+ * Decodes a stream of COBS encoded frames which are terminated by a zero
+ * byte. The data can be supplied in chunks of arbitrary size, e.g. as
+ * received from a serial interface. Decoded bytes are written directly
+ * into the destination buffer, the encoded frame is never buffered.
+ *
+ * The result of a frame is identical to calling Cobs::decode() with the
+ * encoded frame without the terminating zero byte. Two consecutive zero
+ * bytes result in an empty frame.
+ *
+ * \code
+ * while (chunk.getNumberOfElements() > 0)
+ * {
+ *     size_t consumed = decoder.push(chunk);
+ *     chunk = chunk.skipFirst(consumed);
+ *
+ *     if (decoder.getStatus() == CobsStreamDecoder::Status::complete)
+ *     {
+ *         process(decoder.getFrame());
+ *     }
+ * }
+ * \endcode
+ *
+ * The decoder state is independent of the frame length.
+ *
+ * \see CobsBase
+ */
+template <uint8_t blockLength>
+class CobsStreamDecoderBase
+{
+public:
+    enum class Status
+    {
+        /// Frame delimiter not yet received
+        receiving,
+
+        /// Frame successfully decoded
+        complete,
+
+        /// Frame delimiter found within a block, the frame is truncated
+        malformed,
+
+        /// Decoded frame does not fit into the destination buffer
+        overflow
+    };
+
+    /**
+     * Construct a decoder writing into a memory area.
+     *
+     * \param destination
+     *     Buffer for the decoded frame. Is reused for every frame.
+     */
+    explicit CobsStreamDecoderBase(outpost::Slice<uint8_t> destination);
+
+    /**
+     * Construct a decoder writing into a shared buffer.
+     *
+     * The decoder holds a reference to the buffer until a different
+     * destination is set.
+     */
+    explicit CobsStreamDecoderBase(const SharedBufferPointer& destination);
+
+    ~CobsStreamDecoderBase() = default;
+
+    /**
+     * Set a new destination buffer and discard the current frame.
+     */
+    void
+    setDestination(outpost::Slice<uint8_t> destination);
+
+    void
+    setDestination(const SharedBufferPointer& destination);
+
+    /**
+     * Decode a chunk of encoded data.
+     *
+     * Stops after the delimiter at the end of a frame. The status is
+     * then different from Status::receiving until the next call to
+     * push(), which starts a new frame.
+     *
+     * \param input
+     *     Encoded data.
+     *
+     * \return
+     *     Number of bytes consumed from \p input. Less than the size of
+     *     \p input if a frame has been finished.
+     */
+    size_t
+    push(outpost::Slice<const uint8_t> input);
+
+    /**
+     * Discard the current frame and wait for the next one.
+     *
+     * The bytes received until the next delimiter are decoded as a new
+     * frame, call this function only after a delimiter or when the
+     * input is known to start with a new frame.
+     */
+    void
+    reset();
+
+    inline Status
+    getStatus() const
+    {
+        return mStatus;
+    }
+
+    /**
+     * Get the decoded frame.
+     *
+     * \return
+     *     Decoded data if the status is Status::complete, otherwise an
+     *     empty slice.
+     */
+    outpost::Slice<uint8_t>
+    getFrame() const;
+
+    /**
+     * Get the decoded frame as a child of the shared buffer destination.
+     *
+     * \retval true
+     *     \p frame references the decoded data.
+     * \retval false
+     *     No complete frame or the destination is not a shared buffer.
+     */
+    bool
+    getFrame(SharedChildPointer& frame, uint16_t type = 0) const;
+
+private:
+    // disable copy constructor
+    CobsStreamDecoderBase(const CobsStreamDecoderBase&);
+
+    // disable copy-assignment operator
+    CobsStreamDecoderBase&
+    operator=(const CobsStreamDecoderBase&);
+
+    void
+    write(const uint8_t* data, size_t length);
+
+    void
+    finishFrame();
+
+    outpost::Slice<uint8_t> mDestination;
+    SharedBufferPointer mSharedDestination;
+
+    /// Number of bytes written into the destination
+    size_t mLength;
+
+    /// Number of data bytes outstanding in the current block
+    uint8_t mRemaining;
+
+    /// Current block is followed by a zero if another block follows
+    bool mZeroPending;
+
+    /// First error detected in the current frame
+    Status mError;
+    Status mStatus;
+};
+
+typedef CobsStreamDecoderBase<254> CobsStreamDecoder;
+
+}  // namespace utils
+}  // namespace outpost
+
+#include "cobs_stream_decoder_impl.h"
+
+#endif
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_COBS_STREAM_DECODER_IMPL_H
+#define OUTPOST_UTILS_COBS_STREAM_DECODER_IMPL_H
+
+#include "byte_scan.h"
+#include "cobs_stream_decoder.h"
+
+#include <string.h>  // for memcpy
+
+namespace outpost
+{
+namespace utils
+{
+template <uint8_t blockLength>
+CobsStreamDecoderBase<blockLength>::CobsStreamDecoderBase(outpost::Slice<uint8_t> destination) :
+    mDestination(destination),
+    mSharedDestination(),
+    mLength(0),
+    mRemaining(0),
+    mZeroPending(false),
+    mError(Status::receiving),
+    mStatus(Status::receiving)
+{
+}
+
+template <uint8_t blockLength>
+CobsStreamDecoderBase<blockLength>::CobsStreamDecoderBase(const SharedBufferPointer& destination) :
+    mDestination(destination),
+    mSharedDestination(destination),
+    mLength(0),
+    mRemaining(0),
+    mZeroPending(false),
+    mError(Status::receiving),
+    mStatus(Status::receiving)
+{
+}
+
+template <uint8_t blockLength>
+void
+CobsStreamDecoderBase<blockLength>::setDestination(outpost::Slice<uint8_t> destination)
+{
+    mDestination = destination;
+    mSharedDestination = SharedBufferPointer();
+    reset();
+}
+
+template <uint8_t blockLength>
+void
+CobsStreamDecoderBase<blockLength>::setDestination(const SharedBufferPointer& destination)
+{
+    mDestination = destination;
+    mSharedDestination = destination;
+    reset();
+}
+
+template <uint8_t blockLength>
+void
+CobsStreamDecoderBase<blockLength>::reset()
+{
+    mLength = 0;
+    mRemaining = 0;
+    mZeroPending = false;
+    mError = Status::receiving;
+    mStatus = Status::receiving;
+}
+
+template <uint8_t blockLength>
+size_t
+CobsStreamDecoderBase<blockLength>::push(outpost::Slice<const uint8_t> input)
+{
+    if (mStatus != Status::receiving)
+    {
+        reset();
+    }
+
+    const uint8_t* data = input.getDataPointer();
+    const size_t length = input.getNumberOfElements();
+    size_t position = 0;
+    while (position < length)
+    {
+        if (mRemaining == 0)
+        {
+            const uint8_t code = data[position];
+            position++;
+            if (code == 0)
+            {
+                // The zero following the last block is suppressed
+                finishFrame();
+                return position;
+            }
+
+            if (mZeroPending)
+            {
+                const uint8_t zero = 0;
+                write(&zero, 1);
+            }
+            mRemaining = code - 1;
+            mZeroPending = (mRemaining < blockLength);
+        }
+        else
+        {
+            size_t available = length - position;
+            if (available > mRemaining)
+            {
+                available = mRemaining;
+            }
+
+            const size_t run = ByteScan::findZero(&data[position], available);
+            write(&data[position], run);
+            position += run;
+            mRemaining = static_cast<uint8_t>(mRemaining - run);
+
+            if (run < available)
+            {
+                // Delimiter before the end of the block
+                if (mError == Status::receiving)
+                {
+                    mError = Status::malformed;
+                }
+                position++;
+                finishFrame();
+                return position;
+            }
+        }
+    }
+
+    return position;
+}
+
+template <uint8_t blockLength>
+outpost::Slice<uint8_t>
+CobsStreamDecoderBase<blockLength>::getFrame() const
+{
+    if (mStatus == Status::complete)
+    {
+        return mDestination.first(mLength);
+    }
+    return outpost::Slice<uint8_t>::empty();
+}
+
+template <uint8_t blockLength>
+bool
+CobsStreamDecoderBase<blockLength>::getFrame(SharedChildPointer& frame, uint16_t type) const
+{
+    if ((mStatus == Status::complete) && mSharedDestination.isValid())
+    {
+        return mSharedDestination.getChild(frame, type, 0, mLength);
+    }
+    return false;
+}
+
+template <uint8_t blockLength>
+void
+CobsStreamDecoderBase<blockLength>::write(const uint8_t* data, size_t length)
+{
+    if ((mError == Status::receiving) && (length > 0))
+    {
+        if (length > (mDestination.getNumberOfElements() - mLength))
+        {
+            // Skip the rest of the frame
+            mError = Status::overflow;
+        }
+        else
+        {
+            memcpy(mDestination.getDataPointer() + mLength, data, length);
+            mLength += length;
+        }
+    }
+}
+
+template <uint8_t blockLength>
+void
+CobsStreamDecoderBase<blockLength>::finishFrame()
+{
+    mRemaining = 0;
+    mZeroPending = false;
+    if (mError == Status::receiving)
+    {
+        mStatus = Status::complete;
+    }
+    else
+    {
+        mStatus = mError;
+        mLength = 0;
+    }
+}
+
+}  // namespace utils
+}  // namespace outpost
+
+#endif
@@ -18,9 +18,14 @@
  *
  * Uses the Wikipedia nomenclature of normal and reversed polynoms [1].
  *
+ * All variants are instances of the generic outpost::Crc template, new
+ * variants can be defined from their parameters as listed in [2].
+ *
  * [1] https://en.wikipedia.org/wiki/Cyclic_redundancy_check#Standards_and_common_use
+ * [2] https://reveng.sourceforge.io/crc-catalogue/
  */
 
+#include "crc_engine.h"
 #include "crc16.h"
 #include "crc32.h"
 #include "crc8.h"
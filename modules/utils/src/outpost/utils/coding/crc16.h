@@ -14,9 +14,8 @@
 #ifndef OUTPOST_CRC16_H
 #define OUTPOST_CRC16_H
 
-#include <outpost/base/slice.h>
+#include "crc_engine.h"
 
-#include <stddef.h>
 #include <stdint.h>
 
 namespace outpost
@@ -27,80 +26,16 @@ namespace outpost
  * Polynomial    : x^16 + x^12 + x^5 + 1 (0x1021, MSB first)
  * Initial value : 0xFFFF
  *
- * Used for space packet transfer frames.
+ * Used for space packet transfer frames and as packet error control
+ * field of ECSS-E-70-41 (PUS) telecommands and telemetry.
  *
+ * \see    Crc for the algorithms used
  * \ingroup crc
  * \author  Fabian Greif
  */
-class Crc16Ccitt
-{
-public:
-    inline Crc16Ccitt() : mCrc(initialValue)
-    {
-    }
-
-    inline ~Crc16Ccitt()
-    {
-    }
-
-    /**
-     * Calculate CRC from a block of data.
-     *
-     * \param data
-     *     address
-     * \param length
-     *     length
-     *
-     * \retval crc
-     *     calculated checksum
-     */
-    static uint16_t
-    calculate(outpost::Slice<const uint8_t> data);
-
-    /**
-     * Reset CRC calculation
-     */
-    inline void
-    reset()
-    {
-        mCrc = initialValue;
-    }
-
-    /**
-     * CRC update.
-     *
-     * \param data
-     *     byte
-     */
-    void
-    update(uint8_t data);
-
-    /**
-     * Get result of CRC calculation.
-     */
-    inline uint16_t
-    getValue() const
-    {
-        return mCrc;
-    }
-
-private:
-    // disable copy constructor
-    Crc16Ccitt(const Crc16Ccitt&);
-
-    // disable copy-assignment operator
-    Crc16Ccitt&
-    operator=(const Crc16Ccitt&);
-
-    static constexpr uint16_t initialValue = 0xFFFF;
-    static constexpr int32_t numberOfBitsPerByte = 8;
-    static constexpr int32_t numberOfValuesPerByte = 256;
-
-    /// Pre-calculated CRC table for one byte
-    static const uint16_t crcTable[numberOfValuesPerByte];
+typedef Crc<16, 0x1021, 0xFFFF, 0x0000, false> Crc16Ccitt;
 
-    uint16_t mCrc;
-};
+extern template class Crc<16, 0x1021, 0xFFFF, 0x0000, false>;
 }  // namespace outpost
 
 #endif
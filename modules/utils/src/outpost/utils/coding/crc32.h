@@ -14,9 +14,8 @@
 #ifndef OUTPOST_CRC32_H
 #define OUTPOST_CRC32_H
 
-#include <outpost/base/slice.h>
+#include "crc_engine.h"
 
-#include <stddef.h>
 #include <stdint.h>
 
 namespace outpost
@@ -36,80 +35,31 @@ namespace outpost
  * [2] http://www.w3.org/TR/PNG/#D-CRCAppendix
  * [3] http://www.greenend.org.uk/rjk/tech/crc.html
  *
+ * \see    Crc for the algorithms used
  * \ingroup crc
  * \author  Fabian Greif
  */
-class Crc32Reversed
-{
-public:
-    inline Crc32Reversed() : mCrc(initialValue)
-    {
-    }
-
-    inline ~Crc32Reversed()
-    {
-    }
-
-    /**
-     * Calculate CRC from a block of data.
-     *
-     * \param data
-     *     address
-     * \param length
-     *     length
-     *
-     * \retval crc
-     *     calculated checksum
-     */
-    static uint32_t
-    calculate(outpost::Slice<const uint8_t> data);
-
-    /**
-     * Reset CRC calculation
-     */
-    inline void
-    reset()
-    {
-        mCrc = initialValue;
-    }
-
-    /**
-     * CRC update.
-     *
-     * \param data
-     *     byte
-     */
-    void
-    update(uint8_t data);
-
-    /**
-     * Get result of CRC calculation.
-     */
-    inline uint32_t
-    getValue() const
-    {
-        return mCrc ^ finalXor;
-    }
-
-private:
-    // disable copy constructor
-    Crc32Reversed(const Crc32Reversed&);
-
-    // disable copy-assignment operator
-    Crc32Reversed&
-    operator=(const Crc32Reversed&);
-
-    static constexpr uint32_t initialValue = 0xFFFFFFFF;
-    static constexpr uint32_t finalXor = 0xFFFFFFFF;
-
-    static constexpr int32_t numberOfBitsPerByte = 8;
-    static constexpr int32_t numberOfValuesPerByte = 256;
+typedef Crc<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true> Crc32Reversed;
 
-    /// Pre-calculated CRC table for one byte
-    static const uint32_t crcTable[numberOfValuesPerByte];
+/**
+ * CRC-32C (Castagnoli) calculation.
+ *
+ * Polynomial    : 0x1EDC6F41 (0x82F63B78, LSB first)
+ * Initial value : 0xFFFFFFFF
+ * Final XOR     : 0xFFFFFFFF
+ *
+ * Used in iSCSI, SCTP and ext4. Has a better error detection capability
+ * than CRC-32 for typical message lengths [1].
+ *
+ * [1] https://users.ece.cmu.edu/~koopman/crc/crc32c.html
+ *
+ * \see    Crc for the algorithms used
+ * \ingroup crc
+ */
+typedef Crc<32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true> Crc32Castagnoli;
 
-    uint32_t mCrc;
-};
+extern template class Crc<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true>;
+extern template class Crc<32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true>;
 }  // namespace outpost
 
 #endif
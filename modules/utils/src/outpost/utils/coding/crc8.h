@@ -14,9 +14,8 @@
 #ifndef OUTPOST_CRC8_H
 #define OUTPOST_CRC8_H
 
-#include <outpost/base/slice.h>
+#include "crc_engine.h"
 
-#include <stddef.h>
 #include <stdint.h>
 
 namespace outpost
@@ -27,77 +26,11 @@ namespace outpost
  * Polynomial    : x^8 + x^2 + x + 1 (0x07, MSB first)
  * Initial value : 0x00
  *
+ * \see    Crc for the algorithms used
  * \ingroup crc
  * \author  Fabian Greif
  */
-class Crc8Ccitt
-{
-public:
-    inline Crc8Ccitt() : mCrc(initialValue)
-    {
-    }
-
-    inline ~Crc8Ccitt()
-    {
-    }
-
-    /**
-     * Calculate CRC from a block of data.
-     *
-     * \param data
-     *     address
-     * \param length
-     *     length
-     *
-     * \retval crc
-     *     calculated checksum
-     */
-    static uint8_t
-    calculate(outpost::Slice<const uint8_t> data);
-
-    /**
-     * Reset CRC calculation
-     */
-    inline void
-    reset()
-    {
-        mCrc = initialValue;
-    }
-
-    /**
-     * CRC update.
-     *
-     * \param data
-     *     byte
-     */
-    void
-    update(uint8_t data);
-
-    /**
-     * Get result of CRC calculation.
-     */
-    inline uint8_t
-    getValue() const
-    {
-        return mCrc;
-    }
-
-private:
-    // disable copy constructor
-    Crc8Ccitt(const Crc8Ccitt&);
-
-    // disable copy-assignment operator
-    Crc8Ccitt&
-    operator=(const Crc8Ccitt&);
-
-    static constexpr uint8_t initialValue = 0x00;
-    static constexpr int32_t numberOfValuesPerByte = 256;
-
-    /// Pre-calculated CRC table for one byte
-    static const uint8_t crcTable[numberOfValuesPerByte];
-
-    uint8_t mCrc;
-};
+typedef Crc<8, 0x07, 0x00, 0x00, false> Crc8Ccitt;
 
 /**
  * CRC-8 calculation for RMAP.
@@ -106,78 +39,15 @@ private:
  * Initial value : 0x00
  *
  * \see     ECSS-E-50-11 SpaceWire RMAP Protocol
+ * \see     Crc for the algorithms used
  *
  * \ingroup crc
  * \author  Fabian Greif
  */
-class Crc8CcittReversed
-{
-public:
-    inline Crc8CcittReversed() : mCrc(initialValue)
-    {
-    }
-
-    inline ~Crc8CcittReversed()
-    {
-    }
-
-    /**
-     * Calculate CRC from a block of data.
-     *
-     * \param data
-     *     address
-     * \param length
-     *     length
-     *
-     * \retval crc
-     *     calculated checksum
-     */
-    static uint8_t
-    calculate(outpost::Slice<const uint8_t> data);
-
-    /**
-     * Reset CRC calculation
-     */
-    inline void
-    reset()
-    {
-        mCrc = initialValue;
-    }
-
-    /**
-     * CRC update.
-     *
-     * \param data
-     *     byte
-     */
-    void
-    update(uint8_t data);
-
-    /**
-     * Get result of CRC calculation.
-     */
-    inline uint8_t
-    getValue() const
-    {
-        return mCrc;
-    }
-
-private:
-    // disable copy constructor
-    Crc8CcittReversed(const Crc8CcittReversed&);
-
-    // disable copy-assignment operator
-    Crc8CcittReversed&
-    operator=(const Crc8CcittReversed&);
-
-    static constexpr uint8_t initialValue = 0x00;
-    static constexpr int32_t numberOfValuesPerByte = 256;
-
-    /// Pre-calculated CRC table for one byte
-    static const uint8_t crcTable[numberOfValuesPerByte];
+typedef Crc<8, 0x07, 0x00, 0x00, true> Crc8CcittReversed;
 
-    uint8_t mCrc;
-};
+extern template class Crc<8, 0x07, 0x00, 0x00, false>;
+extern template class Crc<8, 0x07, 0x00, 0x00, true>;
 }  // namespace outpost
 
 #endif
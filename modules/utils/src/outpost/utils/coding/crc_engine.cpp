@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "crc_engine.h"
+
+#if OUTPOST_CRC_CLMUL
+
+#include <immintrin.h>
+
+bool
+outpost::hasCarrylessMultiply()
+{
+    return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+}
+
+__attribute__((target("pclmul,sse4.1"))) uint32_t
+outpost::foldReflected32(uint32_t crc,
+                         const uint8_t* data,
+                         size_t length,
+                         const CrcFoldingConstants& constants)
+{
+    const __m128i k1k2 = _mm_set_epi64x(static_cast<int64_t>(constants.k2),
+                                        static_cast<int64_t>(constants.k1));
+    const __m128i k3k4 = _mm_set_epi64x(static_cast<int64_t>(constants.k4),
+                                        static_cast<int64_t>(constants.k3));
+    const __m128i k5 = _mm_set_epi64x(0, static_cast<int64_t>(constants.k5));
+    const __m128i polyMu = _mm_set_epi64x(static_cast<int64_t>(constants.mu),
+                                          static_cast<int64_t>(constants.polynomial));
+    const __m128i mask32 = _mm_setr_epi32(-1, 0, -1, 0);
+
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+    __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+    data += 64;
+    length -= 64;
+
+    // Fold four 128-bit lanes in parallel
+    while (length >= 64)
+    {
+        __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8),
+                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30)));
+
+        data += 64;
+        length -= 64;
+    }
+
+    // Fold the four lanes into a single 128-bit value
+    __m128i x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Fold the remaining 16 byte blocks
+    while (length >= 16)
+    {
+        x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, k3k4, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+        data += 16;
+        length -= 16;
+    }
+
+    // Reduce 128 to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, mask32);
+    x1 = _mm_clmulepi64_si128(x1, k5, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x2 = _mm_and_si128(x1, mask32);
+    x2 = _mm_clmulepi64_si128(x2, polyMu, 0x10);
+    x2 = _mm_and_si128(x2, mask32);
+    x2 = _mm_clmulepi64_si128(x2, polyMu, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+
+#endif
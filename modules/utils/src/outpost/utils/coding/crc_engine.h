@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_CRC_ENGINE_H
+#define OUTPOST_CRC_ENGINE_H
+
+#include "crc_table.h"
+
+#include <outpost/base/slice.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define OUTPOST_CRC_CLMUL 1
+#else
+#define OUTPOST_CRC_CLMUL 0
+#endif
+
+namespace outpost
+{
+/**
+ * Register type for a CRC of the given width.
+ */
+template <uint32_t width>
+struct CrcRegister;
+
+template <>
+struct CrcRegister<8>
+{
+    typedef uint8_t Type;
+};
+
+template <>
+struct CrcRegister<16>
+{
+    typedef uint16_t Type;
+};
+
+template <>
+struct CrcRegister<32>
+{
+    typedef uint32_t Type;
+};
+
+/**
+ * Polynomial arithmetic over GF(2) used to derive the CRC constants at
+ * compile time.
+ *
+ * \ingroup crc
+ */
+struct CrcArithmetic
+{
+    /// Reverse the order of the lower \p bits bits of \p value
+    static constexpr uint64_t
+    reflect(uint64_t value, uint32_t bits)
+    {
+        return (bits == 0) ? 0 : (((value & 1) << (bits - 1)) | reflect(value >> 1, bits - 1));
+    }
+
+    /// Multiply \p value by x^n modulo the 33-bit polynomial \p fullPolynomial
+    static constexpr uint64_t
+    multiplyX(uint64_t value, uint32_t n, uint64_t fullPolynomial)
+    {
+        return (n == 0) ? value
+                        : multiplyX(((value << 1) & (1ULL << 32)) ? ((value << 1) ^ fullPolynomial)
+                                                                  : (value << 1),
+                                    n - 1,
+                                    fullPolynomial);
+    }
+
+    /// x^n mod P(x) for a 33-bit polynomial
+    static constexpr uint64_t
+    powerOfXMod(uint32_t n, uint64_t fullPolynomial)
+    {
+        return (n < 32) ? (1ULL << n)
+                        : multiplyX(powerOfXMod(n - 16, fullPolynomial), 16, fullPolynomial);
+    }
+
+    /**
+     * Continue the long division x^64 / P(x) at quotient bit \p bit.
+     *
+     * \p remainder holds the coefficients x^0..x^63 of the remainder,
+     * the coefficient of x^64 has already been eliminated.
+     */
+    static constexpr uint64_t
+    divide(uint64_t remainder, uint64_t quotient, int32_t bit, uint64_t fullPolynomial)
+    {
+        return (bit < 0) ? quotient
+                         : (((remainder >> (32 + bit)) & 1)
+                                    ? divide(remainder ^ (fullPolynomial << bit),
+                                             quotient | (1ULL << bit),
+                                             bit - 1,
+                                             fullPolynomial)
+                                    : divide(remainder, quotient, bit - 1, fullPolynomial));
+    }
+
+    /// Floor of x^64 / P(x) for a 33-bit polynomial
+    static constexpr uint64_t
+    quotientOfX64(uint64_t fullPolynomial)
+    {
+        return divide((fullPolynomial & 0xFFFFFFFFULL) << 32, 1ULL << 32, 31, fullPolynomial);
+    }
+};
+
+/**
+ * Constants for folding a reflected 32-bit CRC with carry-less
+ * multiplications.
+ *
+ * See V. Gopal et al., "Fast CRC Computation for Generic Polynomials
+ * Using PCLMULQDQ Instruction", Intel White Paper, 2009. With P' being
+ * the bit-reflected polynomial:
+ *
+ *   k1 = (x^(4*128+32) mod P)' << 1, k2 = (x^(4*128-32) mod P)' << 1
+ *   k3 = (x^(128+32) mod P)' << 1,   k4 = (x^(128-32) mod P)' << 1
+ *   k5 = (x^64 mod P)' << 1,         mu = (x^64 div P)'
+ *
+ * \ingroup crc
+ */
+struct CrcFoldingConstants
+{
+    uint64_t k1;
+    uint64_t k2;
+    uint64_t k3;
+    uint64_t k4;
+    uint64_t k5;
+    uint64_t polynomial;
+    uint64_t mu;
+};
+
+/**
+ * Generates the folding constants for a 32-bit polynomial given in
+ * normal (MSB first) notation.
+ */
+template <uint32_t polynomial>
+struct CrcFoldingGenerator
+{
+    static constexpr uint64_t fullPolynomial = (1ULL << 32) | polynomial;
+
+    static constexpr uint64_t
+    foldConstant(uint32_t n)
+    {
+        return CrcArithmetic::reflect(CrcArithmetic::powerOfXMod(n, fullPolynomial), 32) << 1;
+    }
+
+    static const CrcFoldingConstants constants;
+};
+
+template <uint32_t polynomial>
+constexpr CrcFoldingConstants CrcFoldingGenerator<polynomial>::constants = {
+        CrcFoldingGenerator<polynomial>::foldConstant(4 * 128 + 32),
+        CrcFoldingGenerator<polynomial>::foldConstant(4 * 128 - 32),
+        CrcFoldingGenerator<polynomial>::foldConstant(128 + 32),
+        CrcFoldingGenerator<polynomial>::foldConstant(128 - 32),
+        CrcFoldingGenerator<polynomial>::foldConstant(64),
+        CrcArithmetic::reflect(CrcFoldingGenerator<polynomial>::fullPolynomial, 33),
+        CrcArithmetic::reflect(
+                CrcArithmetic::quotientOfX64(CrcFoldingGenerator<polynomial>::fullPolynomial),
+                33)};
+
+#if OUTPOST_CRC_CLMUL
+/**
+ * Check if the processor supports the PCLMULQDQ and SSE4.1 instructions.
+ */
+bool
+hasCarrylessMultiply();
+
+/**
+ * Fold a block of data into a reflected 32-bit CRC register using
+ * carry-less multiplications.
+ *
+ * \param length
+ *     Number of bytes, must be a multiple of 16 and at least 64.
+ */
+uint32_t
+foldReflected32(uint32_t crc,
+                const uint8_t* data,
+                size_t length,
+                const CrcFoldingConstants& constants);
+#endif
+
+/**
+ * Selects the carry-less multiplication kernel. Returns the number of
+ * bytes which have been processed.
+ *
+ * Only available for reflected 32-bit CRCs on x86-64, all other
+ * configurations use the table-driven algorithm only.
+ */
+template <typename T, uint32_t polynomial, bool reflected>
+struct CrcFoldingKernel
+{
+    static inline size_t
+    fold(T& /*crc*/, const uint8_t* /*data*/, size_t /*length*/)
+    {
+        return 0;
+    }
+};
+
+#if OUTPOST_CRC_CLMUL
+template <uint32_t polynomial>
+struct CrcFoldingKernel<uint32_t, polynomial, true>
+{
+    static constexpr size_t minimumLength = 64;
+
+    static inline size_t
+    fold(uint32_t& crc, const uint8_t* data, size_t length)
+    {
+        if ((length < minimumLength) || !hasCarrylessMultiply())
+        {
+            return 0;
+        }
+
+        const size_t foldedLength = length & ~static_cast<size_t>(15);
+        crc = foldReflected32(crc, data, foldedLength, CrcFoldingGenerator<polynomial>::constants);
+        return foldedLength;
+    }
+};
+#endif
+
+/**
+ * Generic CRC calculation.
+ *
+ * The parameters follow the Rocksoft^tm model as used by the
+ * "Catalogue of parametrised CRC algorithms" [1]. Input and output
+ * reflection are always identical.
+ *
+ * Blocks of data are processed eight bytes at a time using the
+ * slicing-by-8 algorithm [2] with tables generated at compile time.
+ * Reflected 32-bit CRCs are folded with carry-less multiplications
+ * on x86-64 hosts providing the PCLMULQDQ instruction [3]. The
+ * processor features are checked at runtime, all paths yield
+ * identical results.
+ *
+ * [1] https://reveng.sourceforge.io/crc-catalogue/
+ * [2] M. E. Kounavis and F. L. Berry, "A Systematic Approach to Building
+ *     High Performance Software-Based CRC Generators", ISCC 2005
+ * [3] V. Gopal et al., "Fast CRC Computation for Generic Polynomials Using
+ *     PCLMULQDQ Instruction", Intel White Paper, 2009
+ *
+ * \tparam width
+ *     Width of the CRC in bits (8, 16 or 32).
+ * \tparam polynomial
+ *     Generator polynomial in normal (MSB first) notation without the
+ *     leading x^width term, also for reflected CRCs.
+ * \tparam initialValue
+ *     Initial value of the CRC register. As in the catalogue, the value
+ *     is given for the unreflected register.
+ * \tparam finalXor
+ *     Value XORed to the CRC register to produce the result.
+ * \tparam reflected
+ *     Input bytes and result are processed LSB first.
+ *
+ * \ingroup crc
+ */
+template <uint32_t width,
+          uint32_t polynomial,
+          uint32_t initialValue,
+          uint32_t finalXor,
+          bool reflected>
+class Crc
+{
+public:
+    typedef typename CrcRegister<width>::Type ValueType;
+
+    static_assert(polynomial <= static_cast<ValueType>(~0ULL), "Polynomial exceeds CRC width");
+    static_assert(initialValue <= static_cast<ValueType>(~0ULL), "Initial value exceeds CRC width");
+    static_assert(finalXor <= static_cast<ValueType>(~0ULL), "Final XOR exceeds CRC width");
+
+    inline Crc() : mCrc(initialRegister)
+    {
+    }
+
+    inline ~Crc()
+    {
+    }
+
+    /**
+     * Calculate CRC from a block of data.
+     *
+     * \param data
+     *     block of data
+     *
+     * \retval crc
+     *     calculated checksum
+     */
+    static ValueType
+    calculate(outpost::Slice<const uint8_t> data);
+
+    /**
+     * Reset CRC calculation
+     */
+    inline void
+    reset()
+    {
+        mCrc = initialRegister;
+    }
+
+    /**
+     * CRC update.
+     *
+     * \param data
+     *     byte
+     */
+    void
+    update(uint8_t data);
+
+    /**
+     * CRC update with a block of data.
+     *
+     * Equivalent to calling update(uint8_t) for every byte of the block.
+     *
+     * \param data
+     *     block of data
+     */
+    void
+    update(outpost::Slice<const uint8_t> data);
+
+    /**
+     * Get result of CRC calculation.
+     */
+    inline ValueType
+    getValue() const
+    {
+        return static_cast<ValueType>(mCrc ^ finalXor);
+    }
+
+private:
+    // disable copy constructor
+    Crc(const Crc&);
+
+    // disable copy-assignment operator
+    Crc&
+    operator=(const Crc&);
+
+    static constexpr uint32_t numberOfBitsPerByte = 8;
+
+    /// The initial value is given for the unreflected register
+    static constexpr ValueType initialRegister = static_cast<ValueType>(
+            reflected ? CrcArithmetic::reflect(initialValue, width) : initialValue);
+
+    /// The tables expect reflected CRCs in reversed notation
+    static constexpr ValueType tablePolynomial = static_cast<ValueType>(
+            reflected ? CrcArithmetic::reflect(polynomial, width) : polynomial);
+
+    /// Pre-calculated CRC tables for the slicing-by-8 algorithm
+    typedef CrcTable<ValueType, tablePolynomial, reflected, 8> Table;
+
+    typedef CrcFoldingKernel<ValueType, polynomial, reflected> FoldingKernel;
+
+    /// Byte of the CRC register which is combined with the n-th input byte
+    static inline uint32_t
+    registerByte(ValueType crc, size_t n);
+
+    static inline ValueType
+    updateByte(ValueType crc, uint8_t data);
+
+    static ValueType
+    updateBlock(ValueType crc, const uint8_t* data, size_t length);
+
+    ValueType mCrc;
+};
+}  // namespace outpost
+
+#include "crc_engine_impl.h"
+
+#endif
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_CRC_ENGINE_IMPL_H
+#define OUTPOST_CRC_ENGINE_IMPL_H
+
+#include "crc_engine.h"
+
+namespace outpost
+{
+template <uint32_t width,
+          uint32_t polynomial,
+          uint32_t initialValue,
+          uint32_t finalXor,
+          bool reflected>
+typename Crc<width, polynomial, initialValue, finalXor, reflected>::ValueType
+Crc<width, polynomial, initialValue, finalXor, reflected>::calculate(
+        outpost::Slice<const uint8_t> data)
+{
+    Crc generator;
+    generator.update(data);
+
+    ValueType value = generator.getValue();
+    return value;
+}
+
+template <uint32_t width,
+          uint32_t polynomial,
+          uint32_t initialValue,
+          uint32_t finalXor,
+          bool reflected>
+void
+Crc<width, polynomial, initialValue, finalXor, reflected>::update(uint8_t data)
+{
+    mCrc = updateByte(mCrc, data);
+}
+
+template <uint32_t width,
+          uint32_t polynomial,
+          uint32_t initialValue,
+          uint32_t finalXor,
+          bool reflected>
+void
+Crc<width, polynomial, initialValue, finalXor, reflected>::update(
+        outpost::Slice<const uint8_t> data)
+{
+    mCrc = updateBlock(mCrc, data.getDataPointer(), data.getNumberOfElements());
+}
+
+template <uint32_t width,
+          uint32_t polynomial,
+          uint32_t initialValue,
+          uint32_t finalXor,
+          bool reflected>
+inline uint32_t
+Crc<width, polynomial, initialValue, finalXor, reflected>::registerByte(ValueType crc, size_t n)
+{
+    // Reflected CRCs consume the register starting with the lowest byte,
+    // normal CRCs starting with the highest byte.
+    return reflected ? ((static_cast<uint32_t>(crc) >> (n * numberOfBitsPerByte)) & 0xFF)
+                     : ((static_cast<uint32_t>(crc)
+                         >> (width - numberOfBitsPerByte - (n * numberOfBitsPerByte)))
+                        & 0xFF);
+}
+
+template <uint32_t width,
+          uint32_t polynomial,
+          uint32_t initialValue,
+          uint32_t finalXor,
+          bool reflected>
+inline typename Crc<width, polynomial, initialValue, finalXor, reflected>::ValueType
+Crc<width, polynomial, initialValue, finalXor, reflected>::updateByte(ValueType crc, uint8_t data)
+{
+    const uint32_t index = registerByte(crc, 0) ^ data;
+    if (reflected)
+    {
+        return static_cast<ValueType>((static_cast<uint32_t>(crc) >> numberOfBitsPerByte)
+                                      ^ Table::values[0][index]);
+    }
+    else
+    {
+        return static_cast<ValueType>((static_cast<uint32_t>(crc) << numberOfBitsPerByte)
+                                      ^ Table::values[0][index]);
+    }
+}
+
+template <uint32_t width,
+          uint32_t polynomial,
+          uint32_t initialValue,
+          uint32_t finalXor,
+          bool reflected>
+typename Crc<width, polynomial, initialValue, finalXor, reflected>::ValueType
+Crc<width, polynomial, initialValue, finalXor, reflected>::updateBlock(ValueType crc,
+                                                                       const uint8_t* data,
+                                                                       size_t length)
+{
+    const size_t foldedLength = FoldingKernel::fold(crc, data, length);
+    data += foldedLength;
+    length -= foldedLength;
+
+    const size_t numberOfSlices = Table::numberOfSlices;
+    const size_t registerBytes = sizeof(ValueType);
+    while (length >= numberOfSlices)
+    {
+        // Every input byte is looked up in the table that appends the
+        // number of bytes following it in the block. The bytes of the
+        // current register are combined with the first input bytes.
+        uint32_t next = 0;
+        for (size_t i = 0; i < numberOfSlices; ++i)
+        {
+            uint32_t value = data[i];
+            if (i < registerBytes)
+            {
+                value ^= registerByte(crc, i);
+            }
+            next ^= Table::values[numberOfSlices - 1 - i][value];
+        }
+        crc = static_cast<ValueType>(next);
+
+        data += numberOfSlices;
+        length -= numberOfSlices;
+    }
+
+    while (length > 0)
+    {
+        crc = updateByte(crc, *data);
+        ++data;
+        --length;
+    }
+
+    return crc;
+}
+
+}  // namespace outpost
+
+#endif
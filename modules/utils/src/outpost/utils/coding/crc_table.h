@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_CRC_TABLE_H
+#define OUTPOST_CRC_TABLE_H
+
+#include <outpost/utils/meta.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <array>
+
+namespace outpost
+{
+/**
+ * Compile-time generator for CRC lookup tables.
+ *
+ * \tparam T
+ *     Type of the CRC register (uint8_t, uint16_t or uint32_t).
+ * \tparam polynomial
+ *     Generator polynomial. MSB first notation for normal CRCs, LSB
+ *     first notation for reflected CRCs.
+ * \tparam reflected
+ *     Bits are processed LSB first.
+ *
+ * \ingroup crc
+ */
+template <typename T, T polynomial, bool reflected>
+struct CrcTableGenerator
+{
+    static_assert(sizeof(T) <= sizeof(uint32_t), "CRC register may not exceed 32 bit");
+
+    static constexpr size_t numberOfValuesPerByte = 256;
+    static constexpr uint32_t width = sizeof(T) * 8;
+    static constexpr uint32_t topBit = 1UL << (width - 1);
+
+    typedef std::array<T, numberOfValuesPerByte> Row;
+
+    /// Process a single bit of the CRC register
+    static constexpr T
+    shiftBit(T crc)
+    {
+        return reflected ? static_cast<T>((crc & 1U) ? ((crc >> 1) ^ polynomial) : (crc >> 1))
+                         : static_cast<T>((crc & topBit) ? ((crc << 1) ^ polynomial) : (crc << 1));
+    }
+
+    static constexpr T
+    shiftBits(T crc, uint32_t bits)
+    {
+        return (bits == 0) ? crc : shiftBits(shiftBit(crc), bits - 1);
+    }
+
+    /// CRC of a single byte, i.e. the classic lookup table entry
+    static constexpr T
+    byteEntry(uint32_t index)
+    {
+        return reflected ? shiftBits(static_cast<T>(index), 8)
+                         : shiftBits(static_cast<T>(index << (width - 8)), 8);
+    }
+
+    /// Process a zero byte
+    static constexpr T
+    shiftByte(T crc)
+    {
+        return reflected ? static_cast<T>((static_cast<uint32_t>(crc) >> 8)
+                                          ^ byteEntry(static_cast<uint32_t>(crc) & 0xFF))
+                         : static_cast<T>((static_cast<uint32_t>(crc) << 8)
+                                          ^ byteEntry(static_cast<uint32_t>(crc) >> (width - 8)));
+    }
+
+    /// CRC of the index byte followed by \p slice zero bytes
+    static constexpr T
+    entry(size_t slice, size_t index)
+    {
+        return (slice == 0) ? byteEntry(static_cast<uint32_t>(index))
+                            : shiftByte(entry(slice - 1, index));
+    }
+
+    template <size_t... indices>
+    static constexpr Row
+    generateRow(size_t slice, IndexSequence<indices...>)
+    {
+        return Row{{entry(slice, indices)...}};
+    }
+};
+
+/**
+ * Lookup tables for table-driven CRC algorithms.
+ *
+ * The tables are generated at compile time from the polynomial. Slice 0
+ * is the classic byte-wise table, slice n contains the CRC of the index
+ * byte followed by n zero bytes. Slices 1..N-1 are used to process N
+ * bytes per step (slicing-by-N).
+ *
+ * \tparam slices
+ *     Number of tables to generate.
+ *
+ * \see    CrcTableGenerator for the other parameters
+ * \ingroup crc
+ */
+template <typename T, T polynomial, bool reflected, size_t slices>
+struct CrcTable
+{
+    static_assert(slices > 0, "At least one table is required");
+
+    typedef CrcTableGenerator<T, polynomial, reflected> Generator;
+    typedef std::array<typename Generator::Row, slices> Table;
+
+    static constexpr size_t numberOfSlices = slices;
+
+    template <size_t... rows>
+    static constexpr Table
+    generate(IndexSequence<rows...>)
+    {
+        return Table{{Generator::generateRow(
+                rows,
+                typename MakeIndexSequence<Generator::numberOfValuesPerByte>::Type())...}};
+    }
+
+    static const Table values;
+};
+
+template <typename T, T polynomial, bool reflected, size_t slices>
+constexpr typename CrcTable<T, polynomial, reflected, slices>::Table
+        CrcTable<T, polynomial, reflected, slices>::values =
+                CrcTable<T, polynomial, reflected, slices>::generate(
+                        typename MakeIndexSequence<slices>::Type());
+
+}  // namespace outpost
+
+#endif
@@ -13,6 +13,10 @@
 
 #include "hdlc.h"
 
+#include "byte_scan.h"
+
+#include <string.h>  // for memcpy
+
 namespace outpost
 {
 namespace utils
@@ -33,81 +37,131 @@ HdlcStuffing::encode(outpost::Slice<const uint8_t> const& input, outpost::Slice<
         return 0;
     }
 
-    auto input_it = input.begin();
-    auto output_it = output.begin();
+    const uint8_t* input_data = input.getDataPointer();
+    const size_t input_length = input.getNumberOfElements();
+    uint8_t* output_data = output.getDataPointer();
+    const size_t output_length = output.getNumberOfElements();
 
-    *output_it = boundary_byte;
-    output_it++;
+    size_t input_pos = 0;
+    size_t output_pos = 0;
+    output_data[output_pos] = boundary_byte;
+    output_pos++;
 
-    while ((input_it != input.end()) && (output_it != output.end()))
+    while (input_pos < input_length)
     {
-        uint8_t data = *input_it;
-        if ((data == boundary_byte) || (data == escape_byte))
+        // bytes up to the next special character are copied unchanged
+        const size_t run = ByteScan::findAnyOf(
+                &input_data[input_pos], input_length - input_pos, boundary_byte, escape_byte);
+        if (run > (output_length - output_pos))
+        {
+            // happens if output is too small and input has lots of special bytes
+            return 0;
+        }
+        memcpy(&output_data[output_pos], &input_data[input_pos], run);
+        input_pos += run;
+        output_pos += run;
+
+        if (input_pos < input_length)
         {
             // all special characters are escaped
-            *output_it = escape_byte;
-            output_it++;
-            if (output_it == output.end())
+            if ((output_length - output_pos) < 2)
             {
-                // happens if output is too small and input has lots of special bytes
                 return 0;
             }
-            data ^= mask;
+            output_data[output_pos] = escape_byte;
+            output_data[output_pos + 1] = static_cast<uint8_t>(input_data[input_pos] ^ mask);
+            output_pos += 2;
+            input_pos++;
         }
-        *output_it = data;
-
-        input_it++;
-        output_it++;
     }
-    if (output_it == output.end())
+    if (output_pos == output_length)
     {
         // happens if output is too small and input has lots of special bytes
         return 0;
     }
-    *output_it = boundary_byte;
-    output_it++;
+    output_data[output_pos] = boundary_byte;
+    output_pos++;
 
-    size_t out_length = std::distance(output.begin(), output_it);
-    output = output.first(out_length);
-    return out_length;
+    output = output.first(output_pos);
+    return output_pos;
 }
 
 size_t
 HdlcStuffing::decode(outpost::Slice<const uint8_t> const& input, outpost::Slice<uint8_t>& output)
 {
-    auto input_it = input.begin();
-    auto input_frame_start = input_it;  // returned if no end marker is found
-    auto output_it = output.begin();
+    const uint8_t* input_data = input.getDataPointer();
+    const size_t input_length = input.getNumberOfElements();
+    uint8_t* output_data = output.getDataPointer();
+    const size_t output_length = output.getNumberOfElements();
+
+    size_t input_pos = 0;
+    size_t input_frame_start = 0;  // returned if no end marker is found
+    size_t output_pos = 0;
 
     bool escaped = false;
     bool inframe = false;
-    while (input_it != input.end())
+    while (input_pos < input_length)
     {
-        uint8_t data = *input_it;
+        if (!inframe)
+        {
+            // everything outside of a frame is skipped
+            input_pos += ByteScan::find(
+                    &input_data[input_pos], input_length - input_pos, boundary_byte);
+            if (input_pos == input_length)
+            {
+                break;
+            }
+
+            // start of a frame
+            input_frame_start = input_pos;
+            output_pos = 0;
+            inframe = true;
+            input_pos++;
+            continue;
+        }
+
+        if (!escaped)
+        {
+            // bytes up to the next special character are copied unchanged
+            const size_t run = ByteScan::findAnyOf(
+                    &input_data[input_pos], input_length - input_pos, boundary_byte, escape_byte);
+            if (run > (output_length - output_pos))
+            {
+                // end of output stream reached without an end frame boundary
+                output = output.first(0);
+                // as no end frame marker was found: return distance to frame start marker to
+                // allow cutting
+                return input_frame_start;
+            }
+            if (run > 0)
+            {
+                // memmove instead of memcpy is needed here because the input and output
+                // array may overlap.
+                memmove(&output_data[output_pos], &input_data[input_pos], run);
+                input_pos += run;
+                output_pos += run;
+            }
+            if (input_pos == input_length)
+            {
+                break;
+            }
+        }
+
+        uint8_t data = input_data[input_pos];
         if (data == boundary_byte)
         {
-            if (inframe)
+            if (escaped)
             {
-                if (escaped)
-                {
-                    // escaped boundary bytes are aborts
-                    output = output.first(0);
-                }
-                else
-                {
-                    output = output.first(std::distance(output.begin(), output_it));
-                }
-                // frame marker of abort might still be the start of the next frame, so the
-                // aborted frame can be skipped
-                return std::distance(input.begin(), input_it);
+                // escaped boundary bytes are aborts
+                output = output.first(0);
             }
             else
             {
-                // start of a frame
-                input_frame_start = input_it;
-                output_it = output.begin();
-                inframe = true;
+                output = output.first(output_pos);
             }
+            // frame marker of abort might still be the start of the next frame, so the
+            // aborted frame can be skipped
+            return input_pos;
         }
         else if (data == escape_byte)
         {
@@ -115,41 +169,31 @@ HdlcStuffing::decode(outpost::Slice<const uint8_t> const& input, outpost::Slice<
             {
                 // two escape bytes following each other are invalid
                 output = output.first(0);
-                return std::distance(input.begin(), input_it);
-            }
-            if (inframe)
-            {
-                // next byte is escaped, only useful if in frame
-                escaped = true;
+                return input_pos;
             }
+            // next byte is escaped
+            escaped = true;
         }
         else
         {
-            if (inframe)
+            // only escaped bytes reach this point
+            if (output_pos == output_length)
             {
-                if (output_it != output.end())
-                {
-                    *output_it = (!escaped) ? data : (data ^ mask);
-                    output_it++;
-                }
-                else
-                {
-                    // end of output stream reached without an end frame boundary
-                    output = output.first(0);
-                    // as no end frame marker was found: return distance to frame start marker to
-                    // allow cutting
-                    return std::distance(input.begin(), input_frame_start);
-                }
+                // end of output stream reached without an end frame boundary
+                output = output.first(0);
+                return input_frame_start;
             }
+            output_data[output_pos] = static_cast<uint8_t>(data ^ mask);
+            output_pos++;
             escaped = false;  // the next byte is not escaped
         }
-        input_it++;
+        input_pos++;
     }
 
     // end of the input reached without an end frame boundary
     output = output.first(0);
     // as no end frame marker was found: return distance to frame start marker to allow cutting
-    return std::distance(input.begin(), input_frame_start);
+    return input_frame_start;
 }
 
 }  // namespace utils
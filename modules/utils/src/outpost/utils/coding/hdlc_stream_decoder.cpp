@@ -0,0 +1,231 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "hdlc_stream_decoder.h"
+
+#include "byte_scan.h"
+#include "hdlc.h"
+
+#include <string.h>  // for memcpy
+
+using outpost::utils::HdlcStreamDecoder;
+using outpost::utils::HdlcStuffing;
+
+HdlcStreamDecoder::HdlcStreamDecoder(outpost::Slice<uint8_t> buffer,
+                                     const FrameHandler& handler) :
+    mBuffer(buffer),
+    mHandler(handler),
+    mPool(nullptr),
+    mFrames(nullptr),
+    mSharedBuffer(),
+    mLength(0),
+    mInFrame(false),
+    mEscaped(false),
+    mNumberOfFrames(0),
+    mNumberOfErrors(0),
+    mNumberOfDroppedFrames(0)
+{
+}
+
+HdlcStreamDecoder::HdlcStreamDecoder(SharedBufferPoolBase& pool, SharedRingBuffer& frames) :
+    mBuffer(outpost::Slice<uint8_t>::empty()),
+    mHandler(),
+    mPool(&pool),
+    mFrames(&frames),
+    mSharedBuffer(),
+    mLength(0),
+    mInFrame(false),
+    mEscaped(false),
+    mNumberOfFrames(0),
+    mNumberOfErrors(0),
+    mNumberOfDroppedFrames(0)
+{
+}
+
+HdlcStreamDecoder::~HdlcStreamDecoder()
+{
+}
+
+size_t
+HdlcStreamDecoder::push(outpost::Slice<const uint8_t> input)
+{
+    const size_t initialNumberOfFrames = mNumberOfFrames;
+    const uint8_t* data = input.getDataPointer();
+    const size_t length = input.getNumberOfElements();
+
+    size_t position = 0;
+    while (position < length)
+    {
+        if (!mInFrame)
+        {
+            // everything outside of a frame is skipped
+            position += ByteScan::find(
+                    &data[position], length - position, HdlcStuffing::boundary_byte);
+            if (position == length)
+            {
+                break;
+            }
+            position++;
+            startFrame();
+            continue;
+        }
+
+        if (!mEscaped)
+        {
+            // bytes up to the next special character are copied unchanged
+            const size_t run = ByteScan::findAnyOf(&data[position],
+                                                   length - position,
+                                                   HdlcStuffing::boundary_byte,
+                                                   HdlcStuffing::escape_byte);
+            if ((run > 0) && !acquireBuffer())
+            {
+                position += run;
+                continue;
+            }
+            if (run > (mBuffer.getNumberOfElements() - mLength))
+            {
+                mNumberOfErrors++;
+                discardFrame();
+                position += run;
+                continue;
+            }
+            if (run > 0)
+            {
+                memcpy(mBuffer.getDataPointer() + mLength, &data[position], run);
+                mLength += run;
+                position += run;
+            }
+            if (position == length)
+            {
+                break;
+            }
+        }
+
+        const uint8_t value = data[position];
+        position++;
+        if (value == HdlcStuffing::boundary_byte)
+        {
+            if (mEscaped)
+            {
+                // escaped boundary bytes are aborts
+                mNumberOfErrors++;
+            }
+            else if (mLength > 0)
+            {
+                emitFrame();
+            }
+            // the end marker is also the start marker of the next frame
+            startFrame();
+        }
+        else if (value == HdlcStuffing::escape_byte)
+        {
+            if (mEscaped)
+            {
+                // two escape bytes following each other are invalid
+                mNumberOfErrors++;
+                discardFrame();
+            }
+            else
+            {
+                mEscaped = true;
+            }
+        }
+        else
+        {
+            // only escaped bytes reach this point
+            if (!acquireBuffer())
+            {
+                // frame is dropped
+            }
+            else if (mLength == mBuffer.getNumberOfElements())
+            {
+                mNumberOfErrors++;
+                discardFrame();
+            }
+            else
+            {
+                mBuffer[mLength] = static_cast<uint8_t>(value ^ HdlcStuffing::mask);
+                mLength++;
+                mEscaped = false;
+            }
+        }
+    }
+
+    return mNumberOfFrames - initialNumberOfFrames;
+}
+
+void
+HdlcStreamDecoder::reset()
+{
+    discardFrame();
+}
+
+void
+HdlcStreamDecoder::startFrame()
+{
+    mLength = 0;
+    mEscaped = false;
+    mInFrame = true;
+}
+
+bool
+HdlcStreamDecoder::acquireBuffer()
+{
+    if ((mPool == nullptr) || mSharedBuffer.isValid())
+    {
+        return true;
+    }
+
+    // Buffers are only allocated for non-empty frames
+    if (mPool->allocate(mSharedBuffer))
+    {
+        mBuffer = mSharedBuffer;
+        return true;
+    }
+
+    mNumberOfDroppedFrames++;
+    discardFrame();
+    return false;
+}
+
+void
+HdlcStreamDecoder::discardFrame()
+{
+    mLength = 0;
+    mEscaped = false;
+    mInFrame = false;
+}
+
+void
+HdlcStreamDecoder::emitFrame()
+{
+    if (mFrames != nullptr)
+    {
+        SharedChildPointer frame;
+        if (mSharedBuffer.getChild(frame, 0, 0, mLength) && mFrames->append(frame))
+        {
+            mNumberOfFrames++;
+
+            // The buffer now belongs to the frame, the next frame needs a new one
+            mSharedBuffer = SharedBufferPointer();
+            mBuffer = outpost::Slice<uint8_t>::empty();
+        }
+        else
+        {
+            mNumberOfDroppedFrames++;
+        }
+    }
+    else
+    {
+        OperationResult result;
+        mHandler.execute(result, mBuffer.first(mLength));
+        mNumberOfFrames++;
+    }
+}
@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_HDLC_STREAM_DECODER_H
+#define OUTPOST_UTILS_HDLC_STREAM_DECODER_H
+
+#include <outpost/base/slice.h>
+#include <outpost/utils/container/shared_buffer.h>
+#include <outpost/utils/container/shared_object_pool.h>
+#include <outpost/utils/container/shared_ring_buffer.h>
+#include <outpost/utils/functor.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace outpost
+{
+namespace utils
+{
+/**
+ * Resumable HDLC decoder for a continuous byte stream.
+ *
+ * In contrast to HdlcStuffing::decode() the decoder keeps its state
+ * between calls, so received data can be supplied in chunks of arbitrary
+ * size without re-parsing a partially received frame. Every input byte
+ * is processed exactly once and all frames completed within a chunk are
+ * emitted, either
+ *
+ * - through a callback with a slice of a work buffer owned by the
+ *   caller, or
+ * - as SharedBufferPointers appended to a SharedRingBuffer. The frames
+ *   are decoded directly into buffers allocated from a pool.
+ *
+ * Frames are decoded as by HdlcStuffing::decode(). Frames terminated by
+ * an escaped boundary byte (abort), frames containing two consecutive
+ * escape bytes and frames exceeding the buffer size are discarded. A
+ * boundary byte ends a frame and starts the next one, consecutive
+ * boundary bytes (empty frames) are ignored.
+ *
+ * \see HdlcStuffing
+ */
+class HdlcStreamDecoder
+{
+public:
+    typedef Functor<void(outpost::Slice<const uint8_t> frame)> FrameHandler;
+
+    /**
+     * Construct a decoder passing the frames to a callback.
+     *
+     * \param buffer
+     *     Work buffer for the frame being decoded. Defines the maximum
+     *     frame length.
+     * \param handler
+     *     Called for every decoded frame. The frame is only valid during
+     *     the call.
+     */
+    HdlcStreamDecoder(outpost::Slice<uint8_t> buffer, const FrameHandler& handler);
+
+    /**
+     * Construct a decoder storing the frames in a ring buffer.
+     *
+     * \param pool
+     *     Pool from which the buffers for the frames are allocated. The
+     *     element size defines the maximum frame length.
+     * \param frames
+     *     Receives a child pointer of the pool buffer for every frame.
+     */
+    HdlcStreamDecoder(SharedBufferPoolBase& pool, SharedRingBuffer& frames);
+
+    ~HdlcStreamDecoder();
+
+    /**
+     * Decode a chunk of received data.
+     *
+     * \param input
+     *     Received HDLC stuffed data.
+     *
+     * \return
+     *     Number of frames completed within \p input.
+     */
+    size_t
+    push(outpost::Slice<const uint8_t> input);
+
+    /**
+     * Discard the current frame and wait for the next boundary byte.
+     */
+    void
+    reset();
+
+    /**
+     * Number of frames successfully decoded.
+     */
+    inline size_t
+    getNumberOfFrames() const
+    {
+        return mNumberOfFrames;
+    }
+
+    /**
+     * Number of frames discarded because of aborts, invalid escape
+     * sequences or because they exceeded the buffer size.
+     */
+    inline size_t
+    getNumberOfErrors() const
+    {
+        return mNumberOfErrors;
+    }
+
+    /**
+     * Number of frames dropped because no buffer was available in the
+     * pool or the ring buffer was full.
+     */
+    inline size_t
+    getNumberOfDroppedFrames() const
+    {
+        return mNumberOfDroppedFrames;
+    }
+
+private:
+    // disable copy constructor
+    HdlcStreamDecoder(const HdlcStreamDecoder&);
+
+    // disable copy-assignment operator
+    HdlcStreamDecoder&
+    operator=(const HdlcStreamDecoder&);
+
+    /// Called after a boundary byte
+    void
+    startFrame();
+
+    /**
+     * Allocate a buffer from the pool if required.
+     *
+     * \retval false
+     *     No buffer available, the frame has been discarded.
+     */
+    bool
+    acquireBuffer();
+
+    /// Discard the current frame and skip until the next boundary byte
+    void
+    discardFrame();
+
+    /// Called for every non-empty frame terminated by a boundary byte
+    void
+    emitFrame();
+
+    outpost::Slice<uint8_t> mBuffer;
+    FrameHandler mHandler;
+
+    SharedBufferPoolBase* mPool;
+    SharedRingBuffer* mFrames;
+    SharedBufferPointer mSharedBuffer;
+
+    size_t mLength;
+    bool mInFrame;
+    bool mEscaped;
+
+    size_t mNumberOfFrames;
+    size_t mNumberOfErrors;
+    size_t mNumberOfDroppedFrames;
+};
+
+}  // namespace utils
+}  // namespace outpost
+
+#endif
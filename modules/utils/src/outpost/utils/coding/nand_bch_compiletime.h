@@ -53,6 +53,11 @@ public:
     decode(const outpost::Slice<const uint8_t>& coded_data,
            const outpost::Slice<uint8_t>& dst_data) override;
 
+    DecodeStatus
+    decodeSectors(const outpost::Slice<const uint8_t>& coded_data,
+                  const outpost::Slice<uint8_t>& dest_data,
+                  const outpost::Slice<DecodeStatus>& sectorStatus) override;
+
     inline uint32_t
     getNumberOfRedundantBytes(void) const override
     {
@@ -65,6 +70,12 @@ public:
         return mNandDataSize;
     }
 
+    inline uint32_t
+    getNumberOfSparebytes(void) const override
+    {
+        return mNandSpareSize;
+    }
+
     inline bool
     isTemplateParameterValid(void) const override
     {
@@ -76,6 +87,15 @@ public:
     isChecksumEmpty(const outpost::Slice<const uint8_t>& data) override;
 
 private:
+    /**
+     * Decode all sectors of a page, the status of the sectors is stored
+     * in \p sectorStatus unless it is a null pointer.
+     */
+    DecodeStatus
+    decodePage(const outpost::Slice<const uint8_t>& coded_data,
+               const outpost::Slice<uint8_t>& dest_data,
+               DecodeStatus* sectorStatus);
+
     struct ALogTable;
     struct LogTable;
     struct QuadCompTable;
@@ -156,6 +176,10 @@ private:
     static constexpr QuadCompTable mQuadCompTable = genQuadCompTable();
 
     static constexpr uint32_t BYTESTATES = 256;
+    // Number of encode tables, data is processed four bytes per step
+    static constexpr uint32_t ENCODE_SLICES = 4;
+    // Number of positions evaluated per iteration of the Chien search
+    static constexpr uint32_t CHIEN_BATCH = 8;
 
     static constexpr uint32_t ZERO_DIV_RETURN_VALUE = 1;
 
@@ -164,6 +188,9 @@ private:
     uint32_t mLoc[(2 * mTParam) + 1];
     uint32_t mSyndromes[numSyndromes];
 
+    static constexpr void
+    shiftDataWord(uint32_t SR[], const uint8_t* data);
+
     constexpr void
     bchEncode(void);
 
@@ -278,7 +305,7 @@ private:
     struct EncodeTable
     {
         constexpr EncodeTable() : encodeTable{} {};
-        uint32_t encodeTable[BYTESTATES * mNumRedundantWords];
+        uint32_t encodeTable[ENCODE_SLICES * BYTESTATES * mNumRedundantWords];
 
         struct Column
         {
@@ -43,10 +43,86 @@ combine(DecodeStatus a, DecodeStatus b)
     }
 }
 
+DecodeStatus
+NandBCHInterface::decodeSectors(const outpost::Slice<const uint8_t>& coded_data,
+                                const outpost::Slice<uint8_t>& dest_data,
+                                const outpost::Slice<DecodeStatus>& sectorStatus)
+{
+    const uint32_t sectors = getNumberOfSectors();
+    if (sectorStatus.getNumberOfElements() < sectors)
+    {
+        return DecodeStatus::invalidParameters;
+    }
+
+    // decode() does not tell which sector has been corrected
+    const DecodeStatus status = decode(coded_data, dest_data);
+    for (uint32_t i = 0; i < sectors; i++)
+    {
+        sectorStatus[i] = status;
+    }
+    return status;
+}
+
+uint32_t
+NandBCHInterface::getNumberOfSparebytes(void) const
+{
+    return getNumberOfRedundantBytes();
+}
+
+bool
+NandBCHInterface::encodePages(const outpost::Slice<const uint8_t>& src_data,
+                              const outpost::Slice<uint8_t>& coded_data,
+                              uint32_t numberOfPages)
+{
+    const uint32_t dataSize = getNumberOfDatabytes();
+    const uint32_t pageSize = getPageSize();
+    if ((src_data.getNumberOfElements() < static_cast<size_t>(numberOfPages) * dataSize)
+        || (coded_data.getNumberOfElements() < static_cast<size_t>(numberOfPages) * pageSize))
+    {
+        return false;
+    }
+
+    bool success = true;
+    for (uint32_t page = 0; page < numberOfPages; page++)
+    {
+        success &= encode(src_data.subSlice(page * dataSize, dataSize),
+                          coded_data.subSlice(page * pageSize, pageSize));
+    }
+    return success;
+}
+
+DecodeStatus
+NandBCHInterface::decodePages(const outpost::Slice<const uint8_t>& coded_data,
+                              const outpost::Slice<uint8_t>& dest_data,
+                              const outpost::Slice<DecodeStatus>& sectorStatus,
+                              uint32_t numberOfPages)
+{
+    const uint32_t dataSize = getNumberOfDatabytes();
+    const uint32_t pageSize = getPageSize();
+    const uint32_t sectors = getNumberOfSectors();
+    if ((coded_data.getNumberOfElements() < static_cast<size_t>(numberOfPages) * pageSize)
+        || (dest_data.getNumberOfElements() < static_cast<size_t>(numberOfPages) * dataSize)
+        || (sectorStatus.getNumberOfElements() < static_cast<size_t>(numberOfPages) * sectors))
+    {
+        return DecodeStatus::invalidParameters;
+    }
+
+    DecodeStatus status = DecodeStatus::noError;
+    for (uint32_t page = 0; page < numberOfPages; page++)
+    {
+        status = combine(status,
+                         decodeSectors(coded_data.subSlice(page * pageSize, pageSize),
+                                       dest_data.subSlice(page * dataSize, dataSize),
+                                       sectorStatus.subSlice(page * sectors, sectors)));
+    }
+    return status;
+}
+
 // default values
 constexpr uint32_t NandBCHInterface::DEF_GALIOS_DIMENISIONS;
 constexpr uint32_t NandBCHInterface::DEF_ERROR_CORRECTION;
 constexpr uint8_t NandBCHInterface::fillValue;
+constexpr uint32_t NandBCHInterface::sectorSize;
 
 }  // namespace utils
 }  // namespace outpost
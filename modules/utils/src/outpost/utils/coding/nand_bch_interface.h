@@ -45,6 +45,8 @@ public:
     static constexpr uint32_t DEF_ERROR_CORRECTION = 8;  // Default error correction power in bits
     static constexpr uint8_t fillValue =
             0x00;  // value to fill up if less data then nand page data size s provided
+    // size of the sectors a page is divided into, every sector is protected separately
+    static constexpr uint32_t sectorSize = 512;
 
     NandBCHInterface() = default;
 
@@ -61,12 +63,89 @@ public:
     decode(const outpost::Slice<const uint8_t>& coded_data,
            const outpost::Slice<uint8_t>& src_data) = 0;
 
+    /**
+     * Decode a page and report the status of every sector.
+     *
+     * The default implementation decodes the page with decode() and
+     * reports the combined status for every sector.
+     *
+     * \param sectorStatus
+     *     Receives the status of the sectors of the page, must hold at
+     *     least getNumberOfSectors() elements.
+     *
+     * \return
+     *     Combined status of all sectors.
+     */
+    virtual DecodeStatus
+    decodeSectors(const outpost::Slice<const uint8_t>& coded_data,
+                  const outpost::Slice<uint8_t>& dest_data,
+                  const outpost::Slice<DecodeStatus>& sectorStatus);
+
+    /**
+     * Encode several consecutive pages.
+     *
+     * \param src_data
+     *     Data of the pages, getNumberOfDatabytes() bytes per page.
+     * \param coded_data
+     *     Receives the encoded pages, getPageSize() bytes per page.
+     *
+     * \return
+     *     false if the buffers are too small or a page could not be encoded.
+     */
+    bool
+    encodePages(const outpost::Slice<const uint8_t>& src_data,
+                const outpost::Slice<uint8_t>& coded_data,
+                uint32_t numberOfPages);
+
+    /**
+     * Decode several consecutive pages.
+     *
+     * \param coded_data
+     *     Encoded pages, getPageSize() bytes per page.
+     * \param dest_data
+     *     Receives the data of the pages, getNumberOfDatabytes() bytes per page.
+     * \param sectorStatus
+     *     Receives the status of every sector, getNumberOfSectors()
+     *     elements per page.
+     *
+     * \return
+     *     Combined status of all sectors, invalidParameters if one of the
+     *     buffers is too small.
+     */
+    DecodeStatus
+    decodePages(const outpost::Slice<const uint8_t>& coded_data,
+                const outpost::Slice<uint8_t>& dest_data,
+                const outpost::Slice<DecodeStatus>& sectorStatus,
+                uint32_t numberOfPages);
+
     virtual uint32_t
     getNumberOfRedundantBytes(void) const = 0;
 
     virtual uint32_t
     getNumberOfDatabytes(void) const = 0;
 
+    /**
+     * Size of the spare area of a page.
+     *
+     * Defaults to getNumberOfRedundantBytes(), implementations with a
+     * larger spare area must override it.
+     */
+    virtual uint32_t
+    getNumberOfSparebytes(void) const;
+
+    inline uint32_t
+    getNumberOfSectors(void) const
+    {
+        return getNumberOfDatabytes() / sectorSize;
+    }
+
+    // size of an encoded page
+    inline uint32_t
+    getPageSize(void) const
+    {
+        return getNumberOfDatabytes() + getNumberOfSparebytes();
+    }
+
     virtual bool
     isTemplateParameterValid(void) const = 0;
 
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "nand_bch_parallel.h"
+
+#include <outpost/rtos/mutex_guard.h>
+
+namespace outpost
+{
+namespace utils
+{
+NandBCHParallelCodec::NandBCHParallelCodec(NandBCHInterface& codec) :
+    mCodec(codec),
+    mWorkers(nullptr),
+    mNumberOfWorkers(0),
+    mBatchMutex(),
+    mPageMutex(),
+    mFinished(0),
+    mOperation(Operation::encode),
+    mInput(outpost::Slice<const uint8_t>::empty()),
+    mOutput(outpost::Slice<uint8_t>::empty()),
+    mSectorStatus(outpost::Slice<DecodeStatus>::empty()),
+    mNumberOfPages(0),
+    mNextPage(0)
+{
+}
+
+bool
+NandBCHParallelCodec::addWorker(NandBCHWorker& worker)
+{
+    outpost::rtos::MutexGuard lock(mBatchMutex);
+    if ((worker.mParent != nullptr)
+        || (worker.mCodec.getNumberOfDatabytes() != mCodec.getNumberOfDatabytes())
+        || (worker.mCodec.getNumberOfSparebytes() != mCodec.getNumberOfSparebytes()))
+    {
+        return false;
+    }
+
+    worker.mParent = this;
+    worker.mNext = mWorkers;
+    mWorkers = &worker;
+    mNumberOfWorkers++;
+    return true;
+}
+
+bool
+NandBCHParallelCodec::encodePages(const outpost::Slice<const uint8_t>& src_data,
+                                  const outpost::Slice<uint8_t>& coded_data,
+                                  uint32_t numberOfPages)
+{
+    const size_t dataSize = mCodec.getNumberOfDatabytes();
+    const size_t pageSize = mCodec.getPageSize();
+    if ((src_data.getNumberOfElements() < numberOfPages * dataSize)
+        || (coded_data.getNumberOfElements() < numberOfPages * pageSize))
+    {
+        return false;
+    }
+
+    outpost::rtos::MutexGuard lock(mBatchMutex);
+    mOperation = Operation::encode;
+    mInput = src_data;
+    mOutput = coded_data;
+    mSectorStatus = outpost::Slice<DecodeStatus>::empty();
+    mNumberOfPages = numberOfPages;
+
+    bool success = true;
+    DecodeStatus status = DecodeStatus::noError;
+    runBatch(success, status);
+    return success;
+}
+
+DecodeStatus
+NandBCHParallelCodec::decodePages(const outpost::Slice<const uint8_t>& coded_data,
+                                  const outpost::Slice<uint8_t>& dest_data,
+                                  const outpost::Slice<DecodeStatus>& sectorStatus,
+                                  uint32_t numberOfPages)
+{
+    const size_t dataSize = mCodec.getNumberOfDatabytes();
+    const size_t pageSize = mCodec.getPageSize();
+    const size_t sectors = mCodec.getNumberOfSectors();
+    if ((coded_data.getNumberOfElements() < numberOfPages * pageSize)
+        || (dest_data.getNumberOfElements() < numberOfPages * dataSize)
+        || (sectorStatus.getNumberOfElements() < numberOfPages * sectors))
+    {
+        return DecodeStatus::invalidParameters;
+    }
+
+    outpost::rtos::MutexGuard lock(mBatchMutex);
+    mOperation = Operation::decode;
+    mInput = coded_data;
+    mOutput = dest_data;
+    mSectorStatus = sectorStatus;
+    mNumberOfPages = numberOfPages;
+
+    bool success = true;
+    DecodeStatus status = DecodeStatus::noError;
+    runBatch(success, status);
+    return status;
+}
+
+void
+NandBCHParallelCodec::runBatch(bool& success, DecodeStatus& status)
+{
+    mNextPage = 0;
+    for (NandBCHWorker* worker = mWorkers; worker != nullptr; worker = worker->mNext)
+    {
+        worker->mStart.release();
+    }
+
+    processPages(mCodec, success, status);
+
+    for (uint32_t i = 0; i < mNumberOfWorkers; i++)
+    {
+        mFinished.acquire();
+    }
+
+    // The semaphores order the accesses, the results of the workers are
+    // visible here
+    for (NandBCHWorker* worker = mWorkers; worker != nullptr; worker = worker->mNext)
+    {
+        success &= worker->mSuccess;
+        status = combine(status, worker->mStatus);
+    }
+}
+
+void
+NandBCHParallelCodec::processPages(NandBCHInterface& codec, bool& success, DecodeStatus& status)
+{
+    const uint32_t dataSize = codec.getNumberOfDatabytes();
+    const uint32_t pageSize = codec.getPageSize();
+    const uint32_t sectors = codec.getNumberOfSectors();
+
+    uint32_t page = 0;
+    while (takeNextPage(page))
+    {
+        // Every page uses separate parts of the buffers, no locking required
+        if (mOperation == Operation::encode)
+        {
+            success &= codec.encode(mInput.subSlice(page * dataSize, dataSize),
+                                    mOutput.subSlice(page * pageSize, pageSize));
+        }
+        else
+        {
+            status = combine(status,
+                             codec.decodeSectors(mInput.subSlice(page * pageSize, pageSize),
+                                                 mOutput.subSlice(page * dataSize, dataSize),
+                                                 mSectorStatus.subSlice(page * sectors, sectors)));
+        }
+    }
+}
+
+bool
+NandBCHParallelCodec::takeNextPage(uint32_t& page)
+{
+    outpost::rtos::MutexGuard lock(mPageMutex);
+    if (mNextPage >= mNumberOfPages)
+    {
+        return false;
+    }
+    page = mNextPage;
+    mNextPage++;
+    return true;
+}
+
+NandBCHWorker::NandBCHWorker(NandBCHInterface& codec,
+                             uint8_t priority,
+                             size_t stackSize,
+                             const char* name) :
+    outpost::rtos::Thread(priority, stackSize, name),
+    mCodec(codec),
+    mParent(nullptr),
+    mNext(nullptr),
+    mStart(0),
+    mSuccess(true),
+    mStatus(DecodeStatus::noError)
+{
+}
+
+void
+NandBCHWorker::run()
+{
+    while (true)
+    {
+        if (mStart.acquire())
+        {
+            mSuccess = true;
+            mStatus = DecodeStatus::noError;
+            mParent->processPages(mCodec, mSuccess, mStatus);
+            mParent->mFinished.release();
+        }
+    }
+}
+
+}  // namespace utils
+}  // namespace outpost
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_NAND_BCH_PARALLEL_H
+#define OUTPOST_UTILS_NAND_BCH_PARALLEL_H
+
+#include "nand_bch_interface.h"
+
+#include <outpost/base/slice.h>
+#include <outpost/rtos/mutex.h>
+#include <outpost/rtos/semaphore.h>
+#include <outpost/rtos/thread.h>
+
+#include <stdint.h>
+
+namespace outpost
+{
+namespace utils
+{
+class NandBCHWorker;
+
+/**
+ * Encode and decode batches of NAND pages with several threads.
+ *
+ * A NandBCHInterface instance keeps the state of the sector currently
+ * processed and can only be used by one thread at a time. Every worker
+ * therefore owns a separate codec instance. The pages of a batch are
+ * distributed dynamically, every thread takes the next unprocessed page
+ * until all pages are done. The calling thread takes part in the
+ * processing with the codec given to the constructor.
+ *
+ * All workers have to be registered and started before the first batch,
+ * see addWorker().
+ *
+ * The layout of the buffers is identical to
+ * NandBCHInterface::encodePages() and NandBCHInterface::decodePages(),
+ * so the results do not depend on the number of workers.
+ *
+ * Example:
+ *
+ *     NandBCHCTime<13, 8, 2048, 64> codec;
+ *     NandBCHCTime<13, 8, 2048, 64> workerCodec;
+ *
+ *     NandBCHParallelCodec parallel(codec);
+ *     NandBCHWorker worker(workerCodec, priority);
+ *     parallel.addWorker(worker);
+ *     worker.start();
+ *
+ *     parallel.decodePages(codedData, data, sectorStatus, numberOfPages);
+ */
+class NandBCHParallelCodec
+{
+public:
+    explicit NandBCHParallelCodec(NandBCHInterface& codec);
+
+    /**
+     * Register a worker.
+     *
+     * Every registered worker must have been started with
+     * NandBCHWorker::start() before the first call of encodePages() or
+     * decodePages(). A batch waits for all registered workers, with a
+     * worker which has not been started it blocks forever.
+     *
+     * \return
+     *     false if the worker is already registered or its codec uses a
+     *     different page layout.
+     */
+    bool
+    addWorker(NandBCHWorker& worker);
+
+    inline uint32_t
+    getNumberOfWorkers() const
+    {
+        return mNumberOfWorkers;
+    }
+
+    /**
+     * \see NandBCHInterface::encodePages()
+     */
+    bool
+    encodePages(const outpost::Slice<const uint8_t>& src_data,
+                const outpost::Slice<uint8_t>& coded_data,
+                uint32_t numberOfPages);
+
+    /**
+     * \see NandBCHInterface::decodePages()
+     */
+    DecodeStatus
+    decodePages(const outpost::Slice<const uint8_t>& coded_data,
+                const outpost::Slice<uint8_t>& dest_data,
+                const outpost::Slice<DecodeStatus>& sectorStatus,
+                uint32_t numberOfPages);
+
+private:
+    friend class NandBCHWorker;
+
+    enum class Operation
+    {
+        encode,
+        decode
+    };
+
+    // disable copy constructor
+    NandBCHParallelCodec(const NandBCHParallelCodec&);
+
+    // disable copy-assignment operator
+    NandBCHParallelCodec&
+    operator=(const NandBCHParallelCodec&);
+
+    /**
+     * Distribute the pages of the current batch to the workers and the
+     * calling thread. Returns after all pages have been processed.
+     */
+    void
+    runBatch(bool& success, DecodeStatus& status);
+
+    /**
+     * Process pages of the current batch until none are left.
+     */
+    void
+    processPages(NandBCHInterface& codec, bool& success, DecodeStatus& status);
+
+    bool
+    takeNextPage(uint32_t& page);
+
+    NandBCHInterface& mCodec;
+    NandBCHWorker* mWorkers;
+    uint32_t mNumberOfWorkers;
+
+    // Serializes the batches and the registration of workers
+    outpost::rtos::Mutex mBatchMutex;
+
+    // Protects mNextPage
+    outpost::rtos::Mutex mPageMutex;
+
+    // Released by every worker after it has finished its pages
+    outpost::rtos::Semaphore mFinished;
+
+    // Current batch
+    Operation mOperation;
+    outpost::Slice<const uint8_t> mInput;
+    outpost::Slice<uint8_t> mOutput;
+    outpost::Slice<DecodeStatus> mSectorStatus;
+    uint32_t mNumberOfPages;
+    uint32_t mNextPage;
+};
+
+/**
+ * Worker thread of a NandBCHParallelCodec.
+ *
+ * The codec is used exclusively by the worker and must not be shared
+ * with other threads.
+ */
+class NandBCHWorker : public outpost::rtos::Thread
+{
+public:
+    NandBCHWorker(NandBCHInterface& codec,
+                  uint8_t priority,
+                  size_t stackSize = outpost::rtos::Thread::defaultStackSize,
+                  const char* name = "BCH");
+
+protected:
+    void
+    run() override;
+
+private:
+    friend class NandBCHParallelCodec;
+
+    NandBCHInterface& mCodec;
+    NandBCHParallelCodec* mParent;
+    NandBCHWorker* mNext;
+
+    // Released once per batch by the parent
+    outpost::rtos::Semaphore mStart;
+
+    // Result of the pages processed by this worker in the current batch
+    bool mSuccess;
+    DecodeStatus mStatus;
+};
+
+}  // namespace utils
+}  // namespace outpost
+
+#endif
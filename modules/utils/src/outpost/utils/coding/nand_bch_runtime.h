@@ -31,7 +31,7 @@ namespace utils
  * Warning: Functions not thread-safe add mutexes or us different instances of class.
  *
  * Note: For use different instance  compile time version is suggested as this (with default values)
- *       only requires 704 bytes per instance, compared to this class with 98656 bytes per instance
+ *       only requires 704 bytes per instance, compared to this class with 67720 bytes per instance
  *       (for default values)
  */
 template <uint32_t mMParam, uint32_t mTParam, uint32_t mNandDataSize, uint32_t mNandSpareSize>
@@ -56,6 +56,11 @@ public:
     decode(const outpost::Slice<const uint8_t>& coded_data,
            const outpost::Slice<uint8_t>& dest_data) override;
 
+    DecodeStatus
+    decodeSectors(const outpost::Slice<const uint8_t>& coded_data,
+                  const outpost::Slice<uint8_t>& dest_data,
+                  const outpost::Slice<DecodeStatus>& sectorStatus) override;
+
     inline uint32_t
     getNumberOfRedundantBytes(void) const override
     {
@@ -68,6 +73,12 @@ public:
         return mNandDataSize;
     }
 
+    inline uint32_t
+    getNumberOfSparebytes(void) const override
+    {
+        return mNandSpareSize;
+    }
+
     inline bool
     isTemplateParameterValid(void) const override
     {
@@ -78,10 +89,23 @@ public:
     isChecksumEmpty(const outpost::Slice<const uint8_t>& data) override;
 
 private:
+    /**
+     * Decode all sectors of a page, the status of the sectors is stored
+     * in \p sectorStatus unless it is a null pointer.
+     */
+    DecodeStatus
+    decodePage(const outpost::Slice<const uint8_t>& coded_data,
+               const outpost::Slice<uint8_t>& dest_data,
+               DecodeStatus* sectorStatus);
+
     static constexpr uint32_t mFFSize = outpost::PowerOfTwo<mMParam>::value;
     static constexpr uint32_t MAX_REDUN_WORDS = (((mTParam * mMParam) / 8 + 1) / 4 + 1);
     static constexpr uint32_t BYTESTATES = 256;
     static constexpr uint32_t MAX_NUM_SYM = (2 * mTParam);
+    // Number of encode tables, data is processed four bytes per step
+    static constexpr uint32_t ENCODE_SLICES = 4;
+    // Number of positions evaluated per iteration of the Chien search
+    static constexpr uint32_t CHIEN_BATCH = 8;
 
     static constexpr uint32_t ZERO_DIV_RETURN_VALUE = 1;
 
@@ -123,7 +147,7 @@ private:
     uint32_t genPolyBitArray[mTParam * mMParam + 1];
     uint32_t genPolyDegree;
     uint32_t genPolyFdbkWords[((mTParam * mMParam) / 8 + 1) / 4 + 1];
-    uint32_t encodeTable[BYTESTATES][MAX_REDUN_WORDS];
+    uint32_t encodeTable[ENCODE_SLICES * BYTESTATES][MAX_REDUN_WORDS];
     std::bitset<mFFSize> generatedRoots;  // need the place here otherwise blow stack
 
     int32_t
@@ -168,6 +192,9 @@ private:
     void
     generateEncodeTables(void);
 
+    void
+    shiftDataWord(uint32_t SR[], const uint8_t* data) const;
+
     void
     bchEncode(void);
 
@@ -467,6 +467,11 @@ NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::generateEncodeTab
     //
     //  The feedback words are highest order in lowest address and the
     //  resulting encode table is organized the same way.
+    //
+    //  The table is followed by ENCODE_SLICES - 1 further tables.  Table
+    //  n holds the shift register value for a byte followed by n zero
+    //  bytes.  They allow four bytes to be processed per step, see
+    //  shiftDataWord().
     //****************************************************************
 
     // Gen Encode Table
@@ -506,6 +511,22 @@ NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::generateEncodeTab
             encodeTable[i][k] = SR[k];  // Move SR to encode table
         }
     }
+
+    // Shift the entries of the previous table by one zero byte
+    for (uint32_t i = BYTESTATES; i < ENCODE_SLICES * BYTESTATES; i++)
+    {
+        uint32_t fdbk = 0;
+        for (int32_t nnn = mNumRedundantWords - 1; nnn >= 0; nnn--)
+        {
+            uint32_t fdbkSav = fdbk;
+            fdbk = encodeTable[i - BYTESTATES][nnn] >> 24;
+            encodeTable[i][nnn] = (encodeTable[i - BYTESTATES][nnn] << 8) ^ fdbkSav;
+        }
+        for (uint32_t k = 0; k < mNumRedundantWords; k++)
+        {
+            encodeTable[i][k] ^= encodeTable[fdbk][k];
+        }
+    }
 }
 
 template <uint32_t mMParam, uint32_t mTParam, uint32_t mNandDataSize, uint32_t mNandSpareSize>
@@ -639,6 +660,42 @@ NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::ffCubeRoot(int32_
     }
 }
 
+template <uint32_t mMParam, uint32_t mTParam, uint32_t mNandDataSize, uint32_t mNandSpareSize>
+inline void
+NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::shiftDataWord(
+        uint32_t SR[], const uint8_t* data) const
+{
+    //****************************************************************
+    //  Function: shiftDataWord
+    //
+    //  Shifts four data bytes into the shift register (slicing-by-4).
+    //  The four high order bytes of the shift register are combined
+    //  with the data bytes, the remaining words move up by one word.
+    //  Every combined byte is then looked up in the table which
+    //  continues the division for the number of bytes following it.
+    //  The result is identical to shifting the bytes one by one.
+    //****************************************************************
+    const uint32_t fdbk = SR[0]
+                          ^ ((static_cast<uint32_t>(data[0]) << 24)
+                             | (static_cast<uint32_t>(data[1]) << 16)
+                             | (static_cast<uint32_t>(data[2]) << 8) | data[3]);
+    for (uint32_t k = 0; k + 1 < mNumRedundantWords; k++)
+    {
+        SR[k] = SR[k + 1];
+    }
+    SR[mNumRedundantWords - 1] = 0;
+
+    const uint32_t index3 = 3 * BYTESTATES + (fdbk >> 24);
+    const uint32_t index2 = 2 * BYTESTATES + ((fdbk >> 16) & 0x000000ff);
+    const uint32_t index1 = BYTESTATES + ((fdbk >> 8) & 0x000000ff);
+    const uint32_t index0 = fdbk & 0x000000ff;
+    for (uint32_t k = 0; k < mNumRedundantWords; k++)
+    {
+        SR[k] ^= encodeTable[index3][k] ^ encodeTable[index2][k] ^ encodeTable[index1][k]
+                 ^ encodeTable[index0][k];
+    }
+}
+
 template <uint32_t mMParam, uint32_t mTParam, uint32_t mNandDataSize, uint32_t mNandSpareSize>
 void
 NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::bchEncode(void)
@@ -648,7 +705,8 @@ NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::bchEncode(void)
     //
     //  This is the encoder.  It performs its function byte parallel using
     //  an encode table that is built during initialization.  It processes
-    //  one byte at a time regardless of the size of the finite field.
+    //  four bytes at a time regardless of the size of the finite field,
+    //  see shiftDataWord().
     //
     //  The parallel approach shifts a software shift register implementing the
     //  code generator polynomial once per obj->mCodeWord byte even though the binary
@@ -671,24 +729,10 @@ NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::bchEncode(void)
     // +5 So that we can temporarily keep remainder bytes in whole words
     uint8_t redunByteArray[(mTParam * mMParam) / 8 + 5]{{}};
 
-    for (uint16_t writeCWAddr = 0; writeCWAddr < mNumDataBytes; writeCWAddr++)
-    {  // index to write data buffer
-        uint32_t fdbk = 0;
-        for (int32_t i = mNumRedundantWords - 1; i >= 0; i--)
-        {
-            // IT IS POSSIBLE TO UNROLL THIS LOOP USING A SWITCH STATEMENT.
-            // WILL HAVE TO PROCESS FROM HIGH ADDRESS BACK TOWARDS ZERO
-            uint32_t fdbkSav = fdbk;
-            // 32 bits per int32_t - but process 8 bits at a time (8 bits unrelated to "m")
-            fdbk = (SR[i] >> 24) & 0x000000ff;
-            SR[i] = (SR[i] << 8) ^ fdbkSav;  // 8 # bits in parallel - unrelated to "m"
-        }
-        fdbk ^= mCodeWord[writeCWAddr];
-        // IT IS POSSIBLE TO UNROLL THIS LOOP USING A SWITCH STATEMENT
-        for (uint32_t kx = 0; kx < mNumRedundantWords; kx++)
-        {
-            SR[kx] ^= encodeTable[fdbk][kx];
-        }
+    // Four data bytes per step, mNumDataBytes is a multiple of four
+    for (uint32_t writeCWAddr = 0; writeCWAddr < mNumDataBytes; writeCWAddr += 4)
+    {
+        shiftDataWord(SR, &mCodeWord[writeCWAddr]);
     }
     // Copy redundancy bytes from shift register (SR) word array
     for (uint32_t kx = 0; kx < mNumRedundantWords; kx++)
@@ -750,42 +794,23 @@ NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::computeRemainder(
     ;
 
     // SHIFTS WITH FEEDBACK
-    for (uint32_t readCWAddr = 0; readCWAddr < mNumDataBytes; readCWAddr++)
-    {  // index to write data buffer
-        uint32_t fdbk = 0;
-        for (int32_t nnn = mNumRedundantWords - 1; nnn >= 0; nnn--)
-        {
-            // IT IS POSSIBLE TO UNROLL THIS LOOP USING A SWITCH STATEMENT.
-            // WILL HAVE TO PROCESS FROM HIGH ADDRESS BACK TOWARDS ZERO
-            uint32_t fdbkSav = fdbk;
-            fdbk = (SR[nnn] >> 24);              // 32 - # bits in word (unrelated to "m")
-            SR[nnn] = (SR[nnn] << 8) ^ fdbkSav;  // 8 # bits in parallel - unrelated to "m"
-        }
-        fdbk ^= mCodeWord[readCWAddr];
-        for (uint32_t k = 0; k < mNumRedundantWords; k++)
-        {
-            // IT IS POSSIBLE TO UNROLL THIS LOOP
-            SR[k] ^= encodeTable[fdbk][k];
-        }
+    // Four data bytes per step, mNumDataBytes is a multiple of four
+    for (uint32_t readCWAddr = 0; readCWAddr < mNumDataBytes; readCWAddr += 4)
+    {
+        shiftDataWord(SR, &mCodeWord[readCWAddr]);
     }
     // SHIFTS WITHOUT FEEDBACK
     // Line below - This flag will be set later if the remainder is non zero.
     // Non-zero means either corr or uncorr err.  We will know which after decoding.
     int32_t remainderDetdErr = 0;
 
-    // index to code word buffer
-    for (uint32_t readCWAddr = mNumDataBytes; readCWAddr < mNumDataBytes + mNumRedundantBytes;
-         readCWAddr++)
+    // Shifting without feedback moves the bytes of the shift register to
+    // the top one after another, so they are read directly from the words.
+    for (uint32_t i = 0; i < mNumRedundantBytes; i++)
     {
-        uint32_t fdbk = 0;
-        for (int32_t nnn = mNumRedundantWords - 1; nnn >= 0; nnn--)
-        {
-            uint32_t fdbkSav = fdbk;
-            fdbk = (SR[nnn] >> 24);              // 32 - # bits in parallel (unrelated to "m")
-            SR[nnn] = (SR[nnn] << 8) ^ fdbkSav;  // 8 # bits in parallel - unrelated to "m"
-        }
-        fdbk ^= mCodeWord[readCWAddr];
-        mRemainderBytes[readCWAddr - mNumDataBytes] = static_cast<int32_t>(fdbk);
+        const uint32_t srByte = (SR[i / 4] >> (24 - 8 * (i % 4))) & 0x000000ff;
+        const uint8_t fdbk = static_cast<uint8_t>(srByte ^ mCodeWord[mNumDataBytes + i]);
+        mRemainderBytes[i] = fdbk;
         if (fdbk != 0)
         {
             remainderDetdErr = 1;
@@ -835,14 +860,18 @@ NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::computeSyndromes(
             {
                 // 9-10-10 Changed for speed
                 uint32_t accumVal = (((mNumRedundantBytes - 1) - i) * 8 + j);  // Initialize
-                uint32_t bumpVal = 2 * accumVal;                               // Initialize
+                // Reduced once, so a compare & subtract replaces the mod below
+                const uint32_t bumpVal = (2 * accumVal) % mNParam;  // Initialize
                 // Note increment by 2
                 for (uint32_t k = 0; k < numSyndromes; k += 2)
                 {
                     //  "+1" is for syndrome offset
                     mSyndromes[k] ^= aLogTable[accumVal];
                     accumVal += bumpVal;  // Add 2*preComputeVal
-                    accumVal = accumVal % mNParam;
+                    if (accumVal >= mNParam)
+                    {
+                        accumVal -= mNParam;
+                    }
                 }
             }
             mask *= 2;
@@ -1040,13 +1069,17 @@ NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::chienSearch(int32
     //  or less ("m" odd).  To optimize speed two different techniques are
     //  used to advance the ELP for its next evaluation.
     //
-    //  For this code a fast technique is used when there are no zero
-    //  coefficients in the ELP.  A slower technique is used when there are
-    //  zero coefficients in the ELP. The probability that there are zero
-    //  coefficients in the ELP is relatively low.  Also for speed the ELP
-    //  is divided down each time a root is found.  Also for speed the inner
-    //  most loop of the faster technique is unrolled.  Again for speed, mod
-    //  operations are replaced with equivalent but faster operations.
+    //  The ELP is evaluated at CHIEN_BATCH consecutive positions per
+    //  iteration.  Every coefficient is advanced through the whole batch
+    //  in the inner loop, the evaluations for the different positions are
+    //  accumulated independently.  This removes the dependency between
+    //  successive evaluations and the loop over the coefficients is
+    //  executed only once per batch.  Zero coefficients are skipped.
+    //  When a root is found within a batch, the coefficients are
+    //  positioned at the root and the search continues with the following
+    //  position.  Also for speed the ELP is divided down each time a root
+    //  is found.  Again for speed, mod operations are replaced with
+    //  equivalent but faster operations.
     //  My original knowledge of unrolling loops came from the Earl
     //  Cohen Ph.D. thesis (Berkeley).  See also the Glover-Dudley patent
     //  4,839,896.
@@ -1073,98 +1106,107 @@ NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::chienSearch(int32
     //
     //****************************************************************
     uint32_t Ln = LnOrig;
-    // Check for a zero coeff before converting to log domain and if find one, set flag
-    int32_t coeffContainsAZero = 0;
-    for (uint32_t i = 1; i <= Ln; i++)
-    {
-        if (sigmaN[i] == 0)
-        {
-            coeffContainsAZero = 1;
-            break;
-        }
-    }
     // Convert error locator poly to log domain for Chien Search
     for (uint32_t n = 1; n <= Ln; n++)
     {
         sigmaN[n] = logTable[sigmaN[n]];
     }
-    for (uint32_t n = 0; n < mNumCodeWordBytes * 8; n++)
+    const uint32_t numPositions = mNumCodeWordBytes * 8;
+    uint32_t n = 0;
+    while (n < numPositions)
     {
-        int32_t accum = 0;
-        // Do simple Chien Search if zero coeffs or if Ln>8.  YOU CANNOT
-        // CHANGE THE # 8 IN "Ln>8" WITHOUT ADDING MORE ENTRIES FOR THE
-        // UNROLLED LOOP
-        if (coeffContainsAZero == 1 || Ln > 8)
+        // The last batch may evaluate positions beyond the code word,
+        // roots found there are ignored
+        uint32_t batchSize = numPositions - n;
+        if (batchSize > CHIEN_BATCH)
         {
-            for (uint32_t jj = 1; jj <= Ln; jj++)
-            {  // One step of Simple Chien Search in this loop
-                if (sigmaN[jj] != static_cast<int32_t>(mLogZVal))
-                {  // Test for log of zero
-                    accum ^= aLogTable[sigmaN[jj]];
-                    sigmaN[jj] -= jj;
-                    if (sigmaN[jj] < 0)
+            batchSize = CHIEN_BATCH;
+        }
+
+        int32_t accum[CHIEN_BATCH] = {0};
+        int32_t sigmaNext[mTParam + 1] = {0};
+        for (uint32_t jj = 1; jj <= Ln; jj++)
+        {
+            int32_t sigmaVal = sigmaN[jj];
+            if (sigmaVal != static_cast<int32_t>(mLogZVal))
+            {  // Test for log of zero
+                for (uint32_t p = 0; p < CHIEN_BATCH; p++)
+                {
+                    accum[p] ^= aLogTable[sigmaVal];
+                    sigmaVal -= jj;
+                    if (sigmaVal < 0)
                     {  // Compare & subtract is faster than mod
-                        sigmaN[jj] += mNParam;
+                        sigmaVal += mNParam;
                     }
                 }
             }
+            sigmaNext[jj] = sigmaVal;
         }
-        else
+
+        uint32_t root = 0;
+        while (root < batchSize && accum[root] != 1)
         {
-            for (uint32_t i = Ln; i > 0; i--)
-            {
-                accum ^= aLogTable[sigmaN[i]];  // accum is XOR sum of all alogs
-                sigmaN[i] -= i;
-                if (sigmaN[i] < 0)
-                {
-                    sigmaN[i] += mNParam;
-                }
-            }
+            root++;
         }
-        if (accum == 1)
+        if (root == batchSize)
         {
-            mLoc[Ln - 1] = aLogTable[n % (mFFSize)];
-            // Convert back to alog domain so we can divide down
-            for (uint32_t i = 1; i <= Ln; i++)
-            {
-                sigmaN[i] = aLogTable[sigmaN[i]];
-            }
-            // Divide down the ELP to eliminate the root just found
-            int32_t reg = 0;
-            for (int32_t kx = Ln; kx >= 0; kx--)
-            {
-                int32_t tmp = ffMult(reg, aLogTable[1]);  // The number "1"
-                reg = sigmaN[kx] ^ tmp;
-                sigmaN[kx] = tmp;
-            }
-            Ln--;  // Ln must be decremented right here - do not move
-            // Check if any coefficients are zero and set flag appropriately
-            coeffContainsAZero = 0;
-            for (uint32_t i = 1; i <= Ln; i++)
+            for (uint32_t jj = 1; jj <= Ln; jj++)
             {
-                if (sigmaN[i] == 0)
-                {
-                    coeffContainsAZero = 1;
-                    break;
-                }
+                sigmaN[jj] = sigmaNext[jj];
             }
-            // If degree reduced, special cases will take it from here
-            if ((Ln == 4 && mMOddParam == 0) || (Ln == 2 && mMOddParam == 1))  // 4 and 2
+            n += batchSize;
+            continue;
+        }
+
+        // Position the ELP as it would be after evaluating the root
+        for (uint32_t jj = 1; jj <= Ln; jj++)
+        {
+            if (sigmaN[jj] != static_cast<int32_t>(mLogZVal))
             {
-                // We are still in alog domain so,
-                // position the ELP back to its starting point for special cases
-                for (uint32_t i = 1; i <= Ln; i++)
+                for (uint32_t p = 0; p <= root; p++)
                 {
-                    sigmaN[i] = ffMult(sigmaN[i], aLogTable[((n + 1) * i) % mNParam]);
+                    sigmaN[jj] -= jj;
+                    if (sigmaN[jj] < 0)
+                    {
+                        sigmaN[jj] += mNParam;
+                    }
                 }
-                break;
             }
-            // Convert back to log domain so we can continue root search
+        }
+        n += root;
+
+        mLoc[Ln - 1] = aLogTable[n % (mFFSize)];
+        // Convert back to alog domain so we can divide down
+        for (uint32_t i = 1; i <= Ln; i++)
+        {
+            sigmaN[i] = aLogTable[sigmaN[i]];
+        }
+        // Divide down the ELP to eliminate the root just found
+        int32_t reg = 0;
+        for (int32_t kx = Ln; kx >= 0; kx--)
+        {
+            int32_t tmp = ffMult(reg, aLogTable[1]);  // The number "1"
+            reg = sigmaN[kx] ^ tmp;
+            sigmaN[kx] = tmp;
+        }
+        Ln--;  // Ln must be decremented right here - do not move
+        // If degree reduced, special cases will take it from here
+        if ((Ln == 4 && mMOddParam == 0) || (Ln == 2 && mMOddParam == 1))  // 4 and 2
+        {
+            // We are still in alog domain so,
+            // position the ELP back to its starting point for special cases
             for (uint32_t i = 1; i <= Ln; i++)
             {
-                sigmaN[i] = logTable[sigmaN[i]];
+                sigmaN[i] = ffMult(sigmaN[i], aLogTable[((n + 1) * i) % mNParam]);
             }
+            break;
         }
+        // Convert back to log domain so we can continue root search
+        for (uint32_t i = 1; i <= Ln; i++)
+        {
+            sigmaN[i] = logTable[sigmaN[i]];
+        }
+        n++;
     }
     // If degree of ELP has not been reduced properly
     if ((Ln != 4 && mMOddParam == 0) || (Ln != 2 && mMOddParam == 1))
@@ -1601,6 +1643,30 @@ template <uint32_t mMParam, uint32_t mTParam, uint32_t mNandDataSize, uint32_t m
 DecodeStatus
 NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::decode(
         const outpost::Slice<const uint8_t>& coded_data, const outpost::Slice<uint8_t>& dest_data)
+{
+    return decodePage(coded_data, dest_data, nullptr);
+}
+
+template <uint32_t mMParam, uint32_t mTParam, uint32_t mNandDataSize, uint32_t mNandSpareSize>
+DecodeStatus
+NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::decodeSectors(
+        const outpost::Slice<const uint8_t>& coded_data,
+        const outpost::Slice<uint8_t>& dest_data,
+        const outpost::Slice<DecodeStatus>& sectorStatus)
+{
+    if (sectorStatus.getNumberOfElements() < mNandDataSize / mNumDataBytes)
+    {
+        return DecodeStatus::invalidParameters;
+    }
+    return decodePage(coded_data, dest_data, &sectorStatus[0]);
+}
+
+template <uint32_t mMParam, uint32_t mTParam, uint32_t mNandDataSize, uint32_t mNandSpareSize>
+DecodeStatus
+NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::decodePage(
+        const outpost::Slice<const uint8_t>& coded_data,
+        const outpost::Slice<uint8_t>& dest_data,
+        DecodeStatus* sectorStatus)
 {
     if (coded_data.getNumberOfElements() < mNandDataSize + mNandSpareSize || !mValid)
     {
@@ -1622,7 +1688,12 @@ NandBCHRTime<mMParam, mTParam, mNandDataSize, mNandSpareSize>::decode(
                (mNumRedundantBytes));
 
         /* Perform decoding */
-        status = combine(status, bchDecode());
+        const DecodeStatus sectorResult = bchDecode();
+        status = combine(status, sectorResult);
+        if (sectorStatus != nullptr)
+        {
+            sectorStatus[i] = sectorResult;
+        }
 
         // Copy anyways, we tell them whether it is correct or not
         if (dest_data.getNumberOfElements() >= ((i + 1) * mNumDataBytes))
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_MPSC_REFERENCE_QUEUE_H
+#define OUTPOST_UTILS_MPSC_REFERENCE_QUEUE_H
+
+#include "receiver_signal.h"
+#include "reference_queue.h"
+
+#include <outpost/rtos/mutex.h>
+#include <outpost/rtos/mutex_guard.h>
+#include <outpost/rtos/semaphore.h>
+#include <outpost/rtos/thread.h>
+#include <outpost/utils/atomic_support.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+#include <atomic>
+#endif
+
+namespace outpost
+{
+namespace utils
+{
+/**
+ * \ingroup SharedBuffer
+ * \brief Bounded queue for several sending threads and a single receiving thread.
+ *
+ * Drop-in replacement for ReferenceQueue if only one thread receives
+ * from the queue, e.g. the BusHandlerThread of the software bus.
+ *
+ * The elements are stored in a ring of N slots. Each slot has a sequence
+ * number which tells whether it is free or holds an element for the
+ * current round through the ring. A sender reserves a slot by advancing
+ * the shared write position with a compare-and-swap, the only point where
+ * senders are serialized, and then publishes the element by updating the
+ * sequence number of the slot. No lock is taken and no free slot is
+ * searched.
+ *
+ * The receiver only waits on a semaphore if the queue is empty, see
+ * ReceiverSignal.
+ *
+ * Sending never blocks, send() returns false immediately if the queue is
+ * full. The timeout is ignored.
+ *
+ * Targets without lock-free atomic operations use a mutex protected ring
+ * instead (see OUTPOST_UTILS_LOCK_FREE_ATOMICS).
+ *
+ * \tparam T Type of the elements
+ * \tparam N Maximum number of elements in the queue
+ */
+template <typename T, size_t N>
+class MpscReferenceQueue : public ReferenceQueueBase<T>
+{
+public:
+    static_assert(N >= 2, "Queue must hold at least two elements");
+
+    MpscReferenceQueue();
+
+    virtual ~MpscReferenceQueue() = default;
+
+    // disable copy constructor
+    MpscReferenceQueue(const MpscReferenceQueue&) = delete;
+
+    // disable copy-assignment operator
+    MpscReferenceQueue&
+    operator=(const MpscReferenceQueue&) = delete;
+
+    /**
+     * \brief Send data to the queue, may be called by several threads.
+     *
+     * \param data Data to be sent.
+     * \return Returns true if data could be sent, false if the queue is full.
+     */
+    bool
+    send(T& data, outpost::time::Duration timeout) override;
+
+    /**
+     * \brief Receive data from the queue, must only be called by a single thread.
+     *
+     * Can be either blocking (timeout > 0) or non-blocking (timeout = 0).
+     */
+    bool
+    receive(T& data, outpost::time::Duration timeout) override;
+
+    uint16_t
+    getNumberOfItems() override;
+
+    bool
+    isEmpty() override;
+
+    bool
+    isFull() override;
+
+    using Sender<T>::send;
+    using Receiver<T>::receive;
+
+private:
+    bool
+    tryReceive(T& data);
+
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+    // Positions wrap around at a multiple of N so that the index of a slot
+    // stays continuous. The wrap-around is smaller than half of the range of
+    // size_t, the distance of two positions can therefore be calculated.
+    static constexpr size_t wrapAround = ((static_cast<size_t>(-1) / 2) / N) * N;
+
+    static constexpr size_t cacheLineSize = 64;
+
+    static inline size_t
+    advance(size_t position, size_t steps)
+    {
+        return (position + steps) % wrapAround;
+    }
+
+    /// Signed distance from \p from to \p to
+    static inline ptrdiff_t
+    distance(size_t from, size_t to)
+    {
+        const size_t difference = (to + wrapAround - from) % wrapAround;
+        return (difference > (wrapAround / 2)) ? -static_cast<ptrdiff_t>(wrapAround - difference)
+                                               : static_cast<ptrdiff_t>(difference);
+    }
+
+    struct Slot
+    {
+        // Equal to the position of the slot if free, position + 1 if used
+        std::atomic<size_t> mSequence;
+        T mValue;
+    };
+
+    Slot mSlots[N];
+
+    // Written by the senders and the receiver, kept on separate cache lines
+    alignas(cacheLineSize) std::atomic<size_t> mWritePosition;
+    alignas(cacheLineSize) std::atomic<size_t> mReadPosition;
+
+    ReceiverSignal mSignal;
+#else
+    outpost::rtos::Mutex mMutex;
+    outpost::rtos::Semaphore mNumberOfElements;
+
+    size_t mReadIndex;
+    size_t mItemsInQueue;
+    T mValues[N];
+#endif
+};
+
+}  // namespace utils
+}  // namespace outpost
+
+#include "mpsc_reference_queue_impl.h"
+
+#endif
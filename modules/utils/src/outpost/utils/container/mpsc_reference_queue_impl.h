@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_MPSC_REFERENCE_QUEUE_IMPL_H
+#define OUTPOST_UTILS_MPSC_REFERENCE_QUEUE_IMPL_H
+
+#include "mpsc_reference_queue.h"
+
+namespace outpost
+{
+namespace utils
+{
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+template <typename T, size_t N>
+constexpr size_t MpscReferenceQueue<T, N>::wrapAround;
+
+template <typename T, size_t N>
+constexpr size_t MpscReferenceQueue<T, N>::cacheLineSize;
+
+template <typename T, size_t N>
+MpscReferenceQueue<T, N>::MpscReferenceQueue() : mWritePosition(0), mReadPosition(0)
+{
+    for (size_t i = 0; i < N; i++)
+    {
+        mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T, size_t N>
+bool
+MpscReferenceQueue<T, N>::send(T& data, outpost::time::Duration)
+{
+    size_t position = mWritePosition.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true)
+    {
+        slot = &mSlots[position % N];
+        const size_t sequence = slot->mSequence.load(std::memory_order_acquire);
+        const ptrdiff_t difference = distance(position, sequence);
+        if (difference == 0)
+        {
+            // Slot is free, try to reserve it
+            if (mWritePosition.compare_exchange_weak(
+                        position, advance(position, 1), std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // Slot still holds the element of the previous round
+            return false;
+        }
+        else
+        {
+            // Slot has been reserved by another sender
+            position = mWritePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->mValue = data;
+    slot->mSequence.store(advance(position, 1), std::memory_order_release);
+
+    mSignal.notify();
+    return true;
+}
+
+template <typename T, size_t N>
+bool
+MpscReferenceQueue<T, N>::tryReceive(T& data)
+{
+    const size_t position = mReadPosition.load(std::memory_order_relaxed);
+    Slot& slot = mSlots[position % N];
+    if (slot.mSequence.load(std::memory_order_acquire) != advance(position, 1))
+    {
+        return false;
+    }
+
+    data = slot.mValue;
+    // Drop the reference held by the queue
+    slot.mValue = T();
+    slot.mSequence.store(advance(position, N), std::memory_order_release);
+    mReadPosition.store(advance(position, 1), std::memory_order_relaxed);
+    return true;
+}
+
+template <typename T, size_t N>
+bool
+MpscReferenceQueue<T, N>::receive(T& data, outpost::time::Duration timeout)
+{
+    return mSignal.wait([this, &data]() { return tryReceive(data); }, timeout);
+}
+
+template <typename T, size_t N>
+uint16_t
+MpscReferenceQueue<T, N>::getNumberOfItems()
+{
+    const ptrdiff_t items = distance(mReadPosition.load(std::memory_order_relaxed),
+                                     mWritePosition.load(std::memory_order_relaxed));
+    if (items <= 0)
+    {
+        return 0;
+    }
+    const size_t count = static_cast<size_t>(items);
+    return static_cast<uint16_t>((count > N) ? N : count);
+}
+#else
+template <typename T, size_t N>
+MpscReferenceQueue<T, N>::MpscReferenceQueue() :
+    mNumberOfElements(0), mReadIndex(0), mItemsInQueue(0), mValues()
+{
+}
+
+template <typename T, size_t N>
+bool
+MpscReferenceQueue<T, N>::send(T& data, outpost::time::Duration)
+{
+    {
+        outpost::rtos::MutexGuard lock(mMutex);
+        if (mItemsInQueue == N)
+        {
+            return false;
+        }
+        mValues[(mReadIndex + mItemsInQueue) % N] = data;
+        mItemsInQueue++;
+    }
+    mNumberOfElements.release();
+    return true;
+}
+
+template <typename T, size_t N>
+bool
+MpscReferenceQueue<T, N>::tryReceive(T& data)
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    data = mValues[mReadIndex];
+    mValues[mReadIndex] = T();
+    mReadIndex = (mReadIndex + 1) % N;
+    mItemsInQueue--;
+    return true;
+}
+
+template <typename T, size_t N>
+bool
+MpscReferenceQueue<T, N>::receive(T& data, outpost::time::Duration timeout)
+{
+    // Every element in the ring is counted by the semaphore
+    if (!mNumberOfElements.acquire(timeout))
+    {
+        return false;
+    }
+    return tryReceive(data);
+}
+
+template <typename T, size_t N>
+uint16_t
+MpscReferenceQueue<T, N>::getNumberOfItems()
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    return static_cast<uint16_t>(mItemsInQueue);
+}
+#endif
+
+template <typename T, size_t N>
+bool
+MpscReferenceQueue<T, N>::isEmpty()
+{
+    return getNumberOfItems() == 0;
+}
+
+template <typename T, size_t N>
+bool
+MpscReferenceQueue<T, N>::isFull()
+{
+    return getNumberOfItems() >= N;
+}
+
+}  // namespace utils
+}  // namespace outpost
+
+#endif
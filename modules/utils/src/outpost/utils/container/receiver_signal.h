@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_RECEIVER_SIGNAL_H
+#define OUTPOST_UTILS_RECEIVER_SIGNAL_H
+
+#include <outpost/rtos/clock.h>
+#include <outpost/rtos/semaphore.h>
+#include <outpost/rtos/thread.h>
+#include <outpost/time/duration.h>
+#include <outpost/utils/atomic_support.h>
+
+#include <stdint.h>
+
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+namespace outpost
+{
+namespace utils
+{
+/**
+ * Wakes up the single receiver of a lock-free queue.
+ *
+ * The receiver only waits on the semaphore if the queue is empty. Before
+ * that it yields a few times, which lets a preempted sender on the same
+ * core continue without a context switch per element. Senders release
+ * the semaphore only when the receiver is waiting.
+ */
+class ReceiverSignal
+{
+public:
+    ReceiverSignal() :
+        mReceiverWaiting(false), mSignal(outpost::rtos::BinarySemaphore::State::acquired)
+    {
+    }
+
+    // disable copy constructor
+    ReceiverSignal(const ReceiverSignal&) = delete;
+
+    // disable copy-assignment operator
+    ReceiverSignal&
+    operator=(const ReceiverSignal&) = delete;
+
+    /**
+     * Called by a sender after an element has been published.
+     */
+    inline void
+    notify()
+    {
+        // Pairs with the fence in wait(), either the receiver sees the new
+        // element or the sender sees the waiting receiver.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (mReceiverWaiting.load(std::memory_order_relaxed)
+            && mReceiverWaiting.exchange(false, std::memory_order_relaxed))
+        {
+            mSignal.release();
+        }
+    }
+
+    /**
+     * Poll the queue until an element has been received or the timeout
+     * has expired.
+     *
+     * A signal for an earlier wait may wake the receiver before an
+     * element is available, it waits again for the remaining time.
+     *
+     * \param poll
+     *      Function object which tries to receive an element without
+     *      blocking, returns true on success.
+     * \return
+     *      False if no element has been received within the timeout.
+     */
+    template <typename Poll>
+    bool
+    wait(Poll poll, outpost::time::Duration timeout);
+
+private:
+    static constexpr uint32_t numberOfPollsBeforeWait = 4;
+
+    std::atomic<bool> mReceiverWaiting;
+    outpost::rtos::BinarySemaphore mSignal;
+};
+
+template <typename Poll>
+bool
+ReceiverSignal::wait(Poll poll, outpost::time::Duration timeout)
+{
+    if (poll())
+    {
+        return true;
+    }
+    if (timeout <= outpost::time::Duration::zero())
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < numberOfPollsBeforeWait; i++)
+    {
+        outpost::rtos::Thread::yield();
+        if (poll())
+        {
+            return true;
+        }
+    }
+
+    // Long timeouts are passed on unchanged, the deadline would overflow
+    const bool unlimited = (timeout >= outpost::time::Duration::myriad());
+    outpost::rtos::SystemClock clock;
+    const outpost::time::SpacecraftElapsedTime deadline =
+            unlimited ? outpost::time::SpacecraftElapsedTime::startOfEpoch()
+                      : (clock.now() + timeout);
+    outpost::time::Duration remaining = timeout;
+    while (true)
+    {
+        // Discard a signal from a sender which has seen an earlier wait
+        mSignal.acquire(outpost::time::Duration::zero());
+
+        mReceiverWaiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (poll())
+        {
+            mReceiverWaiting.store(false, std::memory_order_relaxed);
+            return true;
+        }
+        mSignal.acquire(remaining);
+        mReceiverWaiting.store(false, std::memory_order_relaxed);
+
+        if (poll())
+        {
+            return true;
+        }
+        if (!unlimited)
+        {
+            const outpost::time::SpacecraftElapsedTime now = clock.now();
+            if (now >= deadline)
+            {
+                return false;
+            }
+            remaining = deadline - now;
+        }
+    }
+}
+
+}  // namespace utils
+}  // namespace outpost
+
+#endif
+
+#endif
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "reference_counter.h"
+
+namespace outpost
+{
+namespace utils
+{
+namespace reference_counter
+{
+outpost::rtos::Mutex MutexProtected::mMutex;
+}  // namespace reference_counter
+}  // namespace utils
+}  // namespace outpost
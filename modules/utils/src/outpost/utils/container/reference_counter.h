@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_REFERENCE_COUNTER_H
+#define OUTPOST_UTILS_REFERENCE_COUNTER_H
+
+#include <outpost/rtos/mutex.h>
+#include <outpost/rtos/mutex_guard.h>
+#include <outpost/utils/atomic_support.h>
+
+#include <stddef.h>
+
+// Lock-free reference counting is used on targets with lock-free atomic
+// operations. Can be overridden by defining the macro to 0 or 1 in the
+// build configuration.
+#if !defined(OUTPOST_UTILS_ATOMIC_REFERENCE_COUNTER)
+#define OUTPOST_UTILS_ATOMIC_REFERENCE_COUNTER OUTPOST_UTILS_LOCK_FREE_ATOMICS
+#endif
+
+#if OUTPOST_UTILS_ATOMIC_REFERENCE_COUNTER
+#include <atomic>
+#endif
+
+namespace outpost
+{
+namespace utils
+{
+namespace reference_counter
+{
+#if OUTPOST_UTILS_ATOMIC_REFERENCE_COUNTER
+/**
+ * Lock-free reference counter.
+ *
+ * Taking a reference does not need to be ordered with any other memory
+ * access, the thread already holds a reference. Releasing a reference
+ * uses acquire-release ordering: the accesses of every holder happen
+ * before its decrement, and the thread dropping the last reference sees
+ * all of them before it frees the object. Readers of the count use
+ * acquire ordering, a thread that sees zero may therefore reuse the
+ * object.
+ */
+class Atomic
+{
+public:
+    Atomic() : mCount(0)
+    {
+    }
+
+    // disable copy constructor
+    Atomic(const Atomic&) = delete;
+
+    // disable copy-assignment operator
+    Atomic&
+    operator=(const Atomic&) = delete;
+
+    inline void
+    increment()
+    {
+        mCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Decrement the counter, a counter of zero is left unchanged.
+     *
+     * \return
+     *     true if this call has released the last reference.
+     */
+    inline bool
+    decrement()
+    {
+        size_t count = mCount.load(std::memory_order_relaxed);
+        while (count > 0)
+        {
+            if (mCount.compare_exchange_weak(
+                        count, count - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                return count == 1;
+            }
+        }
+        return false;
+    }
+
+    inline size_t
+    get() const
+    {
+        return mCount.load(std::memory_order_acquire);
+    }
+
+private:
+    std::atomic<size_t> mCount;
+};
+#endif
+
+/**
+ * Reference counter protected by a mutex shared between all instances.
+ *
+ * Fallback for targets without lock-free atomic operations. Each change
+ * is cheap compared to the lock, so a single mutex avoids the memory
+ * overhead of one mutex per counter.
+ */
+class MutexProtected
+{
+public:
+    MutexProtected() : mCount(0)
+    {
+    }
+
+    // disable copy constructor
+    MutexProtected(const MutexProtected&) = delete;
+
+    // disable copy-assignment operator
+    MutexProtected&
+    operator=(const MutexProtected&) = delete;
+
+    inline void
+    increment()
+    {
+        outpost::rtos::MutexGuard lock(mMutex);
+        mCount++;
+    }
+
+    /**
+     * \see Atomic::decrement()
+     */
+    inline bool
+    decrement()
+    {
+        outpost::rtos::MutexGuard lock(mMutex);
+        if (mCount > 0)
+        {
+            mCount--;
+            return mCount == 0;
+        }
+        return false;
+    }
+
+    inline size_t
+    get() const
+    {
+        outpost::rtos::MutexGuard lock(mMutex);
+        return mCount;
+    }
+
+private:
+    static outpost::rtos::Mutex mMutex;
+
+    size_t mCount;
+};
+
+#if OUTPOST_UTILS_ATOMIC_REFERENCE_COUNTER
+typedef Atomic Default;
+#else
+typedef MutexProtected Default;
+#endif
+
+}  // namespace reference_counter
+}  // namespace utils
+}  // namespace outpost
+
+#endif
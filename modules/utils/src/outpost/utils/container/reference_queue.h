@@ -66,13 +66,9 @@ public:
 protected:
     /**
      * \brief Constructor for a ReferenceQueueBase. May only be called by its derivatives (i.e.
-     * ReferenceQueue) \param N Maximum number of elements in the queue
+     * ReferenceQueue)
      */
-    inline ReferenceQueueBase(size_t N) : mQueue(N)
-    {
-    }
-
-    outpost::rtos::Queue<size_t> mQueue;
+    ReferenceQueueBase() = default;
 };
 
 /**
@@ -88,7 +84,7 @@ public:
      * \brief Standard constructor.
      */
     ReferenceQueue() :
-        ReferenceQueueBase<T>(N), mEmpty(), mItemsInQueue(0), mLastIndex(0), mPointers{{}}
+        ReferenceQueueBase<T>(), mQueue(N), mEmpty(), mItemsInQueue(0), mLastIndex(0), mPointers{{}}
     {
         for (size_t i = 0; i < N; i++)
         {
@@ -158,7 +154,7 @@ public:
                 mPointers[i] = data;
                 mIsUsed[i] = true;
                 mLastIndex = (i + 1) % N;
-                if (ReferenceQueueBase<T>::mQueue.send(i))
+                if (mQueue.send(i))
                 {
                     mItemsInQueue++;
                     res = true;
@@ -191,7 +187,7 @@ public:
     {
         bool res = false;
         size_t index;
-        if (ReferenceQueueBase<T>::mQueue.receive(index, timeout))
+        if (mQueue.receive(index, timeout))
         {
             outpost::rtos::MutexGuard lock(mMutex);
             data = mPointers[index];
@@ -218,6 +214,8 @@ public:
     using Receiver<T>::receive;
 
 private:
+    outpost::rtos::Queue<size_t> mQueue;
+
     T mEmpty;
 
     outpost::rtos::Mutex mMutex;
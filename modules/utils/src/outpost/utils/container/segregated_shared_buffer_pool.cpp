@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "segregated_shared_buffer_pool.h"
+
+namespace outpost
+{
+namespace utils
+{
+SegregatedSharedBufferPool::SegregatedSharedBufferPool(
+        outpost::Slice<SharedBufferPoolBase* const> sizeClasses) :
+    mSizeClasses(sizeClasses)
+{
+}
+
+template <typename Pointer>
+bool
+SegregatedSharedBufferPool::allocateFromSizeClass(Pointer& pointer, size_t minimumSize)
+{
+    for (size_t i = 0; i < mSizeClasses.getNumberOfElements(); i++)
+    {
+        SharedBufferPoolBase& sizeClass = *mSizeClasses[i];
+        if ((sizeClass.getElementSize() >= minimumSize) && sizeClass.allocate(pointer))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+SegregatedSharedBufferPool::allocate(SharedBufferPointer& pointer)
+{
+    return allocateFromSizeClass(pointer, getElementSize());
+}
+
+bool
+SegregatedSharedBufferPool::allocate(ConstSharedBufferPointer& pointer)
+{
+    return allocateFromSizeClass(pointer, getElementSize());
+}
+
+bool
+SegregatedSharedBufferPool::allocate(SharedBufferPointer& pointer, size_t minimumSize)
+{
+    return allocateFromSizeClass(pointer, minimumSize);
+}
+
+bool
+SegregatedSharedBufferPool::allocate(ConstSharedBufferPointer& pointer, size_t minimumSize)
+{
+    return allocateFromSizeClass(pointer, minimumSize);
+}
+
+size_t
+SegregatedSharedBufferPool::numberOfElements() const
+{
+    size_t elements = 0;
+    for (size_t i = 0; i < mSizeClasses.getNumberOfElements(); i++)
+    {
+        elements += mSizeClasses[i]->numberOfElements();
+    }
+    return elements;
+}
+
+size_t
+SegregatedSharedBufferPool::getElementSize() const
+{
+    size_t elementSize = 0;
+    for (size_t i = 0; i < mSizeClasses.getNumberOfElements(); i++)
+    {
+        if (mSizeClasses[i]->getElementSize() > elementSize)
+        {
+            elementSize = mSizeClasses[i]->getElementSize();
+        }
+    }
+    return elementSize;
+}
+
+size_t
+SegregatedSharedBufferPool::numberOfFreeElements() const
+{
+    size_t elements = 0;
+    for (size_t i = 0; i < mSizeClasses.getNumberOfElements(); i++)
+    {
+        elements += mSizeClasses[i]->numberOfFreeElements();
+    }
+    return elements;
+}
+
+size_t
+SegregatedSharedBufferPool::getHighWaterMark() const
+{
+    size_t elements = 0;
+    for (size_t i = 0; i < mSizeClasses.getNumberOfElements(); i++)
+    {
+        elements += mSizeClasses[i]->getHighWaterMark();
+    }
+    return elements;
+}
+
+}  // namespace utils
+}  // namespace outpost
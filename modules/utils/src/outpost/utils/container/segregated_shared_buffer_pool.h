@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_SEGREGATED_SHARED_BUFFER_POOL_H
+#define OUTPOST_UTILS_SEGREGATED_SHARED_BUFFER_POOL_H
+
+#include "shared_object_pool.h"
+
+#include <outpost/base/slice.h>
+
+namespace outpost
+{
+namespace utils
+{
+/**
+ * \ingroup SharedBuffer
+ * \brief Pool consisting of several pools with different element sizes.
+ *
+ * Each of the pools is a size class. allocate(pointer, minimumSize)
+ * returns a buffer of the smallest size class that fits the requested
+ * size. If all buffers of this class are in use, the next larger class
+ * is used. Small messages therefore no longer occupy a buffer of the
+ * largest size, which allows smaller pools for the same workload.
+ *
+ * allocate(pointer) without a size returns a buffer of the largest size
+ * class, so callers written for a pool with a single element size keep
+ * working.
+ *
+ * Example:
+ *
+ *     SharedBufferPool<64, 200> smallBuffers;
+ *     SharedBufferPool<512, 40> mediumBuffers;
+ *     SharedBufferPool<4096, 8> largeBuffers;
+ *
+ *     SharedBufferPoolBase* sizeClasses[] = {&smallBuffers, &mediumBuffers, &largeBuffers};
+ *     SegregatedSharedBufferPool pool(outpost::asSlice(sizeClasses));
+ *
+ *     SharedBufferPointer pointer;
+ *     pool.allocate(pointer, 20);  // Uses a buffer of smallBuffers
+ */
+class SegregatedSharedBufferPool : public SharedBufferPoolBase
+{
+public:
+    /**
+     * \param sizeClasses
+     *     Pools sorted by ascending element size. The array must be valid
+     *     for the lifetime of the object.
+     */
+    explicit SegregatedSharedBufferPool(outpost::Slice<SharedBufferPoolBase* const> sizeClasses);
+
+    virtual ~SegregatedSharedBufferPool() = default;
+
+    /**
+     * \brief Allocation of a buffer of the largest size class.
+     */
+    bool
+    allocate(SharedBufferPointer& pointer) override;
+
+    /**
+     * \brief Allocation of a buffer of the largest size class.
+     */
+    bool
+    allocate(ConstSharedBufferPointer& pointer) override;
+
+    /**
+     * \brief Allocation of a buffer from the smallest size class with a free buffer of at least
+     * the given size.
+     */
+    bool
+    allocate(SharedBufferPointer& pointer, size_t minimumSize) override;
+
+    /**
+     * \see allocate(SharedBufferPointer&, size_t)
+     */
+    bool
+    allocate(ConstSharedBufferPointer& pointer, size_t minimumSize) override;
+
+    /**
+     * \return Returns the sum of the elements of all size classes.
+     */
+    size_t
+    numberOfElements() const override;
+
+    /**
+     * \return Returns the element size of the largest size class.
+     */
+    size_t
+    getElementSize() const override;
+
+    /**
+     * \return Returns the sum of the free elements of all size classes.
+     */
+    size_t
+    numberOfFreeElements() const override;
+
+    /**
+     * \return Returns the sum of the high-water marks of the size classes. This is an upper
+     * bound, the high-water marks of the classes may have been reached at different times.
+     */
+    size_t
+    getHighWaterMark() const override;
+
+    inline size_t
+    getNumberOfSizeClasses() const
+    {
+        return mSizeClasses.getNumberOfElements();
+    }
+
+    /**
+     * \brief Access to a size class, e.g. to read its occupancy and high-water mark.
+     *
+     * \param index Index of the size class, must be smaller than getNumberOfSizeClasses().
+     */
+    inline const SharedBufferPoolBase&
+    getSizeClass(size_t index) const
+    {
+        return *mSizeClasses[index];
+    }
+
+private:
+    // disable copy constructor
+    SegregatedSharedBufferPool(const SegregatedSharedBufferPool&);
+
+    // disable copy-assignment operator
+    SegregatedSharedBufferPool&
+    operator=(const SegregatedSharedBufferPool&);
+
+    template <typename Pointer>
+    bool
+    allocateFromSizeClass(Pointer& pointer, size_t minimumSize);
+
+    outpost::Slice<SharedBufferPoolBase* const> mSizeClasses;
+};
+
+}  // namespace utils
+}  // namespace outpost
+
+#endif
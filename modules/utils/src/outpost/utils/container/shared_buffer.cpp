@@ -19,9 +19,8 @@ namespace outpost
 {
 namespace utils
 {
-outpost::rtos::Mutex SharedBuffer::mMutex;
-
-SharedBuffer::SharedBuffer() : mReferenceCounter(0), mBuffer(outpost::Slice<uint8_t>::empty())
+SharedBuffer::SharedBuffer() :
+    mReferenceCounter(), mBuffer(outpost::Slice<uint8_t>::empty()), mFreeList(nullptr)
 {
 }
 
@@ -29,18 +28,6 @@ SharedBuffer::~SharedBuffer()
 {
 }
 
-void
-SharedBuffer::incrementCount()
-{
-    SharedBuffer::incrementCountAtomic(mReferenceCounter);
-}
-
-void
-SharedBuffer::decrementCount()
-{
-    SharedBuffer::decrementCountAtomic(mReferenceCounter);
-}
-
 bool
 SharedBufferPointer::getChild(SharedChildPointer& ptr,
                               uint16_t type,
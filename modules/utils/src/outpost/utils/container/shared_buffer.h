@@ -15,8 +15,10 @@
 
 #ifndef OUTPOST_UTILS_SMART_BUFFER_H_
 #define OUTPOST_UTILS_SMART_BUFFER_H_
+#include "reference_counter.h"
+#include "shared_buffer_free_list.h"
+
 #include <outpost/base/slice.h>
-#include <outpost/rtos/mutex_guard.h>
 
 #include <stdio.h>
 #include <string.h>
@@ -48,7 +50,8 @@ public:
      * bytes.
      * \param slice Slice holding the byte array.
      */
-    explicit SharedBuffer(outpost::Slice<uint8_t> slice) : mReferenceCounter(0), mBuffer(slice)
+    explicit SharedBuffer(outpost::Slice<uint8_t> slice) :
+        mReferenceCounter(), mBuffer(slice), mFreeList(nullptr)
     {
     }
 
@@ -129,14 +132,13 @@ public:
     }
 
     /**
-     * \brief Getter function for the usage state of the SharedBuffer. Calls outpost::rtos::Mutex
-     * protected functions internally.
+     * \brief Getter function for the usage state of the SharedBuffer.
      * \return Returns true if the SharedBuffer is currently in use, false otherwise.
      */
     inline bool
     isUsed() const
     {
-        return SharedBuffer::isUsedAtomic(mReferenceCounter);
+        return mReferenceCounter.get() != 0;
     }
 
     /**
@@ -146,7 +148,7 @@ public:
     inline size_t
     getReferenceCount() const
     {
-        return mReferenceCounter;
+        return mReferenceCounter.get();
     }
 
     /**
@@ -163,85 +165,55 @@ private:
     friend class SharedBufferPointer;
     friend class ConstSharedBufferPointer;
     friend class SharedBufferPointerBase;
+    friend class SharedBufferFreeList;
 
     /**
      * \brief Increments the reference count.
      *
      * Used by its friend class SharedBufferPointer, it does not need to be called manually.
-     * Uses outpost::rtos::Mutex protected functions internally for mutual exclusion.
-     */
-    void
-    incrementCount();
-
-    /**
-     * \brief Decrements the reference count.
-     *
-     * Used by its friend class SharedBufferPointer, it does not need to be called manually.
-     * Uses outpost::rtos::Mutex protected functions internally for mutual exclusion.
-     */
-    void
-    decrementCount();
-
-    /**
-     * \brief outpost::rtos::Mutex protected access to the usage state, derived from the reference
-     * counter.
-     *
-     * Called internally by the member function isUsed().
-     * Does not need to be called manually.
-     * \param ref Reference counter to be checked.
-     */
-    inline static bool
-    isUsedAtomic(const size_t ref)
-    {
-        outpost::rtos::MutexGuard lock(mMutex);
-        return ref != 0;
-    }
-
-    /**
-     * \brief outpost::rtos::Mutex protected increment of the reference counter.
-     *
-     * Called internally by the member function isUsed().
-     * Does not need to be called manually.
-     * \param ref Reference counter to be incremented.
+     * Safe to be called concurrently from several threads.
      */
-    inline static void
-    incrementCountAtomic(size_t& ref)
+    inline void
+    incrementCount()
     {
-        outpost::rtos::MutexGuard lock(mMutex);
-        ref++;
+        mReferenceCounter.increment();
     }
 
     /**
-     * \brief outpost::rtos::Mutex protected decrement of the reference counter.
+     * \brief Decrements the reference count.
      *
-     * Called internally by the member function isUsed().
-     * Does not need to be called manually.
-     * \param ref Reference counter to be decremented.
+     * Used by its friend class SharedBufferPointer, it does not need to be called manually.
+     * Safe to be called concurrently from several threads. Buffers of a pool are returned to
+     * the free list of the pool when the last reference is released.
      */
-    inline static void
-    decrementCountAtomic(size_t& ref)
+    inline void
+    decrementCount()
     {
-        outpost::rtos::MutexGuard lock(mMutex);
-        if (ref > 0)
+        // The last decrement acquires the writes of all other holders, the
+        // free list publishes them to the next owner of the buffer
+        if (mReferenceCounter.decrement() && (mFreeList != nullptr))
         {
-            ref--;
+            mFreeList->release(*this);
         }
     }
 
-    /**
-     * \brief outpost::rtos::Mutex for allowing only one reference counter to be changed at a time.
-     */
-    static outpost::rtos::Mutex mMutex;
-
     /**
      * \brief Reference counter for the current usage state.
+     *
+     * Lock-free on targets with atomic operations, see
+     * OUTPOST_UTILS_ATOMIC_REFERENCE_COUNTER.
      */
-    size_t mReferenceCounter;
+    reference_counter::Default mReferenceCounter;
 
     /**
      * \brief Pointer to the underlying byte array.
      */
     outpost::Slice<uint8_t> mBuffer;
+
+    /**
+     * \brief Free list of the pool owning the buffer, nullptr for buffers outside of a pool.
+     */
+    SharedBufferFreeList* mFreeList;
 };
 
 /**
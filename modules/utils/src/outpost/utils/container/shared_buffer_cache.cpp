@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "shared_buffer_cache.h"
+
+namespace outpost
+{
+namespace utils
+{
+ExternalSharedBufferCache::ExternalSharedBufferCache(SharedBufferPoolBase& pool,
+                                                     SharedBufferFreeList& freeList,
+                                                     outpost::Slice<SharedBuffer*> magazine) :
+    mPool(pool), mFreeList(freeList), mMagazine(magazine), mNumberOfCachedBuffers(0)
+{
+}
+
+ExternalSharedBufferCache::~ExternalSharedBufferCache()
+{
+    flush();
+}
+
+SharedBuffer*
+ExternalSharedBufferCache::take()
+{
+    if (mNumberOfCachedBuffers == 0)
+    {
+        mNumberOfCachedBuffers = mFreeList.allocate(mMagazine);
+        if (mNumberOfCachedBuffers == 0)
+        {
+            return nullptr;
+        }
+    }
+    mNumberOfCachedBuffers--;
+    return mMagazine[mNumberOfCachedBuffers];
+}
+
+bool
+ExternalSharedBufferCache::allocate(SharedBufferPointer& pointer)
+{
+    SharedBuffer* buffer = take();
+    if (buffer == nullptr)
+    {
+        return false;
+    }
+    pointer = SharedBufferPointer(buffer);
+    return true;
+}
+
+bool
+ExternalSharedBufferCache::allocate(ConstSharedBufferPointer& pointer)
+{
+    SharedBuffer* buffer = take();
+    if (buffer == nullptr)
+    {
+        return false;
+    }
+    pointer = ConstSharedBufferPointer(buffer);
+    return true;
+}
+
+size_t
+ExternalSharedBufferCache::numberOfElements() const
+{
+    return mPool.numberOfElements();
+}
+
+size_t
+ExternalSharedBufferCache::getElementSize() const
+{
+    return mPool.getElementSize();
+}
+
+size_t
+ExternalSharedBufferCache::numberOfFreeElements() const
+{
+    return mPool.numberOfFreeElements() + mNumberOfCachedBuffers;
+}
+
+size_t
+ExternalSharedBufferCache::getHighWaterMark() const
+{
+    return mPool.getHighWaterMark();
+}
+
+void
+ExternalSharedBufferCache::flush()
+{
+    mFreeList.release(mMagazine.first(mNumberOfCachedBuffers));
+    mNumberOfCachedBuffers = 0;
+}
+
+}  // namespace utils
+}  // namespace outpost
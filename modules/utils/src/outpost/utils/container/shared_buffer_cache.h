@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_SHARED_BUFFER_CACHE_H
+#define OUTPOST_UTILS_SHARED_BUFFER_CACHE_H
+
+#include "shared_object_pool.h"
+
+#include <outpost/base/slice.h>
+
+namespace outpost
+{
+namespace utils
+{
+/**
+ * \ingroup SharedBuffer
+ * \brief Per-thread cache of unused buffers of a pool.
+ *
+ * The cache keeps a magazine of buffers which are taken from the central
+ * pool. If the magazine is empty, it is refilled with up to the magazine
+ * size buffers by a single operation on the free list of the pool. Threads
+ * allocating from their own cache therefore access the shared free list
+ * only once per magazine instead of once per buffer.
+ *
+ * Buffers are not returned to the cache: when the last reference to a
+ * buffer is released it is added to the free list of the pool as before.
+ * Buffers may therefore be released on any thread, e.g. by the receiver
+ * of a message on the software bus.
+ *
+ * A cache must only be used by a single thread. Unused buffers in the
+ * magazine are returned to the pool by flush() and by the destructor.
+ * Buffers in magazines are not available to other threads, the pool must
+ * be large enough for the buffers in use plus one magazine per cache.
+ *
+ * Example:
+ *
+ *     SharedBufferPool<1024, 100> pool;
+ *
+ *     // Member of the thread class
+ *     SharedBufferCache<8> cache(pool);
+ *
+ *     SharedBufferPointer pointer;
+ *     cache.allocate(pointer);
+ */
+class ExternalSharedBufferCache : public SharedBufferPoolBase
+{
+public:
+    /**
+     * \param pool
+     *     Central pool, must outlive the cache.
+     * \param magazine
+     *     Storage for the cached buffers, the number of elements is the
+     *     magazine size. Must be valid for the lifetime of the object.
+     */
+    template <size_t E, size_t N>
+    ExternalSharedBufferCache(ExternalSharedBufferPool<E, N>& pool,
+                              outpost::Slice<SharedBuffer*> magazine) :
+        ExternalSharedBufferCache(pool, pool.mFreeList, magazine)
+    {
+    }
+
+    /**
+     * Returns the cached buffers to the pool.
+     */
+    virtual ~ExternalSharedBufferCache();
+
+    using SharedBufferPoolBase::allocate;
+
+    /**
+     * \brief Allocation of a buffer from the magazine.
+     *
+     * Refills the magazine from the pool if it is empty.
+     */
+    bool
+    allocate(SharedBufferPointer& pointer) override;
+
+    /**
+     * \see allocate(SharedBufferPointer&)
+     */
+    bool
+    allocate(ConstSharedBufferPointer& pointer) override;
+
+    /**
+     * \return Returns the number of elements of the pool.
+     */
+    size_t
+    numberOfElements() const override;
+
+    size_t
+    getElementSize() const override;
+
+    /**
+     * \return Returns the number of free elements in the pool and the magazine of this cache.
+     */
+    size_t
+    numberOfFreeElements() const override;
+
+    /**
+     * \return Returns the high-water mark of the pool. Buffers in magazines count as used.
+     */
+    size_t
+    getHighWaterMark() const override;
+
+    /**
+     * \brief Return all buffers in the magazine to the pool.
+     *
+     * Should be called by threads which stop allocating buffers for a
+     * longer time.
+     */
+    void
+    flush();
+
+    inline size_t
+    getNumberOfCachedBuffers() const
+    {
+        return mNumberOfCachedBuffers;
+    }
+
+    inline size_t
+    getMagazineSize() const
+    {
+        return mMagazine.getNumberOfElements();
+    }
+
+private:
+    ExternalSharedBufferCache(SharedBufferPoolBase& pool,
+                              SharedBufferFreeList& freeList,
+                              outpost::Slice<SharedBuffer*> magazine);
+
+    // disable copy constructor
+    ExternalSharedBufferCache(const ExternalSharedBufferCache&);
+
+    // disable copy-assignment operator
+    ExternalSharedBufferCache&
+    operator=(const ExternalSharedBufferCache&);
+
+    SharedBuffer*
+    take();
+
+    SharedBufferPoolBase& mPool;
+    SharedBufferFreeList& mFreeList;
+    outpost::Slice<SharedBuffer*> mMagazine;
+    size_t mNumberOfCachedBuffers;
+};
+
+template <size_t M>
+class SharedBufferCacheStorage
+{
+protected:
+    SharedBufferCacheStorage() : mMagazineBuffer(){};
+
+    SharedBuffer* mMagazineBuffer[M];
+};
+
+/**
+ * \ingroup SharedBuffer
+ * \brief Per-thread cache with internal storage for the magazine.
+ *
+ * \tparam M Magazine size, number of buffers taken from the pool at once
+ */
+template <size_t M>
+class SharedBufferCache : private SharedBufferCacheStorage<M>, public ExternalSharedBufferCache
+{
+public:
+    static_assert(M > 0, "Magazine must hold at least one buffer");
+
+    template <size_t E, size_t N>
+    explicit SharedBufferCache(ExternalSharedBufferPool<E, N>& pool) :
+        ExternalSharedBufferCache(pool, outpost::asSlice(this->mMagazineBuffer))
+    {
+    }
+
+    virtual ~SharedBufferCache() = default;
+};
+
+}  // namespace utils
+}  // namespace outpost
+
+#endif
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "shared_buffer_free_list.h"
+
+#include "shared_buffer.h"
+
+#include <outpost/rtos/mutex_guard.h>
+
+namespace outpost
+{
+namespace utils
+{
+namespace
+{
+constexpr uint32_t endOfList = 0xFFFFFFFFU;
+
+#if OUTPOST_UTILS_ATOMIC_FREE_LIST
+inline uint32_t
+indexOf(uint64_t head)
+{
+    return static_cast<uint32_t>(head);
+}
+
+inline uint64_t
+nextHead(uint64_t head, uint32_t index)
+{
+    const uint64_t tag = (head >> 32) + 1;
+    return (tag << 32) | index;
+}
+#endif
+}  // namespace
+
+constexpr size_t SharedBufferFreeList::maximumNumberOfBuffers;
+
+SharedBufferFreeList::SharedBufferFreeList() :
+    mBuffers(nullptr),
+    mLinks(nullptr),
+    mHead(endOfList),
+    mNumberOfFreeBuffers(0),
+    mMinimumNumberOfFreeBuffers(0)
+{
+}
+
+void
+SharedBufferFreeList::initialize(SharedBuffer* buffers, Link* links, size_t numberOfBuffers)
+{
+    mBuffers = buffers;
+    mLinks = links;
+    for (size_t i = 0; i < numberOfBuffers; i++)
+    {
+        const uint32_t next =
+                ((i + 1) < numberOfBuffers) ? static_cast<uint32_t>(i + 1) : endOfList;
+#if OUTPOST_UTILS_ATOMIC_FREE_LIST
+        mLinks[i].store(next, std::memory_order_relaxed);
+#else
+        mLinks[i] = next;
+#endif
+        mBuffers[i].mFreeList = this;
+    }
+
+#if OUTPOST_UTILS_ATOMIC_FREE_LIST
+    mNumberOfFreeBuffers.store(numberOfBuffers, std::memory_order_relaxed);
+    mMinimumNumberOfFreeBuffers.store(numberOfBuffers, std::memory_order_relaxed);
+    mHead.store((numberOfBuffers > 0) ? 0 : endOfList, std::memory_order_release);
+#else
+    outpost::rtos::MutexGuard lock(mMutex);
+    mNumberOfFreeBuffers = numberOfBuffers;
+    mMinimumNumberOfFreeBuffers = numberOfBuffers;
+    mHead = (numberOfBuffers > 0) ? 0 : endOfList;
+#endif
+}
+
+#if OUTPOST_UTILS_ATOMIC_FREE_LIST
+SharedBuffer*
+SharedBufferFreeList::allocate()
+{
+    uint64_t head = mHead.load(std::memory_order_acquire);
+    while (indexOf(head) != endOfList)
+    {
+        const uint32_t index = indexOf(head);
+
+        // The link may be changed concurrently if the buffer has been
+        // removed and added again. The tag of the head has changed in
+        // this case and the exchange fails.
+        const uint32_t next = mLinks[index].load(std::memory_order_relaxed);
+        if (mHead.compare_exchange_weak(
+                    head, nextHead(head, next), std::memory_order_acquire,
+                    std::memory_order_acquire))
+        {
+            const size_t remaining =
+                    mNumberOfFreeBuffers.fetch_sub(1, std::memory_order_relaxed) - 1;
+
+            // The minimum changes rarely, usually only the load is executed
+            size_t minimum = mMinimumNumberOfFreeBuffers.load(std::memory_order_relaxed);
+            while ((remaining < minimum)
+                   && !mMinimumNumberOfFreeBuffers.compare_exchange_weak(
+                           minimum, remaining, std::memory_order_relaxed))
+            {
+            }
+            return &mBuffers[index];
+        }
+    }
+    return nullptr;
+}
+
+size_t
+SharedBufferFreeList::allocate(outpost::Slice<SharedBuffer*> buffers)
+{
+    const size_t maximum = buffers.getNumberOfElements();
+    uint64_t head = mHead.load(std::memory_order_acquire);
+    while ((maximum > 0) && (indexOf(head) != endOfList))
+    {
+        // Same as for a single buffer: if one of the links has been
+        // changed concurrently the tag of the head has changed as well.
+        size_t count = 0;
+        uint32_t index = indexOf(head);
+        while ((index != endOfList) && (count < maximum))
+        {
+            buffers[count] = &mBuffers[index];
+            count++;
+            index = mLinks[index].load(std::memory_order_relaxed);
+        }
+
+        if (mHead.compare_exchange_weak(
+                    head, nextHead(head, index), std::memory_order_acquire,
+                    std::memory_order_acquire))
+        {
+            const size_t remaining =
+                    mNumberOfFreeBuffers.fetch_sub(count, std::memory_order_relaxed) - count;
+
+            size_t minimum = mMinimumNumberOfFreeBuffers.load(std::memory_order_relaxed);
+            while ((remaining < minimum)
+                   && !mMinimumNumberOfFreeBuffers.compare_exchange_weak(
+                           minimum, remaining, std::memory_order_relaxed))
+            {
+            }
+            return count;
+        }
+    }
+    return 0;
+}
+
+void
+SharedBufferFreeList::release(outpost::Slice<SharedBuffer* const> buffers)
+{
+    const size_t count = buffers.getNumberOfElements();
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Link the buffers among each other before the chain is published
+    const uint32_t first = static_cast<uint32_t>(buffers[0] - mBuffers);
+    uint32_t last = first;
+    for (size_t i = 1; i < count; i++)
+    {
+        const uint32_t index = static_cast<uint32_t>(buffers[i] - mBuffers);
+        mLinks[last].store(index, std::memory_order_relaxed);
+        last = index;
+    }
+
+    mNumberOfFreeBuffers.fetch_add(count, std::memory_order_relaxed);
+    uint64_t head = mHead.load(std::memory_order_relaxed);
+    do
+    {
+        mLinks[last].store(indexOf(head), std::memory_order_relaxed);
+    } while (!mHead.compare_exchange_weak(
+            head, nextHead(head, first), std::memory_order_release, std::memory_order_relaxed));
+}
+
+void
+SharedBufferFreeList::release(SharedBuffer& buffer)
+{
+    const uint32_t index = static_cast<uint32_t>(&buffer - mBuffers);
+
+    mNumberOfFreeBuffers.fetch_add(1, std::memory_order_relaxed);
+    uint64_t head = mHead.load(std::memory_order_relaxed);
+    do
+    {
+        mLinks[index].store(indexOf(head), std::memory_order_relaxed);
+    } while (!mHead.compare_exchange_weak(
+            head, nextHead(head, index), std::memory_order_release, std::memory_order_relaxed));
+}
+
+size_t
+SharedBufferFreeList::getNumberOfFreeBuffers() const
+{
+    return mNumberOfFreeBuffers.load(std::memory_order_relaxed);
+}
+
+size_t
+SharedBufferFreeList::getMinimumNumberOfFreeBuffers() const
+{
+    return mMinimumNumberOfFreeBuffers.load(std::memory_order_relaxed);
+}
+#else
+SharedBuffer*
+SharedBufferFreeList::allocate()
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    if (mHead == endOfList)
+    {
+        return nullptr;
+    }
+
+    const uint32_t index = mHead;
+    mHead = mLinks[index];
+    mNumberOfFreeBuffers--;
+    if (mNumberOfFreeBuffers < mMinimumNumberOfFreeBuffers)
+    {
+        mMinimumNumberOfFreeBuffers = mNumberOfFreeBuffers;
+    }
+    return &mBuffers[index];
+}
+
+size_t
+SharedBufferFreeList::allocate(outpost::Slice<SharedBuffer*> buffers)
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    size_t count = 0;
+    while ((mHead != endOfList) && (count < buffers.getNumberOfElements()))
+    {
+        buffers[count] = &mBuffers[mHead];
+        count++;
+        mHead = mLinks[mHead];
+    }
+    mNumberOfFreeBuffers -= count;
+    if (mNumberOfFreeBuffers < mMinimumNumberOfFreeBuffers)
+    {
+        mMinimumNumberOfFreeBuffers = mNumberOfFreeBuffers;
+    }
+    return count;
+}
+
+void
+SharedBufferFreeList::release(outpost::Slice<SharedBuffer* const> buffers)
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    for (size_t i = 0; i < buffers.getNumberOfElements(); i++)
+    {
+        const uint32_t index = static_cast<uint32_t>(buffers[i] - mBuffers);
+        mLinks[index] = mHead;
+        mHead = index;
+    }
+    mNumberOfFreeBuffers += buffers.getNumberOfElements();
+}
+
+void
+SharedBufferFreeList::release(SharedBuffer& buffer)
+{
+    const uint32_t index = static_cast<uint32_t>(&buffer - mBuffers);
+
+    outpost::rtos::MutexGuard lock(mMutex);
+    mLinks[index] = mHead;
+    mHead = index;
+    mNumberOfFreeBuffers++;
+}
+
+size_t
+SharedBufferFreeList::getNumberOfFreeBuffers() const
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    return mNumberOfFreeBuffers;
+}
+
+size_t
+SharedBufferFreeList::getMinimumNumberOfFreeBuffers() const
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    return mMinimumNumberOfFreeBuffers;
+}
+#endif
+
+}  // namespace utils
+}  // namespace outpost
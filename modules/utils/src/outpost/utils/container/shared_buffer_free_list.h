@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_SHARED_BUFFER_FREE_LIST_H
+#define OUTPOST_UTILS_SHARED_BUFFER_FREE_LIST_H
+
+#include <outpost/base/slice.h>
+#include <outpost/rtos/mutex.h>
+#include <outpost/utils/atomic_support.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The lock-free list stores a 32 bit index and a 32 bit modification tag
+// in one 64 bit word. Targets without lock-free 64 bit atomic operations
+// use a mutex protected list instead.
+#if !defined(OUTPOST_UTILS_ATOMIC_FREE_LIST)
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS && defined(__GCC_ATOMIC_LLONG_LOCK_FREE) && \
+        (__GCC_ATOMIC_LLONG_LOCK_FREE == 2)
+#define OUTPOST_UTILS_ATOMIC_FREE_LIST 1
+#else
+#define OUTPOST_UTILS_ATOMIC_FREE_LIST 0
+#endif
+#endif
+
+#if OUTPOST_UTILS_ATOMIC_FREE_LIST
+#include <atomic>
+#endif
+
+namespace outpost
+{
+namespace utils
+{
+class SharedBuffer;
+
+/**
+ * \ingroup SharedBuffer
+ * \brief List of the unused buffers of a pool.
+ *
+ * A buffer is added to the list when the last reference to it is
+ * released. Allocation and release are therefore O(1) and independent of
+ * the occupancy of the pool.
+ *
+ * The list is a stack of buffer indices (Treiber stack). The head stores
+ * the index of the first buffer together with a tag that is changed by
+ * every modification, which prevents the ABA problem when a buffer is
+ * removed and added again while another thread accesses the list.
+ */
+class SharedBufferFreeList
+{
+public:
+#if OUTPOST_UTILS_ATOMIC_FREE_LIST
+    typedef std::atomic<uint32_t> Link;
+#else
+    typedef uint32_t Link;
+#endif
+
+    /// Maximum number of buffers in one list
+    static constexpr size_t maximumNumberOfBuffers = 0xFFFFFFFEU;
+
+    SharedBufferFreeList();
+
+    // disable copy constructor
+    SharedBufferFreeList(const SharedBufferFreeList&) = delete;
+
+    // disable copy-assignment operator
+    SharedBufferFreeList&
+    operator=(const SharedBufferFreeList&) = delete;
+
+    /**
+     * Add all buffers to the list.
+     *
+     * Must be called before the buffers are used, the buffers must not
+     * be referenced.
+     *
+     * \param buffers
+     *     Array of buffers handled by this list.
+     * \param links
+     *     Storage for the list, one element per buffer.
+     * \param numberOfBuffers
+     *     Number of elements in both arrays.
+     */
+    void
+    initialize(SharedBuffer* buffers, Link* links, size_t numberOfBuffers);
+
+    /**
+     * Remove an unused buffer from the list.
+     *
+     * \return
+     *     Buffer or nullptr if all buffers are in use.
+     */
+    SharedBuffer*
+    allocate();
+
+    /**
+     * Remove several unused buffers from the list at once.
+     *
+     * The buffers are removed with a single modification of the list,
+     * which reduces the contention if several threads allocate buffers.
+     *
+     * \param buffers
+     *     Storage for the removed buffers.
+     * \return
+     *     Number of removed buffers, smaller than the number of elements of
+     *     \p buffers if the list does not contain enough buffers.
+     */
+    size_t
+    allocate(outpost::Slice<SharedBuffer*> buffers);
+
+    /**
+     * Add several buffers to the list at once.
+     *
+     * Used to return buffers obtained by allocate() which have never been
+     * referenced. All buffers must belong to this list.
+     */
+    void
+    release(outpost::Slice<SharedBuffer* const> buffers);
+
+    /**
+     * Number of buffers in the list.
+     *
+     * The result is exact when no allocation or release is in progress.
+     */
+    size_t
+    getNumberOfFreeBuffers() const;
+
+    /**
+     * Smallest number of buffers in the list since the initialization.
+     */
+    size_t
+    getMinimumNumberOfFreeBuffers() const;
+
+private:
+    friend class SharedBuffer;
+
+    /**
+     * Add a buffer to the list.
+     *
+     * Called by the buffer when its last reference is released.
+     */
+    void
+    release(SharedBuffer& buffer);
+
+    SharedBuffer* mBuffers;
+    Link* mLinks;
+
+#if OUTPOST_UTILS_ATOMIC_FREE_LIST
+    // Tag in the upper and index of the first buffer in the lower 32 bit
+    std::atomic<uint64_t> mHead;
+
+    // Incremented before a buffer is added and decremented after a buffer
+    // is removed, never smaller than the length of the list.
+    std::atomic<size_t> mNumberOfFreeBuffers;
+    std::atomic<size_t> mMinimumNumberOfFreeBuffers;
+#else
+    mutable outpost::rtos::Mutex mMutex;
+    uint32_t mHead;
+    size_t mNumberOfFreeBuffers;
+    size_t mMinimumNumberOfFreeBuffers;
+#endif
+};
+
+}  // namespace utils
+}  // namespace outpost
+
+#endif
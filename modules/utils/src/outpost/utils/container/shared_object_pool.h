@@ -17,8 +17,8 @@
 #define OUTPOST_UTILS_SMART_OBJECT_POOL_H_
 
 #include "shared_buffer.h"
+#include "shared_buffer_free_list.h"
 
-#include <outpost/rtos/mutex_guard.h>
 #include <outpost/utils/container/list.h>
 
 namespace outpost
@@ -51,6 +51,33 @@ public:
     virtual bool
     allocate(ConstSharedBufferPointer& pointer) = 0;
 
+    /**
+     * \brief Allocation of an unused SharedBufferPointer with a minimum size from the pool.
+     *
+     * Pools with a single element size fail if the element size is smaller than the requested
+     * size, otherwise they behave like allocate(SharedBufferPointer&).
+     *
+     * \param pointer Reference to the SharedBufferPointer
+     * \param minimumSize Minimum length of the buffer in bytes
+     * \return Returns true if a valid SharedBufferPointer was found, otherwise false.
+     */
+    virtual bool
+    allocate(SharedBufferPointer& pointer, size_t minimumSize)
+    {
+        return (minimumSize <= getElementSize()) && allocate(pointer);
+    }
+
+    /**
+     * \brief Allocation of an unused ConstSharedBufferPointer with a minimum size from the pool.
+     *
+     * \see allocate(SharedBufferPointer&, size_t)
+     */
+    virtual bool
+    allocate(ConstSharedBufferPointer& pointer, size_t minimumSize)
+    {
+        return (minimumSize <= getElementSize()) && allocate(pointer);
+    }
+
     /**
      * \brief Getter function for the overall number of elements in the pool.
      *
@@ -76,6 +103,19 @@ public:
     virtual size_t
     numberOfFreeElements() const = 0;
 
+    /**
+     * \brief Getter function for the maximum number of elements in use at the same time.
+     *
+     * Pools without usage statistics return the number of currently used elements.
+     *
+     * \return Returns the high-water mark of the used elements since the creation of the pool.
+     */
+    virtual size_t
+    getHighWaterMark() const
+    {
+        return numberOfElements() - numberOfFreeElements();
+    }
+
     /**
      * \brief Default destructor.
      *
@@ -97,7 +137,9 @@ template <size_t E, size_t N>
 class ExternalSharedBufferPool : public SharedBufferPoolBase
 {
 public:
-    explicit ExternalSharedBufferPool(uint8_t* address) : mLastIndex(0)
+    static_assert(N <= SharedBufferFreeList::maximumNumberOfBuffers, "Too many elements");
+
+    explicit ExternalSharedBufferPool(uint8_t* address)
     {
         initialize(address);
     }
@@ -109,11 +151,13 @@ public:
      */
     virtual ~ExternalSharedBufferPool() = default;
 
+    using SharedBufferPoolBase::allocate;
+
     /**
      * \brief Allocation of an unused SharedBufferPoiner from the pool.
      *
-     *  When looking for an unused element,
-     *  the element next to the one that was allocated last is considered first.
+     *  Unused elements are kept in a free list, the element released last is allocated first.
+     *  The allocation takes constant time independent of the number of used elements.
      *
      * \param pointer Reference to the SharedBufferPointer
      * \return Returns true if a valid SharedBudderPointer was found, otherwise false.
@@ -121,27 +165,20 @@ public:
     bool
     allocate(SharedBufferPointer& pointer) override
     {
-        outpost::rtos::MutexGuard lock(mMutex);
-        size_t i = mLastIndex;
-        bool res = false;
-        do
+        SharedBuffer* buffer = mFreeList.allocate();
+        if (buffer == nullptr)
         {
-            if (!mBuffer[i].isUsed())
-            {
-                pointer = SharedBufferPointer(&mBuffer[i]);
-                res = true;
-                mLastIndex = (i + 1) % N;
-            }
-            i = (i + 1) % N;
-        } while (i != mLastIndex && !res);
-        return res;
+            return false;
+        }
+        pointer = SharedBufferPointer(buffer);
+        return true;
     }
 
     /**
      * \brief Allocation of an unused SharedBufferPoiner from the pool.
      *
-     *  When looking for an unused element,
-     *  the element next to the one that was allocated last is considered first.
+     *  Unused elements are kept in a free list, the element released last is allocated first.
+     *  The allocation takes constant time independent of the number of used elements.
      *
      * \param pointer Reference to the SharedBufferPointer
      * \return Returns true if a valid SharedBudderPointer was found, otherwise false.
@@ -149,20 +186,13 @@ public:
     bool
     allocate(ConstSharedBufferPointer& pointer) override
     {
-        outpost::rtos::MutexGuard lock(mMutex);
-        size_t i = mLastIndex;
-        bool res = false;
-        do
+        SharedBuffer* buffer = mFreeList.allocate();
+        if (buffer == nullptr)
         {
-            if (!mBuffer[i].isUsed())
-            {
-                pointer = ConstSharedBufferPointer(&mBuffer[i]);
-                res = true;
-                mLastIndex = (i + 1) % N;
-            }
-            i = (i + 1) % N;
-        } while (i != mLastIndex && !res);
-        return res;
+            return false;
+        }
+        pointer = ConstSharedBufferPointer(buffer);
+        return true;
     }
 
     /**
@@ -191,23 +221,23 @@ public:
     size_t
     numberOfFreeElements() const override
     {
-        size_t temp = 0;
-        for (size_t i = 0; i < N; i++)
-        {
-            if (!mBuffer[i].isUsed())
-            {
-                temp++;
-            }
-        }
-        return temp;
+        return mFreeList.getNumberOfFreeBuffers();
+    }
+
+    size_t
+    getHighWaterMark() const override
+    {
+        return N - mFreeList.getMinimumNumberOfFreeBuffers();
     }
 
 protected:
+    friend class ExternalSharedBufferCache;
+
     SharedBuffer mBuffer[N];
 
-    size_t mLastIndex;
+    SharedBufferFreeList::Link mLinks[N];
 
-    outpost::rtos::Mutex mMutex;
+    SharedBufferFreeList mFreeList;
 
     void
     initialize(uint8_t* address)
@@ -216,6 +246,7 @@ protected:
         {
             mBuffer[i].setPointer(outpost::Slice<uint8_t>::unsafe(address + i * E, E));
         }
+        mFreeList.initialize(mBuffer, mLinks, N);
     };
 };
 
@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_SPSC_REFERENCE_QUEUE_H
+#define OUTPOST_UTILS_SPSC_REFERENCE_QUEUE_H
+
+#include "receiver_signal.h"
+#include "reference_queue.h"
+
+#include <outpost/rtos/mutex.h>
+#include <outpost/rtos/mutex_guard.h>
+#include <outpost/rtos/semaphore.h>
+#include <outpost/rtos/thread.h>
+#include <outpost/utils/atomic_support.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+#include <atomic>
+#endif
+
+namespace outpost
+{
+namespace utils
+{
+/**
+ * \ingroup SharedBuffer
+ * \brief Bounded queue for a single sending and a single receiving thread.
+ *
+ * Drop-in replacement for ReferenceQueue if only one thread sends to and
+ * one thread receives from the queue, e.g. between two stages of a
+ * compression pipeline.
+ *
+ * The elements are stored in a ring of N slots. The write position is
+ * only changed by the sender and the read position only by the receiver,
+ * so neither a lock nor a compare-and-swap is needed. Both positions are
+ * kept on separate cache lines together with a copy of the position of
+ * the other side, which is only reloaded when the ring seems to be full
+ * or empty.
+ *
+ * The receiver only waits on a semaphore if the queue is empty, see
+ * ReceiverSignal.
+ *
+ * Sending never blocks, send() returns false immediately if the queue is
+ * full. The timeout is ignored.
+ *
+ * Targets without lock-free atomic operations use a mutex protected ring
+ * instead (see OUTPOST_UTILS_LOCK_FREE_ATOMICS).
+ *
+ * \tparam T Type of the elements
+ * \tparam N Maximum number of elements in the queue
+ */
+template <typename T, size_t N>
+class SpscReferenceQueue : public ReferenceQueueBase<T>
+{
+public:
+    static_assert(N > 0, "Queue must hold at least one element");
+
+    SpscReferenceQueue();
+
+    virtual ~SpscReferenceQueue() = default;
+
+    // disable copy constructor
+    SpscReferenceQueue(const SpscReferenceQueue&) = delete;
+
+    // disable copy-assignment operator
+    SpscReferenceQueue&
+    operator=(const SpscReferenceQueue&) = delete;
+
+    /**
+     * \brief Send data to the queue, must only be called by a single thread.
+     *
+     * \param data Data to be sent.
+     * \return Returns true if data could be sent, false if the queue is full.
+     */
+    bool
+    send(T& data, outpost::time::Duration timeout) override;
+
+    /**
+     * \brief Receive data from the queue, must only be called by a single thread.
+     *
+     * Can be either blocking (timeout > 0) or non-blocking (timeout = 0).
+     */
+    bool
+    receive(T& data, outpost::time::Duration timeout) override;
+
+    uint16_t
+    getNumberOfItems() override;
+
+    bool
+    isEmpty() override;
+
+    bool
+    isFull() override;
+
+    using Sender<T>::send;
+    using Receiver<T>::receive;
+
+private:
+    bool
+    tryReceive(T& data);
+
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+    static constexpr size_t cacheLineSize = 64;
+
+    // Positions run through two rounds of the ring, which distinguishes
+    // a full from an empty ring without an extra counter.
+    static inline size_t
+    advance(size_t position)
+    {
+        return (position + 1) % (2 * N);
+    }
+
+    static inline size_t
+    distance(size_t from, size_t to)
+    {
+        return (to + 2 * N - from) % (2 * N);
+    }
+
+    T mValues[N];
+
+    // Sender side
+    alignas(cacheLineSize) std::atomic<size_t> mWritePosition;
+    size_t mCachedReadPosition;
+
+    // Receiver side
+    alignas(cacheLineSize) std::atomic<size_t> mReadPosition;
+    size_t mCachedWritePosition;
+
+    ReceiverSignal mSignal;
+#else
+    outpost::rtos::Mutex mMutex;
+    outpost::rtos::Semaphore mNumberOfElements;
+
+    size_t mReadIndex;
+    size_t mItemsInQueue;
+    T mValues[N];
+#endif
+};
+
+}  // namespace utils
+}  // namespace outpost
+
+#include "spsc_reference_queue_impl.h"
+
+#endif
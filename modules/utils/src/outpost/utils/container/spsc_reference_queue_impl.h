@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_SPSC_REFERENCE_QUEUE_IMPL_H
+#define OUTPOST_UTILS_SPSC_REFERENCE_QUEUE_IMPL_H
+
+#include "spsc_reference_queue.h"
+
+namespace outpost
+{
+namespace utils
+{
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+template <typename T, size_t N>
+constexpr size_t SpscReferenceQueue<T, N>::cacheLineSize;
+
+template <typename T, size_t N>
+SpscReferenceQueue<T, N>::SpscReferenceQueue() :
+    mValues(),
+    mWritePosition(0),
+    mCachedReadPosition(0),
+    mReadPosition(0),
+    mCachedWritePosition(0)
+{
+}
+
+template <typename T, size_t N>
+bool
+SpscReferenceQueue<T, N>::send(T& data, outpost::time::Duration)
+{
+    const size_t position = mWritePosition.load(std::memory_order_relaxed);
+    if (distance(mCachedReadPosition, position) == N)
+    {
+        mCachedReadPosition = mReadPosition.load(std::memory_order_acquire);
+        if (distance(mCachedReadPosition, position) == N)
+        {
+            return false;
+        }
+    }
+
+    mValues[position % N] = data;
+    mWritePosition.store(advance(position), std::memory_order_release);
+
+    mSignal.notify();
+    return true;
+}
+
+template <typename T, size_t N>
+bool
+SpscReferenceQueue<T, N>::tryReceive(T& data)
+{
+    const size_t position = mReadPosition.load(std::memory_order_relaxed);
+    if (position == mCachedWritePosition)
+    {
+        mCachedWritePosition = mWritePosition.load(std::memory_order_acquire);
+        if (position == mCachedWritePosition)
+        {
+            return false;
+        }
+    }
+
+    T& value = mValues[position % N];
+    data = value;
+    // Drop the reference held by the queue
+    value = T();
+    mReadPosition.store(advance(position), std::memory_order_release);
+    return true;
+}
+
+template <typename T, size_t N>
+bool
+SpscReferenceQueue<T, N>::receive(T& data, outpost::time::Duration timeout)
+{
+    return mSignal.wait([this, &data]() { return tryReceive(data); }, timeout);
+}
+
+template <typename T, size_t N>
+uint16_t
+SpscReferenceQueue<T, N>::getNumberOfItems()
+{
+    // The receiver may advance between both loads if called by another thread
+    const size_t items = distance(mReadPosition.load(std::memory_order_acquire),
+                                  mWritePosition.load(std::memory_order_acquire));
+    return static_cast<uint16_t>((items > N) ? N : items);
+}
+#else
+template <typename T, size_t N>
+SpscReferenceQueue<T, N>::SpscReferenceQueue() :
+    mNumberOfElements(0), mReadIndex(0), mItemsInQueue(0), mValues()
+{
+}
+
+template <typename T, size_t N>
+bool
+SpscReferenceQueue<T, N>::send(T& data, outpost::time::Duration)
+{
+    {
+        outpost::rtos::MutexGuard lock(mMutex);
+        if (mItemsInQueue == N)
+        {
+            return false;
+        }
+        mValues[(mReadIndex + mItemsInQueue) % N] = data;
+        mItemsInQueue++;
+    }
+    mNumberOfElements.release();
+    return true;
+}
+
+template <typename T, size_t N>
+bool
+SpscReferenceQueue<T, N>::tryReceive(T& data)
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    data = mValues[mReadIndex];
+    mValues[mReadIndex] = T();
+    mReadIndex = (mReadIndex + 1) % N;
+    mItemsInQueue--;
+    return true;
+}
+
+template <typename T, size_t N>
+bool
+SpscReferenceQueue<T, N>::receive(T& data, outpost::time::Duration timeout)
+{
+    // Every element in the ring is counted by the semaphore
+    if (!mNumberOfElements.acquire(timeout))
+    {
+        return false;
+    }
+    return tryReceive(data);
+}
+
+template <typename T, size_t N>
+uint16_t
+SpscReferenceQueue<T, N>::getNumberOfItems()
+{
+    outpost::rtos::MutexGuard lock(mMutex);
+    return static_cast<uint16_t>(mItemsInQueue);
+}
+#endif
+
+template <typename T, size_t N>
+bool
+SpscReferenceQueue<T, N>::isEmpty()
+{
+    return getNumberOfItems() == 0;
+}
+
+template <typename T, size_t N>
+bool
+SpscReferenceQueue<T, N>::isFull()
+{
+    return getNumberOfItems() >= N;
+}
+
+}  // namespace utils
+}  // namespace outpost
+
+#endif
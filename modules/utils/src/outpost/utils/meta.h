@@ -14,6 +14,8 @@
 #ifndef OUTPOST_META_H
 #define OUTPOST_META_H
 
+#include <stddef.h>
+
 namespace outpost
 {
 /**
@@ -74,6 +76,31 @@ struct remove_const<T*>
     typedef typename remove_const<T>::type* type;
 };
 
+/**
+ * Compile-time sequence of indices.
+ *
+ * C++11 replacement for std::index_sequence. Used to expand parameter
+ * packs, e.g. to build lookup tables from constexpr functions.
+ */
+template <size_t... Indices>
+struct IndexSequence
+{
+};
+
+/**
+ * Generates IndexSequence<0, 1, ..., N - 1> as member type `Type`.
+ */
+template <size_t N, size_t... Indices>
+struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, Indices...>
+{
+};
+
+template <size_t... Indices>
+struct MakeIndexSequence<0, Indices...>
+{
+    typedef IndexSequence<Indices...> Type;
+};
+
 }  // namespace outpost
 
 #endif
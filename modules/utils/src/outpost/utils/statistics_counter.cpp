@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "statistics_counter.h"
+
+namespace outpost
+{
+namespace utils
+{
+#if !OUTPOST_UTILS_LOCK_FREE_ATOMICS
+outpost::rtos::Mutex StatisticsCounter::mMutex;
+#endif
+}  // namespace utils
+}  // namespace outpost
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef OUTPOST_UTILS_STATISTICS_COUNTER_H
+#define OUTPOST_UTILS_STATISTICS_COUNTER_H
+
+#include <outpost/rtos/mutex.h>
+#include <outpost/rtos/mutex_guard.h>
+#include <outpost/utils/atomic_support.h>
+
+#include <stdint.h>
+
+namespace outpost
+{
+namespace utils
+{
+/**
+ * Event counter for housekeeping which may be incremented by several
+ * threads without a lock.
+ *
+ * The counter does not order any other memory access, it is only
+ * intended for statistics. Targets without lock-free atomic operations
+ * use a mutex shared by all counters.
+ */
+class StatisticsCounter
+{
+public:
+    StatisticsCounter() : mValue(0)
+    {
+    }
+
+    // disable copy constructor
+    StatisticsCounter(const StatisticsCounter&) = delete;
+
+    // disable copy-assignment operator
+    StatisticsCounter&
+    operator=(const StatisticsCounter&) = delete;
+
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+    inline void
+    increment(uint32_t value = 1)
+    {
+        mValue.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    inline uint32_t
+    get() const
+    {
+        return mValue.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<uint32_t> mValue;
+#else
+    inline void
+    increment(uint32_t value = 1)
+    {
+        outpost::rtos::MutexGuard lock(mMutex);
+        mValue += value;
+    }
+
+    inline uint32_t
+    get() const
+    {
+        outpost::rtos::MutexGuard lock(mMutex);
+        return mValue;
+    }
+
+private:
+    static outpost::rtos::Mutex mMutex;
+
+    uint32_t mValue;
+#endif
+};
+
+}  // namespace utils
+}  // namespace outpost
+
+#endif
@@ -25,15 +25,31 @@ class Bitstream : outpost::SerializableObject
 {
 private:
     outpost::Slice<uint8_t>& mData;  // Buffer for storing the bitstream
-    uint16_t bytePointer;
+    uint32_t bytePointer;
     int8_t bitPointer;
     static constexpr int8_t initialBitPointer = 7;
 
+    // Sequential read cursor
+    uint32_t mReadPosition;   // Next bit returned by readBits()
+    uint32_t mReadPointer;    // Next byte to load into mReadBuffer
+    uint64_t mReadBuffer;     // Loaded bits, most significant bit first
+    uint8_t mReadBufferBits;  // Number of valid bits in mReadBuffer
+
 public:
-    static constexpr uint8_t headerSize = sizeof(bytePointer) + sizeof(bitPointer);
+    /**
+     * Serialized header: bit pointer followed by the size in bytes. The size
+     * is stored with 16 bit, longer streams are cut on serialization.
+     */
+    static constexpr uint8_t headerSize = sizeof(int8_t) + sizeof(uint16_t);
 
     explicit Bitstream(outpost::Slice<uint8_t>& byteArray) :
-        mData(byteArray), bytePointer(headerSize), bitPointer(initialBitPointer)
+        mData(byteArray),
+        bytePointer(headerSize),
+        bitPointer(initialBitPointer),
+        mReadPosition(0),
+        mReadPointer(headerSize),
+        mReadBuffer(0),
+        mReadBufferBits(0)
     {
     }
 
@@ -88,6 +104,55 @@ public:
         }
     }
 
+    /**
+     * Pushes several bits to the stream
+     *
+     * The bits are combined with the current byte in a 64 bit register and
+     * written as whole bytes, which is considerably faster than pushing
+     * them one by one.
+     *
+     * \param value
+     *     Bits to push, the lowest `count` bits are pushed starting with
+     *     the most significant one
+     * \param count
+     *     Number of bits to push, at most 32
+     */
+    void
+    pushBits(uint32_t value, uint8_t count)
+    {
+        // Up to 7 bits of the current byte and 32 new bits span five bytes
+        if ((bytePointer + 5) > mData.getNumberOfElements())
+        {
+            for (int8_t i = static_cast<int8_t>(count - 1); i >= 0; i--)
+            {
+                pushBit((value >> i) & 1U);
+            }
+            return;
+        }
+        if (count == 0)
+        {
+            return;
+        }
+
+        uint8_t* data = &mData[bytePointer];
+        const uint8_t used = static_cast<uint8_t>(initialBitPointer - bitPointer);
+        const uint64_t current = data[0] & static_cast<uint8_t>(0xFF00U >> used);
+        const uint64_t bits = (current << 56)
+                              | ((static_cast<uint64_t>(value) << (64 - count)) >> used);
+
+        // Write the completed bytes and the following byte, which is either
+        // partially filled or cleared for the next bits.
+        const uint8_t total = static_cast<uint8_t>(used + count);
+        const uint8_t completed = total / 8;
+        for (uint8_t i = 0; i <= completed; i++)
+        {
+            data[i] = static_cast<uint8_t>(bits >> (56 - 8 * i));
+        }
+
+        bytePointer += completed;
+        bitPointer = static_cast<int8_t>(initialBitPointer - (total % 8));
+    }
+
     /**
      * Grants bit-level access to the stream
      *
@@ -118,7 +183,7 @@ public:
      * \return Byte value at position n or 0 if n is out of range.
      */
     inline uint8_t
-    getByte(uint16_t n) const
+    getByte(uint32_t n) const
     {
         if (n <= bytePointer - headerSize)
         {
@@ -128,7 +193,88 @@ public:
     }
 
     /**
-     * Resets byte and bit pointer
+     * Reads the next bits at the read cursor
+     *
+     * Decoders should prefer this over getBit(), the bytes are loaded into a
+     * 64 bit register and returned without further bounds checks. Bits
+     * beyond the end of the stream are read as zero. Bits pushed after
+     * their byte has been loaded are only seen after setReadPosition().
+     *
+     * \param count
+     *     Number of bits to read, at most 32
+     * \return The bits, the first one read is the most significant one
+     */
+    inline uint32_t
+    readBits(uint8_t count)
+    {
+        if (mReadBufferBits < count)
+        {
+            fillReadBuffer();
+        }
+        mReadPosition += count;
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        const uint32_t value = static_cast<uint32_t>(mReadBuffer >> (64 - count));
+        mReadBuffer <<= count;
+        mReadBufferBits = (mReadBufferBits > count) ? (mReadBufferBits - count) : 0;
+        return value;
+    }
+
+    /**
+     * Reads the next bit at the read cursor
+     */
+    inline bool
+    readBit()
+    {
+        if (mReadBufferBits == 0)
+        {
+            fillReadBuffer();
+        }
+        if (mReadBufferBits > 0)
+        {
+            mReadBufferBits--;
+        }
+        mReadPosition++;
+
+        const bool bit = (mReadBuffer >> 63) != 0;
+        mReadBuffer <<= 1;
+        return bit;
+    }
+
+    /**
+     * Position of the read cursor
+     * \return Number of bits from the start of the stream
+     */
+    inline uint32_t
+    getReadPosition() const
+    {
+        return mReadPosition;
+    }
+
+    /**
+     * Moves the read cursor
+     * \param n
+     *     Bit in the stream that is read next
+     */
+    inline void
+    setReadPosition(uint32_t n)
+    {
+        mReadPosition = n;
+        mReadPointer = (n >> 3) + headerSize;
+        mReadBuffer = 0;
+        mReadBufferBits = 0;
+
+        fillReadBuffer();
+        const uint8_t offset = n & 7;
+        mReadBuffer <<= offset;
+        mReadBufferBits = (mReadBufferBits > offset) ? (mReadBufferBits - offset) : 0;
+    }
+
+    /**
+     * Resets byte and bit pointer as well as the read cursor
      */
     inline void
     reset()
@@ -136,18 +282,28 @@ public:
         bytePointer = headerSize;
         bitPointer = initialBitPointer;
         mData[bytePointer] = 0;
+        setReadPosition(0);
     }
 
     /**
      * The current size of the stream in bytes
      * \return The current buffer length
      */
-    inline uint16_t
+    inline uint32_t
     getSize() const
     {
         return bytePointer + (bitPointer < 7) - headerSize;
     }
 
+    /**
+     * The current size of the stream in bits
+     */
+    inline uint32_t
+    getNumberOfBits() const
+    {
+        return ((bytePointer - headerSize) << 3) + (initialBitPointer - bitPointer);
+    }
+
     /**
      * Get the size of the parameter.
      *
@@ -156,7 +312,12 @@ public:
     virtual size_t
     getSerializedSize() const override
     {
-        return getSize() + headerSize;
+        const uint32_t size = getSize();
+        if (size > maximumSerializedSize)
+        {
+            return maximumSerializedSize + headerSize;
+        }
+        return size + headerSize;
     }
 
     /**
@@ -177,23 +338,29 @@ public:
      * \param stream
      *      Output stream
      * \param maxLength
-     *      Maximum length of the resulting stream
+     *      Maximum length of the resulting stream. Streams are also cut to
+     *      the 64 KiB that fit into the header.
      */
     virtual void
-    serialize(Serialize& stream, uint16_t maxLength) const
+    serialize(Serialize& stream, size_t maxLength) const
     {
         if (maxLength >= headerSize)
         {
-            uint16_t tmpBytePointer = getSize();
+            uint32_t tmpBytePointer = getSize();
             uint8_t tmpBitPointer = bitPointer;
             if (maxLength < bytePointer)
             {
-                tmpBytePointer = maxLength - headerSize;
+                tmpBytePointer = static_cast<uint32_t>(maxLength - headerSize);
+                tmpBitPointer = 7;
+            }
+            if (tmpBytePointer > maximumSerializedSize)
+            {
+                tmpBytePointer = maximumSerializedSize;
                 tmpBitPointer = 7;
             }
 
             stream.store(tmpBitPointer);
-            stream.store(tmpBytePointer);
+            stream.store(static_cast<uint16_t>(tmpBytePointer));
 
             if (stream.getPointer() != &mData[0])
             {
@@ -218,7 +385,7 @@ public:
     deserialize(Deserialize& stream) override
     {
         uint16_t bitPointer_tmp = stream.read<int8_t>();
-        uint16_t bytePointer_tmp = stream.read<uint16_t>() + headerSize;
+        uint32_t bytePointer_tmp = stream.read<uint16_t>() + headerSize;
         if (bitPointer_tmp < 7)
             bytePointer_tmp--;
         if (bytePointer_tmp < mData.getNumberOfElements())
@@ -233,10 +400,27 @@ public:
             {
                 stream.skip(bytePointer);
             }
+            setReadPosition(0);
             return true;
         }
         return false;
     }
+
+private:
+    /// Largest size in bytes that fits into the serialized header
+    static constexpr uint32_t maximumSerializedSize = 0xFFFF;
+
+    inline void
+    fillReadBuffer()
+    {
+        const uint32_t end = bytePointer + (bitPointer < 7);
+        while ((mReadBufferBits <= 56) && (mReadPointer < end))
+        {
+            mReadBuffer |= static_cast<uint64_t>(mData[mReadPointer]) << (56 - mReadBufferBits);
+            mReadBufferBits += 8;
+            mReadPointer++;
+        }
+    }
 };
 
 }  // namespace outpost
@@ -20,6 +20,7 @@
 
 #include <array>
 #include <iostream>
+#include <set>
 
 using namespace outpost::utils;
 
@@ -2225,3 +2226,36 @@ RC_GTEST_FIXTURE_PROP(BCHRTest, singleBitflipsShouldNotMoveFromCorrectableToWron
 
     EXPECT_GT(itcount, NandBCHInterface::DEF_ERROR_CORRECTION);
 }
+
+RC_GTEST_FIXTURE_PROP(BCHRTest, correctMultipleBitFlips, ())
+{
+    std::array<uint8_t, dataSize> input;
+    std::array<uint8_t, dataSize> output;
+    std::array<uint8_t, dataSize + spareSize> encoded;
+
+    auto rand256 = rc::gen::arbitrary<uint8_t>();
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        input[i] = *rand256;
+    }
+
+    EXPECT_TRUE(bch.encode(outpost::asSlice(input), outpost::asSlice(encoded)));
+
+    // Errors in the data and in the redundancy bytes, more than four errors
+    // are located by the Chien search
+    const uint32_t numberOfBits = (dataSize + bch.getNumberOfRedundantBytes()) * 8;
+    const auto count = *rc::gen::inRange<uint32_t>(1, NandBCHInterface::DEF_ERROR_CORRECTION + 1);
+    std::set<uint32_t> positions;
+    while (positions.size() < count)
+    {
+        positions.insert(*rc::gen::inRange<uint32_t>(0, numberOfBits));
+    }
+    for (uint32_t position : positions)
+    {
+        encoded[position / 8] ^= (1u << (position % 8));
+    }
+
+    EXPECT_EQ(DecodeStatus::corrected,
+              bch.decode(outpost::asSlice(encoded), outpost::asSlice(output)));
+    EXPECT_EQ(output, input);
+}
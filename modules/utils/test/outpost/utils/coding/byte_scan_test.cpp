@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/utils/coding/byte_scan.h>
+
+#include <unittest/harness.h>
+
+#include <string.h>  // for memset
+
+using outpost::utils::ByteScan;
+
+TEST(ByteScanTest, emptyInputContainsNoZero)
+{
+    uint8_t data[1] = {0};
+
+    EXPECT_EQ(0U, ByteScan::findZero(data, 0));
+}
+
+TEST(ByteScanTest, inputWithoutZeroReturnsLength)
+{
+    uint8_t data[67];
+    memset(data, 0xFF, sizeof(data));
+
+    for (size_t offset = 0; offset < 16; ++offset)
+    {
+        EXPECT_EQ(sizeof(data) - offset, ByteScan::findZero(&data[offset], sizeof(data) - offset));
+    }
+}
+
+/*
+ * Check every position of the zero byte relative to every alignment of
+ * the input pointer.
+ */
+TEST(ByteScanTest, shouldFindZeroAtEveryPositionAndAlignment)
+{
+    uint8_t data[80];
+
+    for (size_t offset = 0; offset < 16; ++offset)
+    {
+        for (size_t position = 0; position < sizeof(data) - offset; ++position)
+        {
+            // Bytes which are close to triggering false positives of the
+            // zero detection in neighbouring bytes
+            for (size_t i = 0; i < sizeof(data); ++i)
+            {
+                data[i] = (i % 2) ? 0x01 : 0x80;
+            }
+            data[offset + position] = 0;
+
+            EXPECT_EQ(position, ByteScan::findZero(&data[offset], sizeof(data) - offset))
+                    << "offset " << offset << ", position " << position;
+        }
+    }
+}
+
+TEST(ByteScanTest, shouldFindFirstOfMultipleZeros)
+{
+    uint8_t data[32];
+    memset(data, 0x42, sizeof(data));
+    data[11] = 0;
+    data[12] = 0;
+    data[27] = 0;
+
+    EXPECT_EQ(11U, ByteScan::findZero(data, sizeof(data)));
+    EXPECT_EQ(0U, ByteScan::findZero(&data[12], sizeof(data) - 12));
+    EXPECT_EQ(14U, ByteScan::findZero(&data[13], sizeof(data) - 13));
+}
+
+TEST(ByteScanTest, shouldIgnoreZerosBeyondLength)
+{
+    uint8_t data[32];
+    memset(data, 0x42, sizeof(data));
+    data[20] = 0;
+
+    EXPECT_EQ(20U, ByteScan::findZero(data, 20));
+    EXPECT_EQ(19U, ByteScan::findZero(&data[1], 19));
+}
+
+TEST(ByteScanTest, shouldFindValueAtEveryPositionAndAlignment)
+{
+    uint8_t data[80];
+
+    for (size_t offset = 0; offset < 16; ++offset)
+    {
+        for (size_t position = 0; position < sizeof(data) - offset; ++position)
+        {
+            // Values differing from the searched one in a single bit
+            for (size_t i = 0; i < sizeof(data); ++i)
+            {
+                data[i] = (i % 2) ? 0x7F : 0x3E;
+            }
+            data[offset + position] = 0x7E;
+
+            EXPECT_EQ(position, ByteScan::find(&data[offset], sizeof(data) - offset, 0x7E))
+                    << "offset " << offset << ", position " << position;
+        }
+    }
+}
+
+TEST(ByteScanTest, shouldFindEitherOfTwoValues)
+{
+    uint8_t data[40];
+    memset(data, 0x00, sizeof(data));
+
+    EXPECT_EQ(sizeof(data), ByteScan::findAnyOf(data, sizeof(data), 0x7E, 0x7D));
+
+    data[30] = 0x7D;
+    EXPECT_EQ(30U, ByteScan::findAnyOf(data, sizeof(data), 0x7E, 0x7D));
+
+    data[17] = 0x7E;
+    EXPECT_EQ(17U, ByteScan::findAnyOf(data, sizeof(data), 0x7E, 0x7D));
+    EXPECT_EQ(13U, ByteScan::findAnyOf(&data[4], sizeof(data) - 4, 0x7E, 0x7D));
+    EXPECT_EQ(12U, ByteScan::findAnyOf(&data[18], sizeof(data) - 18, 0x7E, 0x7D));
+    EXPECT_EQ(10U, ByteScan::findAnyOf(&data[20], 10, 0x7E, 0x7D));
+}
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/utils/coding/cobs.h>
+#include <outpost/utils/coding/cobs_stream_decoder.h>
+#include <outpost/utils/container/shared_object_pool.h>
+
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+
+#include <unittest/harness.h>
+
+#include <vector>
+
+using outpost::utils::Cobs;
+using outpost::utils::CobsStreamDecoder;
+using ::testing::ElementsAre;
+using ::testing::ElementsAreArray;
+
+typedef CobsStreamDecoder::Status Status;
+
+class CobsStreamDecoderTest : public ::testing::Test
+{
+public:
+    CobsStreamDecoderTest() : mDecoder(outpost::asSlice(mBuffer))
+    {
+    }
+
+    uint8_t mBuffer[600];
+    CobsStreamDecoder mDecoder;
+};
+
+// ----------------------------------------------------------------------------
+TEST_F(CobsStreamDecoderTest, shouldWaitForDelimiter)
+{
+    uint8_t input[] = {0x03, 0x11, 0x22, 0x02, 0x33};
+
+    EXPECT_EQ(sizeof(input), mDecoder.push(outpost::asSlice(input)));
+    EXPECT_EQ(Status::receiving, mDecoder.getStatus());
+    EXPECT_EQ(0U, mDecoder.getFrame().getNumberOfElements());
+}
+
+TEST_F(CobsStreamDecoderTest, shouldDecodeFrame)
+{
+    uint8_t input[] = {0x03, 0x11, 0x22, 0x02, 0x33, 0x00};
+
+    EXPECT_EQ(sizeof(input), mDecoder.push(outpost::asSlice(input)));
+    ASSERT_EQ(Status::complete, mDecoder.getStatus());
+    EXPECT_THAT(mDecoder.getFrame(), ElementsAre(0x11, 0x22, 0x00, 0x33));
+}
+
+TEST_F(CobsStreamDecoderTest, shouldDecodeFrameSplitIntoSingleBytes)
+{
+    uint8_t input[] = {0x01, 0x03, 0x11, 0x22, 0x01, 0x00};
+
+    for (size_t i = 0; i < sizeof(input); ++i)
+    {
+        EXPECT_EQ(Status::receiving, mDecoder.getStatus());
+        EXPECT_EQ(1U, mDecoder.push(outpost::asSlice(input).subSlice(i, 1)));
+    }
+    ASSERT_EQ(Status::complete, mDecoder.getStatus());
+    EXPECT_THAT(mDecoder.getFrame(), ElementsAre(0x00, 0x11, 0x22, 0x00));
+}
+
+TEST_F(CobsStreamDecoderTest, shouldStopAfterEachFrame)
+{
+    uint8_t input[] = {0x02, 0x11, 0x00, 0x00, 0x03, 0x22, 0x33, 0x00};
+
+    outpost::Slice<const uint8_t> chunk = outpost::asSlice(input);
+    size_t consumed = mDecoder.push(chunk);
+    EXPECT_EQ(3U, consumed);
+    ASSERT_EQ(Status::complete, mDecoder.getStatus());
+    EXPECT_THAT(mDecoder.getFrame(), ElementsAre(0x11));
+
+    // Consecutive delimiters result in an empty frame
+    chunk = chunk.skipFirst(consumed);
+    consumed = mDecoder.push(chunk);
+    EXPECT_EQ(1U, consumed);
+    ASSERT_EQ(Status::complete, mDecoder.getStatus());
+    EXPECT_EQ(0U, mDecoder.getFrame().getNumberOfElements());
+
+    chunk = chunk.skipFirst(consumed);
+    consumed = mDecoder.push(chunk);
+    EXPECT_EQ(4U, consumed);
+    ASSERT_EQ(Status::complete, mDecoder.getStatus());
+    EXPECT_THAT(mDecoder.getFrame(), ElementsAre(0x22, 0x33));
+}
+
+TEST_F(CobsStreamDecoderTest, shouldDetectTruncatedBlock)
+{
+    uint8_t input[] = {0x05, 0x11, 0x22, 0x00, 0x02, 0x33, 0x00};
+
+    EXPECT_EQ(4U, mDecoder.push(outpost::asSlice(input)));
+    EXPECT_EQ(Status::malformed, mDecoder.getStatus());
+    EXPECT_EQ(0U, mDecoder.getFrame().getNumberOfElements());
+
+    // Decoder resynchronizes with the next frame
+    EXPECT_EQ(3U, mDecoder.push(outpost::asSlice(input).skipFirst(4)));
+    ASSERT_EQ(Status::complete, mDecoder.getStatus());
+    EXPECT_THAT(mDecoder.getFrame(), ElementsAre(0x33));
+}
+
+TEST_F(CobsStreamDecoderTest, shouldDetectOverflow)
+{
+    uint8_t buffer[3];
+    CobsStreamDecoder decoder(outpost::asSlice(buffer));
+
+    uint8_t input[] = {0x03, 0x11, 0x22, 0x03, 0x33, 0x44, 0x00, 0x02, 0x55, 0x00};
+
+    EXPECT_EQ(7U, decoder.push(outpost::asSlice(input)));
+    EXPECT_EQ(Status::overflow, decoder.getStatus());
+    EXPECT_EQ(0U, decoder.getFrame().getNumberOfElements());
+
+    EXPECT_EQ(3U, decoder.push(outpost::asSlice(input).skipFirst(7)));
+    ASSERT_EQ(Status::complete, decoder.getStatus());
+    EXPECT_THAT(decoder.getFrame(), ElementsAre(0x55));
+}
+
+TEST_F(CobsStreamDecoderTest, resetShouldDiscardPartialFrame)
+{
+    uint8_t input[] = {0x04, 0x11, 0x22};
+    uint8_t next[] = {0x02, 0x33, 0x00};
+
+    mDecoder.push(outpost::asSlice(input));
+    mDecoder.reset();
+
+    EXPECT_EQ(sizeof(next), mDecoder.push(outpost::asSlice(next)));
+    ASSERT_EQ(Status::complete, mDecoder.getStatus());
+    EXPECT_THAT(mDecoder.getFrame(), ElementsAre(0x33));
+}
+
+TEST(CobsStreamDecoderSharedBufferTest, shouldProvideFrameAsChildPointer)
+{
+    outpost::utils::SharedBufferPool<16, 1> pool;
+    outpost::utils::SharedBufferPointer buffer;
+    ASSERT_TRUE(pool.allocate(buffer));
+
+    CobsStreamDecoder decoder(buffer);
+    uint8_t input[] = {0x02, 0x11, 0x02, 0x22, 0x00};
+
+    outpost::utils::SharedChildPointer frame;
+    EXPECT_FALSE(decoder.getFrame(frame));
+
+    EXPECT_EQ(sizeof(input), decoder.push(outpost::asSlice(input)));
+    ASSERT_EQ(Status::complete, decoder.getStatus());
+    ASSERT_TRUE(decoder.getFrame(frame, 7));
+    EXPECT_EQ(7U, frame.getType());
+    EXPECT_THAT(outpost::Slice<uint8_t>(frame), ElementsAre(0x11, 0x00, 0x22));
+}
+
+// ----------------------------------------------------------------------------
+/*
+ * Encoded frames split into random chunks are decoded to the original data.
+ */
+RC_GTEST_FIXTURE_PROP(CobsStreamDecoderTest, shouldDecodeEncodedFramesInRandomChunks, ())
+{
+    const auto frames = *rc::gen::resize(
+            20, rc::gen::arbitrary<std::vector<std::vector<uint8_t>>>());
+
+    std::vector<uint8_t> stream;
+    for (const auto& frame : frames)
+    {
+        RC_PRE(frame.size() <= 500U);
+        uint8_t encoded[600];
+        size_t length = Cobs::encode(outpost::Slice<const uint8_t>(frame), outpost::asSlice(encoded));
+        stream.insert(stream.end(), encoded, &encoded[length]);
+        stream.push_back(0);
+    }
+
+    mDecoder.reset();
+    std::vector<std::vector<uint8_t>> decoded;
+    size_t position = 0;
+    while (position < stream.size())
+    {
+        const size_t chunkLength = *rc::gen::inRange<size_t>(1, stream.size() - position + 1);
+        outpost::Slice<const uint8_t> chunk =
+                outpost::Slice<const uint8_t>(stream).subSlice(position, chunkLength);
+        while (chunk.getNumberOfElements() > 0)
+        {
+            size_t consumed = mDecoder.push(chunk);
+            RC_ASSERT(consumed > 0U);
+            chunk = chunk.skipFirst(consumed);
+            position += consumed;
+
+            if (mDecoder.getStatus() != Status::receiving)
+            {
+                RC_ASSERT(Status::complete == mDecoder.getStatus());
+                outpost::Slice<uint8_t> frame = mDecoder.getFrame();
+                decoded.push_back(std::vector<uint8_t>(frame.begin(), frame.end()));
+            }
+        }
+    }
+
+    RC_ASSERT(frames == decoded);
+}
+
+/*
+ * Arbitrary data split at the zero bytes is decoded as Cobs::decode()
+ * decodes the individual frames. Frames which end within a block are
+ * reported as malformed.
+ */
+RC_GTEST_FIXTURE_PROP(CobsStreamDecoderTest, shouldMatchDecodeForArbitraryData, ())
+{
+    const auto stream = *rc::gen::resize(
+            500,
+            rc::gen::container<std::vector<uint8_t>>(rc::gen::weightedOneOf<uint8_t>(
+                    {{1, rc::gen::just<uint8_t>(0)},
+                     {3, rc::gen::inRange<uint8_t>(1, 8)},
+                     {6, rc::gen::arbitrary<uint8_t>()}})));
+
+    mDecoder.reset();
+    size_t frameStart = 0;
+    size_t position = 0;
+    while (position < stream.size())
+    {
+        const size_t consumed =
+                mDecoder.push(outpost::Slice<const uint8_t>(stream).skipFirst(position));
+        position += consumed;
+        if (mDecoder.getStatus() == Status::receiving)
+        {
+            RC_ASSERT(position == stream.size());
+            continue;
+        }
+
+        // Check whether the frame consists of complete blocks
+        const size_t frameEnd = position - 1;
+        size_t block = frameStart;
+        while (block < frameEnd)
+        {
+            block += stream[block];
+        }
+
+        if (block == frameEnd)
+        {
+            uint8_t expected[600];
+            const size_t expectedLength = Cobs::decode(
+                    outpost::Slice<const uint8_t>(stream).subSlice(frameStart, frameEnd - frameStart),
+                    expected);
+
+            RC_ASSERT(Status::complete == mDecoder.getStatus());
+            outpost::Slice<uint8_t> frame = mDecoder.getFrame();
+            RC_ASSERT(std::vector<uint8_t>(expected, &expected[expectedLength])
+                      == std::vector<uint8_t>(frame.begin(), frame.end()));
+        }
+        else
+        {
+            RC_ASSERT(Status::malformed == mDecoder.getStatus());
+        }
+        frameStart = position;
+    }
+}
@@ -15,6 +15,8 @@
 
 #include <unittest/harness.h>
 
+#include <string.h>  // for memset
+
 using ::testing::ElementsAreArray;
 
 using outpost::utils::Cobs;
@@ -419,3 +421,83 @@ TEST(CobsTest, shouldAbortDecodingWhenZeroBytesAreDetected)
 
     ASSERT_EQ(0U, encodedLength);
 }
+
+/*
+ * Byte-wise reference implementation of the encoder
+ */
+static size_t
+encodeBytewise(const uint8_t* input, size_t inputLength, uint8_t* output, size_t outputLength)
+{
+    uint8_t* blockLengthPtr = output++;
+    size_t length = 1;
+    uint8_t currentBlockLength = 0;
+    for (size_t i = 0; (i < inputLength) && (length < outputLength); ++i)
+    {
+        if (input[i] == 0)
+        {
+            *blockLengthPtr = currentBlockLength + 1;
+            blockLengthPtr = output++;
+            length++;
+            currentBlockLength = 0;
+        }
+        else
+        {
+            *output++ = input[i];
+            length++;
+            currentBlockLength++;
+            if ((currentBlockLength == 254) && (length < outputLength))
+            {
+                *blockLengthPtr = currentBlockLength + 1;
+                blockLengthPtr = output++;
+                length++;
+                currentBlockLength = 0;
+            }
+        }
+    }
+    *blockLengthPtr = currentBlockLength + 1;
+
+    return length;
+}
+
+/*
+ * The encoder copies runs of non-zero bytes at once. Compare it against
+ * the byte-wise algorithm for all alignments of the input and output
+ * buffers and for truncated output buffers.
+ */
+TEST(CobsTest, encodingMatchesBytewiseAlgorithm)
+{
+    uint8_t input[600];
+    for (size_t i = 0; i < sizeof(input); ++i)
+    {
+        input[i] = static_cast<uint8_t>((i * 37) | 1);
+    }
+    // Single and double zeros, a run of exactly one block and a run
+    // longer than a block
+    input[3] = 0;
+    input[7] = 0;
+    input[8] = 0;
+    input[8 + 254 + 1] = 0;
+
+    uint8_t expected[700];
+    uint8_t actual[700];
+    for (size_t offset = 0; offset < 9; ++offset)
+    {
+        const size_t inputLength = sizeof(input) - offset;
+        for (size_t outputLength = 1; outputLength < 680; outputLength += 1 + outputLength / 8)
+        {
+            memset(expected, 0xAB, sizeof(expected));
+            memset(actual, 0xAB, sizeof(actual));
+
+            size_t expectedLength =
+                    encodeBytewise(&input[offset], inputLength, &expected[offset], outputLength);
+            size_t encodedLength =
+                    Cobs::encode(outpost::asSlice(input).subSlice(offset, inputLength),
+                                 outpost::asSlice(actual).subSlice(offset, outputLength));
+
+            ASSERT_EQ(expectedLength, encodedLength)
+                    << "offset " << offset << ", output length " << outputLength;
+            EXPECT_THAT(expected, ElementsAreArray(actual))
+                    << "offset " << offset << ", output length " << outputLength;
+        }
+    }
+}
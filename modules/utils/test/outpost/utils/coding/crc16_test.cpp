@@ -259,3 +259,37 @@ TEST(Crc16Test, testRandom3)
 
     EXPECT_EQ(0, Crc16Ccitt::calculate(outpost::asSlice(data)));
 }
+
+/**
+ * Check the slicing-by-8 algorithm for all lengths around the block size
+ * and for streaming updates with blocks and single bytes.
+ */
+TEST(Crc16Test, blockUpdateMatchesBitwise)
+{
+    uint8_t data[100];
+    for (size_t i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = static_cast<uint8_t>((i * 89) ^ 0x5A);
+    }
+
+    for (size_t length = 0; length <= sizeof(data); ++length)
+    {
+        uint16_t expected = 0xffff;
+        for (size_t i = 0; i < length; ++i)
+        {
+            expected = crc_xmodem_update(expected, data[i]);
+        }
+
+        EXPECT_EQ(expected, Crc16Ccitt::calculate(outpost::asSlice(data).first(length)))
+                << "length " << length;
+
+        Crc16Ccitt crc;
+        crc.update(outpost::asSlice(data).first(length / 3));
+        crc.update(outpost::asSlice(data).subSlice(length / 3, length / 3));
+        for (size_t i = 2 * (length / 3); i < length; ++i)
+        {
+            crc.update(data[i]);
+        }
+        EXPECT_EQ(expected, crc.getValue()) << "length " << length;
+    }
+}
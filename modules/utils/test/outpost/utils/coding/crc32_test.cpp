@@ -117,3 +117,80 @@ TEST(Crc32Test, bitwiseTest)
 
     EXPECT_EQ(crc, Crc32Reversed::calculate(outpost::asSlice(data)));
 }
+
+static uint32_t
+crc32_bitwise(const uint8_t* data, size_t length)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < length; ++i)
+    {
+        crc = crc32_update_bitwise_lsb_first(crc, data[i]);
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+/**
+ * Check the block algorithms (slicing-by-8 and carry-less multiplication)
+ * for all lengths around their block boundaries and for unaligned data.
+ */
+TEST(Crc32Test, blockAlgorithmMatchesBitwise)
+{
+    uint8_t data[1100];
+    for (size_t i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = static_cast<uint8_t>((i * 167) ^ (i >> 3));
+    }
+
+    for (size_t offset = 0; offset < 8; ++offset)
+    {
+        for (size_t length = 0; length <= 300; ++length)
+        {
+            EXPECT_EQ(crc32_bitwise(&data[offset], length),
+                      Crc32Reversed::calculate(outpost::asSlice(data).subSlice(offset, length)))
+                    << "offset " << offset << ", length " << length;
+        }
+    }
+
+    size_t length = sizeof(data) - 1;
+    EXPECT_EQ(crc32_bitwise(&data[1], length),
+              Crc32Reversed::calculate(outpost::asSlice(data).subSlice(1, length)));
+}
+
+TEST(Crc32Test, blockUpdateMatchesByteUpdate)
+{
+    uint8_t data[512];
+    for (size_t i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = static_cast<uint8_t>(255 - i);
+    }
+
+    Crc32Reversed bytewise;
+    for (auto d : data)
+    {
+        bytewise.update(d);
+    }
+
+    // Feed the data in chunks of different size, mixed with single bytes
+    Crc32Reversed blockwise;
+    outpost::Slice<const uint8_t> remaining = outpost::asSlice(data);
+    size_t chunk = 1;
+    while (remaining.getNumberOfElements() > 0)
+    {
+        if (chunk > remaining.getNumberOfElements())
+        {
+            chunk = remaining.getNumberOfElements();
+        }
+        blockwise.update(remaining.first(chunk));
+        remaining = remaining.skipFirst(chunk);
+
+        if (remaining.getNumberOfElements() > 0)
+        {
+            blockwise.update(remaining[0]);
+            remaining = remaining.skipFirst(1);
+        }
+        chunk = chunk * 3 + 1;
+    }
+
+    EXPECT_EQ(bytewise.getValue(), blockwise.getValue());
+    EXPECT_EQ(bytewise.getValue(), Crc32Reversed::calculate(outpost::asSlice(data)));
+}
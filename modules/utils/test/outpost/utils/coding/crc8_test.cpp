@@ -71,6 +71,31 @@ TEST(Crc8CcittTest, bitwiseTest)
     EXPECT_EQ(crc, Crc8Ccitt::calculate(outpost::asSlice(data)));
 }
 
+TEST(Crc8CcittTest, blockUpdateMatchesBitwise)
+{
+    uint8_t data[40];
+    for (size_t i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = static_cast<uint8_t>((i * 89) ^ 0x5A);
+    }
+
+    for (size_t length = 0; length <= sizeof(data); ++length)
+    {
+        uint8_t expected = 0;
+        for (size_t i = 0; i < length; ++i)
+        {
+            expected = crc8_update_bitwise_msb_first(expected, data[i]);
+        }
+
+        EXPECT_EQ(expected, Crc8Ccitt::calculate(outpost::asSlice(data).first(length)));
+
+        Crc8Ccitt crc;
+        crc.update(outpost::asSlice(data).first(length / 2));
+        crc.update(outpost::asSlice(data).skipFirst(length / 2).first(length - length / 2));
+        EXPECT_EQ(expected, crc.getValue());
+    }
+}
+
 // ----------------------------------------------------------------------------
 TEST(Crc8CcittReversedTest, initialValue)
 {
@@ -301,3 +326,28 @@ TEST(Crc8CcittReversedTest, bitwiseTest)
 
     EXPECT_EQ(crc, Crc8CcittReversed::calculate(outpost::asSlice(data)));
 }
+
+TEST(Crc8CcittReversedTest, blockUpdateMatchesBitwise)
+{
+    uint8_t data[40];
+    for (size_t i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = static_cast<uint8_t>((i * 89) ^ 0x5A);
+    }
+
+    for (size_t length = 0; length <= sizeof(data); ++length)
+    {
+        uint8_t expected = 0;
+        for (size_t i = 0; i < length; ++i)
+        {
+            expected = crc8_update_bitwise(expected, data[i]);
+        }
+
+        EXPECT_EQ(expected, Crc8CcittReversed::calculate(outpost::asSlice(data).first(length)));
+
+        Crc8CcittReversed crc;
+        crc.update(outpost::asSlice(data).first(length / 2));
+        crc.update(outpost::asSlice(data).skipFirst(length / 2).first(length - length / 2));
+        EXPECT_EQ(expected, crc.getValue());
+    }
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+/**
+ * \file
+ * \brief   Test the generic CRC implementation
+ *
+ * Check values are taken from the "Catalogue of parametrised CRC
+ * algorithms" (https://reveng.sourceforge.io/crc-catalogue/) and are the
+ * CRCs of the ASCII string "123456789".
+ */
+#include <outpost/utils/coding/crc.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+using outpost::Crc;
+
+static const uint8_t checkString[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+template <typename CrcType>
+static uint32_t
+checkValue()
+{
+    return CrcType::calculate(outpost::asSlice(checkString));
+}
+
+/**
+ * Bit-by-bit reference implementation of the Rocksoft^tm model with
+ * identical input and output reflection.
+ */
+static uint32_t
+calculateBitwise(uint32_t width,
+                 uint32_t polynomial,
+                 uint32_t initialValue,
+                 uint32_t finalXor,
+                 bool reflected,
+                 const uint8_t* data,
+                 size_t length)
+{
+    const uint64_t mask = (1ULL << width) - 1;
+    const uint64_t topBit = 1ULL << (width - 1);
+    uint64_t crc = initialValue;
+    for (size_t i = 0; i < length; ++i)
+    {
+        for (uint32_t bit = 0; bit < 8; ++bit)
+        {
+            const uint32_t input = reflected ? ((data[i] >> bit) & 1) : ((data[i] >> (7 - bit)) & 1);
+            const bool feedback = ((crc & topBit) != 0) != (input != 0);
+            crc = (crc << 1) & mask;
+            if (feedback)
+            {
+                crc ^= polynomial;
+            }
+        }
+    }
+
+    if (reflected)
+    {
+        uint64_t reversed = 0;
+        for (uint32_t bit = 0; bit < width; ++bit)
+        {
+            reversed |= ((crc >> bit) & 1) << (width - 1 - bit);
+        }
+        crc = reversed;
+    }
+    return static_cast<uint32_t>((crc ^ finalXor) & mask);
+}
+
+template <typename CrcType>
+static void
+expectMatchesBitwise(uint32_t width,
+                     uint32_t polynomial,
+                     uint32_t initialValue,
+                     uint32_t finalXor,
+                     bool reflected)
+{
+    uint8_t data[300];
+    for (size_t i = 0; i < sizeof(data); ++i)
+    {
+        data[i] = static_cast<uint8_t>((i * 211) ^ (i >> 2));
+    }
+
+    for (size_t offset = 0; offset < 3; ++offset)
+    {
+        for (size_t length = 0; length <= sizeof(data) - offset; length += 1 + length / 16)
+        {
+            const uint32_t expected = calculateBitwise(
+                    width, polynomial, initialValue, finalXor, reflected, &data[offset], length);
+            EXPECT_EQ(expected,
+                      CrcType::calculate(outpost::asSlice(data).subSlice(offset, length)))
+                    << "offset " << offset << ", length " << length;
+
+            CrcType crc;
+            crc.update(data[offset]);
+            crc.reset();
+            crc.update(outpost::asSlice(data).subSlice(offset, length / 2));
+            crc.update(outpost::asSlice(data).subSlice(offset + length / 2, length - length / 2));
+            EXPECT_EQ(expected, crc.getValue()) << "offset " << offset << ", length " << length;
+        }
+    }
+}
+
+TEST(CrcTest, crc8CheckValues)
+{
+    // CRC-8/SMBUS
+    EXPECT_EQ(0xF4U, (checkValue<Crc<8, 0x07, 0x00, 0x00, false>>()));
+    // CRC-8/MAXIM-DOW
+    EXPECT_EQ(0xA1U, (checkValue<Crc<8, 0x31, 0x00, 0x00, true>>()));
+    // CRC-8/ROHC
+    EXPECT_EQ(0xD0U, (checkValue<Crc<8, 0x07, 0xFF, 0x00, true>>()));
+}
+
+TEST(CrcTest, crc16CheckValues)
+{
+    // CRC-16/IBM-3740
+    EXPECT_EQ(0x29B1U, (checkValue<Crc<16, 0x1021, 0xFFFF, 0x0000, false>>()));
+    // CRC-16/XMODEM
+    EXPECT_EQ(0x31C3U, (checkValue<Crc<16, 0x1021, 0x0000, 0x0000, false>>()));
+    // CRC-16/ARC
+    EXPECT_EQ(0xBB3DU, (checkValue<Crc<16, 0x8005, 0x0000, 0x0000, true>>()));
+    // CRC-16/IBM-SDLC
+    EXPECT_EQ(0x906EU, (checkValue<Crc<16, 0x1021, 0xFFFF, 0xFFFF, true>>()));
+}
+
+TEST(CrcTest, crc32CheckValues)
+{
+    // CRC-32/ISO-HDLC
+    EXPECT_EQ(0xCBF43926U, (checkValue<Crc<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true>>()));
+    // CRC-32/ISCSI
+    EXPECT_EQ(0xE3069283U, (checkValue<Crc<32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true>>()));
+    // CRC-32/AUTOSAR
+    EXPECT_EQ(0x1697D06AU, (checkValue<Crc<32, 0xF4ACFB13, 0xFFFFFFFF, 0xFFFFFFFF, true>>()));
+    // CRC-32/BZIP2
+    EXPECT_EQ(0xFC891918U, (checkValue<Crc<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, false>>()));
+    // CRC-32/MPEG-2
+    EXPECT_EQ(0x0376E6E7U, (checkValue<Crc<32, 0x04C11DB7, 0xFFFFFFFF, 0x00000000, false>>()));
+}
+
+TEST(CrcTest, aliasesMatchGenericImplementation)
+{
+    EXPECT_EQ(0xF4U, checkValue<outpost::Crc8Ccitt>());
+    EXPECT_EQ(0x29B1U, checkValue<outpost::Crc16Ccitt>());
+    EXPECT_EQ(0xCBF43926U, checkValue<outpost::Crc32Reversed>());
+    EXPECT_EQ(0xE3069283U, checkValue<outpost::Crc32Castagnoli>());
+}
+
+TEST(CrcTest, blockUpdateMatchesBitwise)
+{
+    expectMatchesBitwise<Crc<8, 0x31, 0x00, 0x00, true>>(8, 0x31, 0x00, 0x00, true);
+    expectMatchesBitwise<Crc<8, 0x07, 0x55, 0x00, false>>(8, 0x07, 0x55, 0x00, false);
+    expectMatchesBitwise<Crc<16, 0x8005, 0x0000, 0x0000, true>>(16, 0x8005, 0x0000, 0x0000, true);
+    expectMatchesBitwise<Crc<16, 0x1021, 0xFFFF, 0x0000, false>>(
+            16, 0x1021, 0xFFFF, 0x0000, false);
+    expectMatchesBitwise<Crc<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, false>>(
+            32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, false);
+}
+
+/**
+ * Reflected 32-bit CRCs use carry-less multiplications for long blocks
+ * if available. The folding constants are derived from the polynomial.
+ */
+TEST(CrcTest, foldingMatchesBitwise)
+{
+    expectMatchesBitwise<Crc<32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true>>(
+            32, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true);
+    expectMatchesBitwise<Crc<32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true>>(
+            32, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true);
+    expectMatchesBitwise<Crc<32, 0xF4ACFB13, 0x12345678, 0x00000000, true>>(
+            32, 0xF4ACFB13, 0x12345678, 0x00000000, true);
+}
+
+TEST(CrcTest, foldingConstantsForCrc32)
+{
+    const outpost::CrcFoldingConstants& constants =
+            outpost::CrcFoldingGenerator<0x04C11DB7>::constants;
+
+    EXPECT_EQ(0x154442BD4ULL, constants.k1);
+    EXPECT_EQ(0x1C6E41596ULL, constants.k2);
+    EXPECT_EQ(0x1751997D0ULL, constants.k3);
+    EXPECT_EQ(0x0CCAA009EULL, constants.k4);
+    EXPECT_EQ(0x163CD6124ULL, constants.k5);
+    EXPECT_EQ(0x1DB710641ULL, constants.polynomial);
+    EXPECT_EQ(0x1F7011641ULL, constants.mu);
+}
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/utils/coding/hdlc.h>
+#include <outpost/utils/coding/hdlc_stream_decoder.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+
+#include <vector>
+
+using outpost::utils::HdlcStreamDecoder;
+using outpost::utils::HdlcStuffing;
+using ::testing::ElementsAre;
+
+class FrameCollector : public outpost::Callable
+{
+public:
+    void
+    onFrame(outpost::Slice<const uint8_t> frame)
+    {
+        frames.push_back(std::vector<uint8_t>(frame.begin(), frame.end()));
+    }
+
+    std::vector<std::vector<uint8_t>> frames;
+};
+
+class HdlcStreamDecoderTest : public ::testing::Test
+{
+public:
+    HdlcStreamDecoderTest() :
+        mDecoder(outpost::asSlice(mBuffer),
+                 HdlcStreamDecoder::FrameHandler(mCollector, &FrameCollector::onFrame))
+    {
+    }
+
+    size_t
+    push(std::vector<uint8_t> input)
+    {
+        return mDecoder.push(outpost::Slice<const uint8_t>(input));
+    }
+
+    FrameCollector mCollector;
+    uint8_t mBuffer[16];
+    HdlcStreamDecoder mDecoder;
+};
+
+// ----------------------------------------------------------------------------
+TEST_F(HdlcStreamDecoderTest, shouldIgnoreDataOutsideOfFrames)
+{
+    EXPECT_EQ(0U, push({1, 2, 0x7D, 3}));
+    EXPECT_EQ(0U, mCollector.frames.size());
+    EXPECT_EQ(0U, mDecoder.getNumberOfErrors());
+}
+
+TEST_F(HdlcStreamDecoderTest, shouldDecodeMultipleFramesInOneChunk)
+{
+    EXPECT_EQ(3U, push({0x00, 0x7E, 1, 2, 0x7E, 3, 0x7D, 0x5E, 0x7E, 0x7E, 0x7D, 0x5D, 0x7E, 9}));
+
+    ASSERT_EQ(3U, mCollector.frames.size());
+    EXPECT_THAT(mCollector.frames[0], ElementsAre(1, 2));
+    EXPECT_THAT(mCollector.frames[1], ElementsAre(3, 0x7E));
+    EXPECT_THAT(mCollector.frames[2], ElementsAre(0x7D));
+    EXPECT_EQ(3U, mDecoder.getNumberOfFrames());
+}
+
+TEST_F(HdlcStreamDecoderTest, shouldResumeFrameAcrossChunks)
+{
+    EXPECT_EQ(0U, push({0x7E, 1, 2}));
+    EXPECT_EQ(0U, push({3, 0x7D}));
+    EXPECT_EQ(1U, push({0x5E, 0x7E, 0x7E, 4}));
+    EXPECT_EQ(1U, push({0x7E}));
+
+    ASSERT_EQ(2U, mCollector.frames.size());
+    EXPECT_THAT(mCollector.frames[0], ElementsAre(1, 2, 3, 0x7E));
+    EXPECT_THAT(mCollector.frames[1], ElementsAre(4));
+}
+
+TEST_F(HdlcStreamDecoderTest, shouldDiscardAbortedFrame)
+{
+    // An escaped boundary byte aborts the frame but starts the next one
+    EXPECT_EQ(1U, push({0x7E, 1, 2, 0x7D, 0x7E, 3, 0x7E}));
+
+    ASSERT_EQ(1U, mCollector.frames.size());
+    EXPECT_THAT(mCollector.frames[0], ElementsAre(3));
+    EXPECT_EQ(1U, mDecoder.getNumberOfErrors());
+}
+
+TEST_F(HdlcStreamDecoderTest, shouldDiscardFrameWithTwoEscapes)
+{
+    EXPECT_EQ(1U, push({0x7E, 1, 0x7D, 0x7D, 2, 0x7E, 3, 0x7E}));
+
+    ASSERT_EQ(1U, mCollector.frames.size());
+    EXPECT_THAT(mCollector.frames[0], ElementsAre(3));
+    EXPECT_EQ(1U, mDecoder.getNumberOfErrors());
+}
+
+TEST_F(HdlcStreamDecoderTest, shouldDiscardFrameExceedingBuffer)
+{
+    std::vector<uint8_t> input = {0x7E};
+    input.insert(input.end(), 17, 0x11);
+    input.push_back(0x7E);
+    input.insert(input.end(), 16, 0x22);
+    input.push_back(0x7E);
+
+    EXPECT_EQ(1U, push(input));
+
+    ASSERT_EQ(1U, mCollector.frames.size());
+    EXPECT_EQ(std::vector<uint8_t>(16, 0x22), mCollector.frames[0]);
+    EXPECT_EQ(1U, mDecoder.getNumberOfErrors());
+}
+
+TEST_F(HdlcStreamDecoderTest, resetShouldDiscardPartialFrame)
+{
+    push({0x7E, 1, 2});
+    mDecoder.reset();
+
+    EXPECT_EQ(1U, push({3, 0x7E, 4, 0x7E}));
+    ASSERT_EQ(1U, mCollector.frames.size());
+    EXPECT_THAT(mCollector.frames[0], ElementsAre(4));
+}
+
+TEST(HdlcStreamDecoderRingBufferTest, shouldAppendFramesToRingBuffer)
+{
+    outpost::utils::SharedBufferPool<8, 2> pool;
+    outpost::utils::SharedBufferPointer pointers[2];
+    uint8_t flags[2];
+    outpost::utils::SharedRingBuffer frames(outpost::asSlice(pointers), outpost::asSlice(flags));
+
+    HdlcStreamDecoder decoder(pool, frames);
+
+    uint8_t input[] = {0x7E, 1, 2, 0x7E, 3, 0x7E, 4, 0x7E};
+    EXPECT_EQ(2U, decoder.push(outpost::asSlice(input)));
+
+    // Both buffers of the pool are used by the frames in the ring buffer,
+    // the third frame is dropped
+    EXPECT_EQ(0U, pool.numberOfFreeElements());
+    EXPECT_EQ(1U, decoder.getNumberOfDroppedFrames());
+
+    ASSERT_EQ(2U, frames.getUsedSlots());
+    EXPECT_THAT(outpost::Slice<uint8_t>(frames.peek(0)), ElementsAre(1, 2));
+    EXPECT_THAT(outpost::Slice<uint8_t>(frames.peek(1)), ElementsAre(3));
+
+    frames.pop();
+    frames.pop();
+    EXPECT_EQ(2U, pool.numberOfFreeElements());
+
+    uint8_t next[] = {5, 0x7E, 0x7E, 6};
+    EXPECT_EQ(1U, decoder.push(outpost::asSlice(next)));
+    ASSERT_EQ(1U, frames.getUsedSlots());
+    EXPECT_THAT(outpost::Slice<uint8_t>(frames.peek(0)), ElementsAre(5));
+}
+
+// ----------------------------------------------------------------------------
+/*
+ * Encoded frames split into random chunks are decoded to the original
+ * data.
+ */
+RC_GTEST_FIXTURE_PROP(HdlcStreamDecoderTest, shouldDecodeEncodedFramesInRandomChunks, ())
+{
+    auto frames = *rc::gen::container<std::vector<std::vector<uint8_t>>>(
+            rc::gen::resize(16,
+                            rc::gen::nonEmpty(rc::gen::container<std::vector<uint8_t>>(
+                                    rc::gen::weightedOneOf<uint8_t>(
+                                            {{1, rc::gen::just<uint8_t>(0x7E)},
+                                             {1, rc::gen::just<uint8_t>(0x7D)},
+                                             {4, rc::gen::arbitrary<uint8_t>()}})))));
+
+    std::vector<uint8_t> stream;
+    for (auto& frame : frames)
+    {
+        // limited by the work buffer of the decoder
+        if (frame.size() > sizeof(mBuffer))
+        {
+            frame.resize(sizeof(mBuffer));
+        }
+
+        uint8_t buffer[64];
+        outpost::Slice<uint8_t> encoded = outpost::asSlice(buffer);
+        RC_ASSERT(HdlcStuffing::encode(outpost::Slice<const uint8_t>(frame), encoded) > 0U);
+        stream.insert(stream.end(), encoded.begin(), encoded.end());
+    }
+
+    mDecoder.reset();
+    mCollector.frames.clear();
+
+    size_t position = 0;
+    while (position < stream.size())
+    {
+        const size_t chunkLength = *rc::gen::inRange<size_t>(1, stream.size() - position + 1);
+        mDecoder.push(outpost::Slice<const uint8_t>(stream).subSlice(position, chunkLength));
+        position += chunkLength;
+    }
+
+    RC_ASSERT(frames == mCollector.frames);
+}
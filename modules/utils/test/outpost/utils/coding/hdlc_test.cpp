@@ -15,6 +15,9 @@
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <rapidcheck/gtest.h>
+
+#include <vector>
 
 using ::testing::ElementsAreArray;
 
@@ -427,3 +430,119 @@ TEST_F(HdlcTest, decodeOneMarker)
     ASSERT_EQ(input[0], 0x7E);
     ASSERT_EQ(input[1], 2);  // checking truncation works
 }
+
+// ----------------------------------------------------------------------------
+namespace
+{
+/*
+ * Byte-wise reference implementation of the decoder
+ */
+size_t
+decodeBytewise(const std::vector<uint8_t>& input, std::vector<uint8_t>& output)
+{
+    size_t frameStart = 0;
+    size_t outputPosition = 0;
+    bool escaped = false;
+    bool inframe = false;
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+        uint8_t data = input[i];
+        if (data == HdlcStuffing::boundary_byte)
+        {
+            if (inframe)
+            {
+                output.resize(escaped ? 0 : outputPosition);
+                return i;
+            }
+            frameStart = i;
+            outputPosition = 0;
+            inframe = true;
+        }
+        else if (data == HdlcStuffing::escape_byte)
+        {
+            if (escaped)
+            {
+                output.clear();
+                return i;
+            }
+            escaped = inframe;
+        }
+        else
+        {
+            if (inframe)
+            {
+                if (outputPosition == output.size())
+                {
+                    output.clear();
+                    return frameStart;
+                }
+                output[outputPosition++] = escaped ? (data ^ HdlcStuffing::mask) : data;
+            }
+            escaped = false;
+        }
+    }
+    output.clear();
+    return frameStart;
+}
+
+rc::Gen<std::vector<uint8_t>>
+hdlcData()
+{
+    // Special characters are frequent to cover all error cases
+    return rc::gen::container<std::vector<uint8_t>>(rc::gen::weightedOneOf<uint8_t>(
+            {{1, rc::gen::just(static_cast<uint8_t>(HdlcStuffing::boundary_byte))},
+             {1, rc::gen::just(static_cast<uint8_t>(HdlcStuffing::escape_byte))},
+             {6, rc::gen::arbitrary<uint8_t>()}}));
+}
+}  // namespace
+
+RC_GTEST_PROP(HdlcPropertyTest, decodeMatchesBytewiseDecoding, ())
+{
+    const auto input = *rc::gen::resize(300, hdlcData());
+    const auto outputSize = *rc::gen::inRange<size_t>(0, 300);
+
+    std::vector<uint8_t> expected(outputSize);
+    const size_t expectedPosition = decodeBytewise(input, expected);
+
+    std::vector<uint8_t> buffer(outputSize);
+    outpost::Slice<uint8_t> output(buffer);
+    const size_t position = HdlcStuffing::decode(outpost::Slice<const uint8_t>(input), output);
+
+    RC_ASSERT(expectedPosition == position);
+    RC_ASSERT(expected == std::vector<uint8_t>(output.begin(), output.end()));
+}
+
+RC_GTEST_PROP(HdlcPropertyTest, shouldPerformRoundTrip, ())
+{
+    const auto input = *rc::gen::resize(300, hdlcData());
+    const auto outputSize = *rc::gen::inRange<size_t>(0, 2 * input.size() + 3);
+
+    size_t specialBytes = 0;
+    for (uint8_t data : input)
+    {
+        if ((data == HdlcStuffing::boundary_byte) || (data == HdlcStuffing::escape_byte))
+        {
+            specialBytes++;
+        }
+    }
+    const size_t encodedSize = input.size() + specialBytes + HdlcStuffing::boundary_overhead;
+
+    std::vector<uint8_t> buffer(outputSize);
+    outpost::Slice<uint8_t> encoded(buffer);
+    const size_t encodedLength =
+            HdlcStuffing::encode(outpost::Slice<const uint8_t>(input), encoded);
+    if (encodedSize > outputSize)
+    {
+        RC_ASSERT(0U == encodedLength);
+        return;
+    }
+    RC_ASSERT(encodedSize == encodedLength);
+    RC_ASSERT(encodedSize == encoded.getNumberOfElements());
+
+    // decode in place
+    outpost::Slice<uint8_t> decoded = encoded;
+    const size_t position = HdlcStuffing::decode(encoded, decoded);
+
+    RC_ASSERT(encodedLength - 1 == position);
+    RC_ASSERT(input == std::vector<uint8_t>(decoded.begin(), decoded.end()));
+}
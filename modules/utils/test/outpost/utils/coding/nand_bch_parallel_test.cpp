@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/utils/coding/nand_bch_compiletime.h>
+#include <outpost/utils/coding/nand_bch_parallel.h>
+#include <outpost/utils/coding/nand_bch_runtime.h>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace outpost::utils;
+
+namespace
+{
+constexpr uint32_t dataSize = 2048;
+constexpr uint32_t spareSize = 64;
+constexpr uint32_t pageSize = dataSize + spareSize;
+constexpr uint32_t sectorsPerPage = dataSize / NandBCHInterface::sectorSize;
+constexpr uint32_t numberOfPages = 6;
+
+typedef NandBCHCTime<13, 8, dataSize, spareSize> Codec;
+
+void
+flipBit(std::vector<uint8_t>& data, size_t byte, uint32_t bit)
+{
+    data[byte] = static_cast<uint8_t>(data[byte] ^ (1U << bit));
+}
+}  // namespace
+
+class NandBCHBatchTest : public ::testing::Test
+{
+public:
+    NandBCHBatchTest() :
+        mData(numberOfPages * dataSize),
+        mEncoded(numberOfPages * pageSize),
+        mDecoded(numberOfPages * dataSize),
+        mSectorStatus(numberOfPages * sectorsPerPage, DecodeStatus::invalidParameters)
+    {
+        for (size_t i = 0; i < mData.size(); i++)
+        {
+            mData[i] = static_cast<uint8_t>((i * 167) ^ (i >> 9));
+        }
+    }
+
+    outpost::Slice<DecodeStatus>
+    sectorStatus()
+    {
+        return outpost::Slice<DecodeStatus>::unsafe(mSectorStatus.data(), mSectorStatus.size());
+    }
+
+    /// Correctable error in page 1, sector 2 and uncorrectable errors in page 4, sector 0
+    void
+    injectErrors()
+    {
+        flipBit(mEncoded, pageSize + 2 * NandBCHInterface::sectorSize + 17, 3);
+        flipBit(mEncoded, pageSize + 2 * NandBCHInterface::sectorSize + 400, 6);
+        for (uint32_t i = 0; i < 40; i++)
+        {
+            flipBit(mEncoded, 4 * pageSize + i * 11, i % 8);
+        }
+    }
+
+    void
+    expectSectorStatus()
+    {
+        for (uint32_t i = 0; i < mSectorStatus.size(); i++)
+        {
+            DecodeStatus expected = DecodeStatus::noError;
+            if (i == sectorsPerPage + 2)
+            {
+                expected = DecodeStatus::corrected;
+            }
+            else if (i == 4 * sectorsPerPage)
+            {
+                expected = DecodeStatus::uncorrectable;
+            }
+            EXPECT_EQ(expected, mSectorStatus[i]) << "sector " << i;
+        }
+    }
+
+    Codec mCodec;
+    std::vector<uint8_t> mData;
+    std::vector<uint8_t> mEncoded;
+    std::vector<uint8_t> mDecoded;
+    std::vector<DecodeStatus> mSectorStatus;
+};
+
+TEST_F(NandBCHBatchTest, pageGeometry)
+{
+    EXPECT_EQ(sectorsPerPage, mCodec.getNumberOfSectors());
+    EXPECT_EQ(spareSize, mCodec.getNumberOfSparebytes());
+    EXPECT_EQ(pageSize, mCodec.getPageSize());
+}
+
+TEST_F(NandBCHBatchTest, encodePagesMatchesSinglePages)
+{
+    ASSERT_TRUE(mCodec.encodePages(
+            outpost::asSlice(mData), outpost::asSlice(mEncoded), numberOfPages));
+
+    std::vector<uint8_t> page(pageSize);
+    for (uint32_t i = 0; i < numberOfPages; i++)
+    {
+        ASSERT_TRUE(mCodec.encode(outpost::asSlice(mData).subSlice(i * dataSize, dataSize),
+                                  outpost::asSlice(page)));
+        EXPECT_TRUE(std::equal(page.begin(), page.end(), mEncoded.begin() + i * pageSize));
+    }
+}
+
+TEST_F(NandBCHBatchTest, decodePagesReportsStatusPerSector)
+{
+    ASSERT_TRUE(mCodec.encodePages(
+            outpost::asSlice(mData), outpost::asSlice(mEncoded), numberOfPages));
+    injectErrors();
+
+    EXPECT_EQ(DecodeStatus::uncorrectable,
+              mCodec.decodePages(outpost::asSlice(mEncoded),
+                                 outpost::asSlice(mDecoded),
+                                 sectorStatus(),
+                                 numberOfPages));
+    expectSectorStatus();
+
+    // Everything except the uncorrectable sector is restored
+    mDecoded.erase(mDecoded.begin() + 4 * dataSize,
+                   mDecoded.begin() + 4 * dataSize + NandBCHInterface::sectorSize);
+    mData.erase(mData.begin() + 4 * dataSize,
+                mData.begin() + 4 * dataSize + NandBCHInterface::sectorSize);
+    EXPECT_EQ(mData, mDecoded);
+}
+
+TEST_F(NandBCHBatchTest, rejectsTooSmallBuffers)
+{
+    EXPECT_FALSE(mCodec.encodePages(
+            outpost::asSlice(mData), outpost::asSlice(mEncoded), numberOfPages + 1));
+    EXPECT_EQ(DecodeStatus::invalidParameters,
+              mCodec.decodePages(outpost::asSlice(mEncoded),
+                                 outpost::asSlice(mDecoded),
+                                 sectorStatus().first(sectorsPerPage),
+                                 numberOfPages));
+    EXPECT_EQ(DecodeStatus::invalidParameters,
+              mCodec.decodeSectors(outpost::asSlice(mEncoded).first(pageSize),
+                                   outpost::asSlice(mDecoded).first(dataSize),
+                                   sectorStatus().first(sectorsPerPage - 1)));
+}
+
+TEST_F(NandBCHBatchTest, runtimeVariantReportsStatusPerSector)
+{
+    static NandBCHRTime<13, 8, dataSize, spareSize> codec;
+    ASSERT_TRUE(codec.encodePages(
+            outpost::asSlice(mData), outpost::asSlice(mEncoded), numberOfPages));
+    injectErrors();
+
+    EXPECT_EQ(DecodeStatus::uncorrectable,
+              codec.decodePages(outpost::asSlice(mEncoded),
+                                outpost::asSlice(mDecoded),
+                                sectorStatus(),
+                                numberOfPages));
+    expectSectorStatus();
+}
+
+TEST_F(NandBCHBatchTest, workersMustMatchPageLayout)
+{
+    NandBCHCTime<13, 8, 512, 16> otherCodec;
+    NandBCHWorker otherWorker(otherCodec, 1);
+    Codec codec;
+    NandBCHWorker worker(codec, 1);
+
+    NandBCHParallelCodec parallel(mCodec);
+    EXPECT_FALSE(parallel.addWorker(otherWorker));
+    EXPECT_TRUE(parallel.addWorker(worker));
+    EXPECT_FALSE(parallel.addWorker(worker));
+    EXPECT_EQ(1U, parallel.getNumberOfWorkers());
+}
+
+TEST_F(NandBCHBatchTest, parallelWithoutWorkersMatchesSequential)
+{
+    NandBCHParallelCodec parallel(mCodec);
+
+    std::vector<uint8_t> expected(mEncoded.size());
+    ASSERT_TRUE(mCodec.encodePages(
+            outpost::asSlice(mData), outpost::asSlice(expected), numberOfPages));
+    ASSERT_TRUE(parallel.encodePages(
+            outpost::asSlice(mData), outpost::asSlice(mEncoded), numberOfPages));
+    EXPECT_EQ(expected, mEncoded);
+
+    injectErrors();
+    EXPECT_EQ(DecodeStatus::uncorrectable,
+              parallel.decodePages(outpost::asSlice(mEncoded),
+                                   outpost::asSlice(mDecoded),
+                                   sectorStatus(),
+                                   numberOfPages));
+    expectSectorStatus();
+}
+
+TEST_F(NandBCHBatchTest, parallelWithWorkersMatchesSequential)
+{
+    // The workers wait for the next batch when the test ends, the destructor
+    // of the thread cancels and joins them
+    Codec parallelCodec;
+    Codec workerCodecs[2];
+    NandBCHWorker firstWorker(workerCodecs[0], 1);
+    NandBCHWorker secondWorker(workerCodecs[1], 1);
+
+    NandBCHParallelCodec parallel(parallelCodec);
+    ASSERT_TRUE(parallel.addWorker(firstWorker));
+    ASSERT_TRUE(parallel.addWorker(secondWorker));
+    firstWorker.start();
+    secondWorker.start();
+
+    std::vector<uint8_t> expected(mEncoded.size());
+    ASSERT_TRUE(mCodec.encodePages(
+            outpost::asSlice(mData), outpost::asSlice(expected), numberOfPages));
+
+    // Several batches with the same workers
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        std::fill(mEncoded.begin(), mEncoded.end(), 0);
+        ASSERT_TRUE(parallel.encodePages(
+                outpost::asSlice(mData), outpost::asSlice(mEncoded), numberOfPages));
+        EXPECT_EQ(expected, mEncoded);
+
+        injectErrors();
+        std::fill(mSectorStatus.begin(), mSectorStatus.end(), DecodeStatus::invalidParameters);
+        EXPECT_EQ(DecodeStatus::uncorrectable,
+                  parallel.decodePages(outpost::asSlice(mEncoded),
+                                       outpost::asSlice(mDecoded),
+                                       sectorStatus(),
+                                       numberOfPages));
+        expectSectorStatus();
+    }
+
+    // Batches with less pages than threads
+    std::fill(mSectorStatus.begin(), mSectorStatus.end(), DecodeStatus::invalidParameters);
+    EXPECT_EQ(DecodeStatus::noError,
+              parallel.decodePages(outpost::asSlice(expected),
+                                   outpost::asSlice(mDecoded),
+                                   sectorStatus(),
+                                   1));
+    EXPECT_EQ(DecodeStatus::noError, mSectorStatus[0]);
+    EXPECT_EQ(DecodeStatus::invalidParameters, mSectorStatus[sectorsPerPage]);
+    EXPECT_TRUE(parallel.encodePages(outpost::asSlice(mData), outpost::asSlice(mEncoded), 0));
+}
+
+namespace
+{
+/// Implements only the original interface, as out-of-tree codecs do
+class ForwardingCodec : public NandBCHInterface
+{
+public:
+    explicit ForwardingCodec(NandBCHInterface& codec) : mCodec(codec)
+    {
+    }
+
+    bool
+    isChecksumEmpty(const outpost::Slice<const uint8_t>& data) override
+    {
+        return mCodec.isChecksumEmpty(data);
+    }
+
+    bool
+    encode(const outpost::Slice<const uint8_t>& src_data,
+           const outpost::Slice<uint8_t>& coded_data) override
+    {
+        return mCodec.encode(src_data, coded_data);
+    }
+
+    DecodeStatus
+    decode(const outpost::Slice<const uint8_t>& coded_data,
+           const outpost::Slice<uint8_t>& src_data) override
+    {
+        return mCodec.decode(coded_data, src_data);
+    }
+
+    uint32_t
+    getNumberOfRedundantBytes(void) const override
+    {
+        return mCodec.getNumberOfRedundantBytes();
+    }
+
+    uint32_t
+    getNumberOfDatabytes(void) const override
+    {
+        return mCodec.getNumberOfDatabytes();
+    }
+
+    bool
+    isTemplateParameterValid(void) const override
+    {
+        return mCodec.isTemplateParameterValid();
+    }
+
+private:
+    NandBCHInterface& mCodec;
+};
+}  // namespace
+
+TEST_F(NandBCHBatchTest, defaultsReportPageStatusForEverySector)
+{
+    ForwardingCodec codec(mCodec);
+    EXPECT_EQ(mCodec.getNumberOfRedundantBytes(), codec.getNumberOfSparebytes());
+
+    ASSERT_TRUE(mCodec.encodePages(
+            outpost::asSlice(mData), outpost::asSlice(mEncoded), numberOfPages));
+    injectErrors();
+
+    const outpost::Slice<const uint8_t> page =
+            outpost::asSlice(mEncoded).subSlice(pageSize, pageSize);
+    const outpost::Slice<uint8_t> decoded = outpost::asSlice(mDecoded).first(dataSize);
+    EXPECT_EQ(DecodeStatus::invalidParameters,
+              codec.decodeSectors(page, decoded, sectorStatus().first(sectorsPerPage - 1)));
+
+    EXPECT_EQ(DecodeStatus::corrected, codec.decodeSectors(page, decoded, sectorStatus()));
+    for (uint32_t i = 0; i < sectorsPerPage; i++)
+    {
+        EXPECT_EQ(DecodeStatus::corrected, mSectorStatus[i]) << "sector " << i;
+    }
+    EXPECT_TRUE(
+            std::equal(mData.begin() + dataSize, mData.begin() + 2 * dataSize, mDecoded.begin()));
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/rtos/thread.h>
+#include <outpost/utils/container/mpsc_reference_queue.h>
+#include <outpost/utils/container/shared_object_pool.h>
+
+#include <unittest/harness.h>
+
+#include <array>
+#include <functional>
+#include <future>
+
+using namespace outpost::utils;
+
+namespace
+{
+constexpr uint32_t numberOfSenders = 4;
+constexpr uint32_t valuesPerSender = 2000;
+
+typedef MpscReferenceQueue<uint32_t, 8> Queue;
+
+/**
+ * Sends an increasing sequence of values tagged with the sender number,
+ * retries while the queue is full.
+ */
+void
+sendSequence(Queue& queue, uint32_t sender)
+{
+    for (uint32_t i = 0; i < valuesPerSender; i++)
+    {
+        uint32_t value = (sender << 16) | i;
+        while (!queue.send(value))
+        {
+            outpost::rtos::Thread::yield();
+        }
+    }
+}
+}  // namespace
+
+TEST(MpscReferenceQueueTest, status)
+{
+    MpscReferenceQueue<int, 3> queue;
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_FALSE(queue.isFull());
+
+    int values[] = {1, 2, 3, 4};
+    EXPECT_TRUE(queue.send(values[0]));
+    EXPECT_TRUE(queue.send(values[1]));
+    EXPECT_TRUE(queue.send(values[2]));
+    EXPECT_FALSE(queue.send(values[3]));
+
+    EXPECT_FALSE(queue.isEmpty());
+    EXPECT_TRUE(queue.isFull());
+    EXPECT_EQ(3U, queue.getNumberOfItems());
+}
+
+TEST(MpscReferenceQueueTest, keepsOrderAcrossRounds)
+{
+    MpscReferenceQueue<int, 3> queue;
+    int received = 0;
+    EXPECT_FALSE(queue.receive(received, outpost::time::Duration::zero()));
+
+    for (int i = 0; i < 10; i++)
+    {
+        int first = 2 * i;
+        int second = 2 * i + 1;
+        ASSERT_TRUE(queue.send(first));
+        ASSERT_TRUE(queue.send(second));
+
+        ASSERT_TRUE(queue.receive(received, outpost::time::Duration::zero()));
+        EXPECT_EQ(first, received);
+        ASSERT_TRUE(queue.receive(received, outpost::time::Milliseconds(1)));
+        EXPECT_EQ(second, received);
+        EXPECT_TRUE(queue.isEmpty());
+    }
+}
+
+TEST(MpscReferenceQueueTest, releasesReferences)
+{
+    SharedBufferPool<8, 2> pool;
+    MpscReferenceQueue<SharedBufferPointer, 2> queue;
+    {
+        SharedBufferPointer pointer;
+        ASSERT_TRUE(pool.allocate(pointer));
+        ASSERT_TRUE(queue.send(pointer));
+    }
+    EXPECT_EQ(1U, pool.numberOfFreeElements());
+
+    {
+        SharedBufferPointer pointer;
+        ASSERT_TRUE(queue.receive(pointer, outpost::time::Duration::zero()));
+        EXPECT_TRUE(pointer.isValid());
+    }
+    EXPECT_EQ(2U, pool.numberOfFreeElements());
+}
+
+TEST(MpscReferenceQueueTest, receiveTimesOut)
+{
+    MpscReferenceQueue<int, 2> queue;
+    int received = 0;
+    EXPECT_FALSE(queue.receive(received, outpost::time::Milliseconds(10)));
+
+    int value = 5;
+    EXPECT_TRUE(queue.send(value));
+    EXPECT_TRUE(queue.receive(received, outpost::time::Milliseconds(10)));
+    EXPECT_EQ(5, received);
+}
+
+TEST(MpscReferenceQueueTest, concurrentSenders)
+{
+    Queue queue;
+    std::array<std::future<void>, numberOfSenders> senders;
+    for (uint32_t i = 0; i < numberOfSenders; i++)
+    {
+        senders[i] = std::async(std::launch::async, sendSequence, std::ref(queue), i);
+    }
+
+    // The values of each sender arrive in the order they were sent
+    std::array<uint32_t, numberOfSenders> next = {};
+    for (uint32_t i = 0; i < numberOfSenders * valuesPerSender; i++)
+    {
+        uint32_t value = 0;
+        ASSERT_TRUE(queue.receive(value, outpost::time::Seconds(10)));
+        const uint32_t sender = value >> 16;
+        ASSERT_LT(sender, numberOfSenders);
+        EXPECT_EQ(next[sender], value & 0xFFFF);
+        next[sender]++;
+    }
+
+    for (auto& sender : senders)
+    {
+        sender.get();
+    }
+    EXPECT_TRUE(queue.isEmpty());
+}
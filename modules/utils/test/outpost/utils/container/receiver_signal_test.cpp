@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/rtos/clock.h>
+#include <outpost/utils/container/receiver_signal.h>
+
+#include <gtest/gtest.h>
+
+#if OUTPOST_UTILS_LOCK_FREE_ATOMICS
+#include <atomic>
+#include <future>
+
+using namespace outpost::utils;
+
+TEST(ReceiverSignalTest, waitsForTheFullTimeout)
+{
+    ReceiverSignal signal;
+    outpost::rtos::SystemClock clock;
+    uint32_t numberOfPolls = 0;
+
+    const outpost::time::SpacecraftElapsedTime start = clock.now();
+    EXPECT_FALSE(signal.wait(
+            [&numberOfPolls]() {
+                numberOfPolls++;
+                return false;
+            },
+            outpost::time::Milliseconds(20)));
+    EXPECT_GE(clock.now() - start, outpost::time::Milliseconds(20));
+    EXPECT_GT(numberOfPolls, 1U);
+}
+
+TEST(ReceiverSignalTest, notifyWakesUpReceiver)
+{
+    ReceiverSignal signal;
+    std::atomic<bool> available(false);
+
+    std::future<void> sender = std::async(std::launch::async, [&]() {
+        available.store(true, std::memory_order_relaxed);
+        signal.notify();
+    });
+    EXPECT_TRUE(signal.wait([&available]() { return available.load(std::memory_order_relaxed); },
+                            outpost::time::Seconds(10)));
+    sender.get();
+}
+
+TEST(ReceiverSignalTest, earlyWakeUpWaitsForTheRemainingTime)
+{
+    ReceiverSignal signal;
+    std::atomic<uint32_t> round(0);
+
+    // Notify without an element, as a late signal of an earlier wait
+    std::future<void> sender = std::async(std::launch::async, [&]() {
+        while (round.load() == 0)
+        {
+            outpost::rtos::Thread::yield();
+        }
+        signal.notify();
+    });
+
+    outpost::rtos::SystemClock clock;
+    const outpost::time::SpacecraftElapsedTime start = clock.now();
+    EXPECT_FALSE(signal.wait(
+            [&round]() {
+                round++;
+                return false;
+            },
+            outpost::time::Milliseconds(50)));
+    EXPECT_GE(clock.now() - start, outpost::time::Milliseconds(50));
+    sender.get();
+}
+#endif
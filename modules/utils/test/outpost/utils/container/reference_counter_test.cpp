@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/utils/container/reference_counter.h>
+#include <outpost/utils/container/shared_buffer.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <future>
+
+using namespace outpost::utils;
+
+namespace
+{
+constexpr uint32_t numberOfThreads = 4;
+constexpr uint32_t iterations = 20000;
+}  // namespace
+
+template <typename T>
+class ReferenceCounterTest : public ::testing::Test
+{
+public:
+    T mCounter;
+};
+
+#if OUTPOST_UTILS_ATOMIC_REFERENCE_COUNTER
+typedef ::testing::Types<reference_counter::Atomic, reference_counter::MutexProtected>
+        ReferenceCounterTypes;
+#else
+typedef ::testing::Types<reference_counter::MutexProtected> ReferenceCounterTypes;
+#endif
+TYPED_TEST_SUITE(ReferenceCounterTest, ReferenceCounterTypes);
+
+TYPED_TEST(ReferenceCounterTest, startsAtZero)
+{
+    EXPECT_EQ(0U, this->mCounter.get());
+}
+
+TYPED_TEST(ReferenceCounterTest, reportsReleaseOfLastReference)
+{
+    this->mCounter.increment();
+    this->mCounter.increment();
+    EXPECT_EQ(2U, this->mCounter.get());
+
+    EXPECT_FALSE(this->mCounter.decrement());
+    EXPECT_EQ(1U, this->mCounter.get());
+    EXPECT_TRUE(this->mCounter.decrement());
+    EXPECT_EQ(0U, this->mCounter.get());
+}
+
+TYPED_TEST(ReferenceCounterTest, doesNotDecrementBelowZero)
+{
+    EXPECT_FALSE(this->mCounter.decrement());
+    EXPECT_EQ(0U, this->mCounter.get());
+
+    this->mCounter.increment();
+    EXPECT_EQ(1U, this->mCounter.get());
+}
+
+TEST(SharedBufferReferenceCountTest, concurrentCopiesKeepCount)
+{
+    std::array<uint8_t, 16> data;
+    SharedBuffer buffer(outpost::asSlice(data));
+    {
+        SharedBufferPointer pointer(&buffer);
+        std::array<std::future<void>, numberOfThreads> copies;
+        for (auto& copy : copies)
+        {
+            copy = std::async(std::launch::async, [&]() {
+                for (uint32_t i = 0; i < iterations; i++)
+                {
+                    SharedBufferPointer first(pointer);
+                    SharedBufferPointer second;
+                    second = first;
+                }
+            });
+        }
+        for (auto& copy : copies)
+        {
+            copy.get();
+        }
+
+        EXPECT_EQ(1U, buffer.getReferenceCount());
+    }
+    EXPECT_FALSE(buffer.isUsed());
+}
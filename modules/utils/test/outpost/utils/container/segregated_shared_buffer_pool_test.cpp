@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/utils/container/segregated_shared_buffer_pool.h>
+
+#include <gtest/gtest.h>
+
+using namespace outpost::utils;
+
+class SegregatedSharedBufferPoolTest : public ::testing::Test
+{
+public:
+    SegregatedSharedBufferPoolTest() :
+        mSizeClasses{&mSmallBuffers, &mMediumBuffers, &mLargeBuffers},
+        mPool(outpost::asSlice(mSizeClasses))
+    {
+    }
+
+    SharedBufferPool<16, 4> mSmallBuffers;
+    SharedBufferPool<128, 2> mMediumBuffers;
+    SharedBufferPool<1024, 1> mLargeBuffers;
+    SharedBufferPoolBase* mSizeClasses[3];
+
+    SegregatedSharedBufferPool mPool;
+};
+
+TEST_F(SegregatedSharedBufferPoolTest, reportsCombinedSize)
+{
+    EXPECT_EQ(7U, mPool.numberOfElements());
+    EXPECT_EQ(7U, mPool.numberOfFreeElements());
+    EXPECT_EQ(1024U, mPool.getElementSize());
+    EXPECT_EQ(0U, mPool.getHighWaterMark());
+
+    ASSERT_EQ(3U, mPool.getNumberOfSizeClasses());
+    EXPECT_EQ(16U, mPool.getSizeClass(0).getElementSize());
+    EXPECT_EQ(1024U, mPool.getSizeClass(2).getElementSize());
+}
+
+TEST_F(SegregatedSharedBufferPoolTest, allocatesSmallestFittingBuffer)
+{
+    SharedBufferPointer small;
+    SharedBufferPointer exact;
+    SharedBufferPointer medium;
+    ASSERT_TRUE(mPool.allocate(small, 1));
+    ASSERT_TRUE(mPool.allocate(exact, 16));
+    ASSERT_TRUE(mPool.allocate(medium, 17));
+
+    EXPECT_EQ(16U, small.getLength());
+    EXPECT_EQ(16U, exact.getLength());
+    EXPECT_EQ(128U, medium.getLength());
+    EXPECT_EQ(2U, mSmallBuffers.numberOfFreeElements());
+    EXPECT_EQ(1U, mMediumBuffers.numberOfFreeElements());
+    EXPECT_EQ(1U, mLargeBuffers.numberOfFreeElements());
+}
+
+TEST_F(SegregatedSharedBufferPoolTest, usesLargerClassIfClassIsExhausted)
+{
+    SharedBufferPointer pointers[5];
+    for (auto& pointer : pointers)
+    {
+        ASSERT_TRUE(mPool.allocate(pointer, 10));
+    }
+    EXPECT_EQ(128U, pointers[4].getLength());
+
+    ConstSharedBufferPointer constPointers[3];
+    ASSERT_TRUE(mPool.allocate(constPointers[0], 10));
+    ASSERT_TRUE(mPool.allocate(constPointers[1], 10));
+    EXPECT_EQ(128U, constPointers[0].getLength());
+    EXPECT_EQ(1024U, constPointers[1].getLength());
+    EXPECT_FALSE(mPool.allocate(constPointers[2], 10));
+}
+
+TEST_F(SegregatedSharedBufferPoolTest, rejectsTooLargeRequests)
+{
+    SharedBufferPointer pointer;
+    EXPECT_FALSE(mPool.allocate(pointer, 1025));
+    EXPECT_FALSE(pointer.isValid());
+    EXPECT_EQ(7U, mPool.numberOfFreeElements());
+}
+
+TEST_F(SegregatedSharedBufferPoolTest, allocationWithoutSizeUsesLargestClass)
+{
+    SharedBufferPointer pointer;
+    ASSERT_TRUE(mPool.allocate(pointer));
+    EXPECT_EQ(1024U, pointer.getLength());
+
+    SharedBufferPointer second;
+    EXPECT_FALSE(mPool.allocate(second));
+}
+
+TEST_F(SegregatedSharedBufferPoolTest, tracksHighWaterMarkPerClass)
+{
+    {
+        SharedBufferPointer pointers[3];
+        for (auto& pointer : pointers)
+        {
+            ASSERT_TRUE(mPool.allocate(pointer, 16));
+        }
+        SharedBufferPointer medium;
+        ASSERT_TRUE(mPool.allocate(medium, 100));
+        EXPECT_EQ(3U, mPool.numberOfFreeElements());
+    }
+
+    EXPECT_EQ(7U, mPool.numberOfFreeElements());
+    EXPECT_EQ(3U, mPool.getSizeClass(0).getHighWaterMark());
+    EXPECT_EQ(1U, mPool.getSizeClass(1).getHighWaterMark());
+    EXPECT_EQ(0U, mPool.getSizeClass(2).getHighWaterMark());
+    EXPECT_EQ(4U, mPool.getHighWaterMark());
+}
+
+TEST(SharedBufferPoolMinimumSizeTest, singleSizePoolChecksSize)
+{
+    SharedBufferPool<32, 2> pool;
+    SharedBufferPointer pointer;
+    EXPECT_FALSE(pool.allocate(pointer, 33));
+    EXPECT_TRUE(pool.allocate(pointer, 32));
+
+    ConstSharedBufferPointer constPointer;
+    EXPECT_TRUE(pool.allocate(constPointer, 0));
+    EXPECT_EQ(2U, pool.getHighWaterMark());
+}
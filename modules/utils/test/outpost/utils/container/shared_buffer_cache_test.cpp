@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/utils/container/shared_buffer_cache.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <functional>
+#include <future>
+#include <set>
+
+using namespace outpost::utils;
+
+namespace
+{
+constexpr size_t objectSize = 8;
+constexpr size_t poolSize = 32;
+constexpr size_t magazineSize = 4;
+constexpr uint32_t numberOfThreads = 4;
+constexpr uint32_t iterations = 5000;
+constexpr uint32_t keptBuffers = 2;
+
+typedef SharedBufferPool<objectSize, poolSize> Pool;
+
+typedef std::array<SharedBufferPointer, keptBuffers> KeptBuffers;
+
+/**
+ * Allocates buffers from its own cache. The last buffers are kept and
+ * released later by the test thread.
+ *
+ * \return Number of buffers that have not been owned exclusively
+ */
+uint32_t
+allocateWithCache(Pool& pool, uint8_t marker, KeptBuffers& kept)
+{
+    uint32_t errors = 0;
+    SharedBufferCache<magazineSize> cache(pool);
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        SharedBufferPointer pointer;
+        if (cache.allocate(pointer))
+        {
+            pointer[0] = marker;
+            kept[i % keptBuffers] = pointer;
+            if (pointer[0] != marker)
+            {
+                errors++;
+            }
+        }
+    }
+    for (auto& pointer : kept)
+    {
+        if (!pointer.isValid() || (pointer[0] != marker))
+        {
+            errors++;
+        }
+    }
+    return errors;
+}
+}  // namespace
+
+class SharedBufferCacheTest : public ::testing::Test
+{
+public:
+    Pool mPool;
+};
+
+TEST_F(SharedBufferCacheTest, refillsMagazineAtOnce)
+{
+    SharedBufferCache<magazineSize> cache(mPool);
+    EXPECT_EQ(magazineSize, cache.getMagazineSize());
+    EXPECT_EQ(0U, cache.getNumberOfCachedBuffers());
+
+    SharedBufferPointer pointer;
+    ASSERT_TRUE(cache.allocate(pointer));
+    EXPECT_EQ(objectSize, pointer.getLength());
+    EXPECT_EQ(magazineSize - 1, cache.getNumberOfCachedBuffers());
+    EXPECT_EQ(poolSize - magazineSize, mPool.numberOfFreeElements());
+    EXPECT_EQ(poolSize - 1, cache.numberOfFreeElements());
+    EXPECT_EQ(magazineSize, mPool.getHighWaterMark());
+}
+
+TEST_F(SharedBufferCacheTest, releasedBufferReturnsToPool)
+{
+    SharedBufferCache<magazineSize> cache(mPool);
+    {
+        ConstSharedBufferPointer pointer;
+        ASSERT_TRUE(cache.allocate(pointer));
+    }
+    EXPECT_EQ(poolSize - magazineSize + 1, mPool.numberOfFreeElements());
+    EXPECT_EQ(magazineSize - 1, cache.getNumberOfCachedBuffers());
+}
+
+TEST_F(SharedBufferCacheTest, flushReturnsCachedBuffers)
+{
+    {
+        SharedBufferCache<magazineSize> cache(mPool);
+        SharedBufferPointer pointer;
+        ASSERT_TRUE(cache.allocate(pointer));
+        cache.flush();
+        EXPECT_EQ(0U, cache.getNumberOfCachedBuffers());
+        EXPECT_EQ(poolSize - 1, mPool.numberOfFreeElements());
+
+        ASSERT_TRUE(cache.allocate(pointer));
+        EXPECT_EQ(magazineSize - 1, cache.getNumberOfCachedBuffers());
+    }
+    EXPECT_EQ(poolSize, mPool.numberOfFreeElements());
+}
+
+TEST_F(SharedBufferCacheTest, allocatesEveryBufferOnce)
+{
+    SharedBufferCache<5> cache(mPool);
+    std::array<SharedBufferPointer, poolSize> pointers;
+    std::set<const uint8_t*> addresses;
+    for (auto& pointer : pointers)
+    {
+        ASSERT_TRUE(cache.allocate(pointer));
+        addresses.insert(pointer.asSlice().getDataPointer());
+    }
+    EXPECT_EQ(poolSize, addresses.size());
+
+    SharedBufferPointer pointer;
+    EXPECT_FALSE(cache.allocate(pointer));
+    EXPECT_EQ(0U, cache.numberOfFreeElements());
+}
+
+TEST_F(SharedBufferCacheTest, checksMinimumSize)
+{
+    SharedBufferCache<magazineSize> cache(mPool);
+    SharedBufferPointer pointer;
+    EXPECT_FALSE(cache.allocate(pointer, objectSize + 1));
+    EXPECT_EQ(poolSize, mPool.numberOfFreeElements());
+    EXPECT_TRUE(cache.allocate(pointer, objectSize));
+}
+
+TEST_F(SharedBufferCacheTest, buffersAreReleasedOnOtherThread)
+{
+    std::array<KeptBuffers, numberOfThreads> kept;
+    std::array<std::future<uint32_t>, numberOfThreads> allocations;
+    for (uint32_t i = 0; i < numberOfThreads; i++)
+    {
+        allocations[i] = std::async(std::launch::async,
+                                    allocateWithCache,
+                                    std::ref(mPool),
+                                    static_cast<uint8_t>(i + 1),
+                                    std::ref(kept[i]));
+    }
+    for (auto& allocation : allocations)
+    {
+        EXPECT_EQ(0U, allocation.get());
+    }
+
+    // The caches are flushed, only the kept buffers are in use
+    EXPECT_EQ(poolSize - numberOfThreads * keptBuffers, mPool.numberOfFreeElements());
+    for (auto& buffers : kept)
+    {
+        for (auto& pointer : buffers)
+        {
+            pointer = SharedBufferPointer();
+        }
+    }
+    EXPECT_EQ(poolSize, mPool.numberOfFreeElements());
+
+    std::array<SharedBufferPointer, poolSize> pointers;
+    for (auto& pointer : pointers)
+    {
+        EXPECT_TRUE(mPool.allocate(pointer));
+    }
+}
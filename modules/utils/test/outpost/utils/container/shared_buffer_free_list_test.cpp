@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/utils/container/shared_object_pool.h>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <future>
+#include <set>
+#include <thread>
+
+using namespace outpost::utils;
+
+namespace
+{
+constexpr size_t objectSize = 8;
+constexpr size_t poolSize = 16;
+constexpr uint32_t numberOfThreads = 4;
+constexpr uint32_t iterations = 5000;
+
+typedef SharedBufferPool<objectSize, poolSize> Pool;
+
+/**
+ * Allocates buffers, writes to them and releases them again while the
+ * other threads do the same.
+ *
+ * \return Number of buffers that have not been owned exclusively
+ */
+uint32_t
+allocateConcurrently(Pool& pool, uint8_t marker)
+{
+    uint32_t errors = 0;
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        SharedBufferPointer first;
+        SharedBufferPointer second;
+        if (pool.allocate(first) && pool.allocate(second))
+        {
+            // Both buffers must be exclusively owned by this thread
+            first[0] = marker;
+            second[0] = static_cast<uint8_t>(marker + 1);
+            SharedBufferPointer copy = first;
+            if ((first == second) || (copy[0] != marker)
+                || (second[0] != static_cast<uint8_t>(marker + 1)))
+            {
+                errors++;
+            }
+        }
+    }
+    return errors;
+}
+}  // namespace
+
+class SharedBufferFreeListTest : public ::testing::Test
+{
+public:
+    Pool mPool;
+};
+
+TEST_F(SharedBufferFreeListTest, allocatesEveryBufferOnce)
+{
+    std::array<SharedBufferPointer, poolSize> pointers;
+    std::set<const uint8_t*> addresses;
+    for (auto& pointer : pointers)
+    {
+        ASSERT_TRUE(mPool.allocate(pointer));
+        addresses.insert(pointer.asSlice().getDataPointer());
+    }
+    EXPECT_EQ(poolSize, addresses.size());
+    EXPECT_EQ(0U, mPool.numberOfFreeElements());
+
+    SharedBufferPointer pointer;
+    EXPECT_FALSE(mPool.allocate(pointer));
+}
+
+TEST_F(SharedBufferFreeListTest, reusesLastReleasedBuffer)
+{
+    SharedBufferPointer first;
+    SharedBufferPointer second;
+    ASSERT_TRUE(mPool.allocate(first));
+    ASSERT_TRUE(mPool.allocate(second));
+    const uint8_t* address = first.asSlice().getDataPointer();
+
+    first = SharedBufferPointer();
+    EXPECT_EQ(poolSize - 1, mPool.numberOfFreeElements());
+
+    ASSERT_TRUE(mPool.allocate(first));
+    EXPECT_EQ(address, first.asSlice().getDataPointer());
+}
+
+TEST_F(SharedBufferFreeListTest, childKeepsBufferAllocated)
+{
+    SharedChildPointer child;
+    {
+        SharedBufferPointer parent;
+        ASSERT_TRUE(mPool.allocate(parent));
+        ASSERT_TRUE(parent.getChild(child, 1, 0, objectSize / 2));
+    }
+    EXPECT_EQ(poolSize - 1, mPool.numberOfFreeElements());
+
+    child = SharedChildPointer();
+    EXPECT_EQ(poolSize, mPool.numberOfFreeElements());
+}
+
+TEST_F(SharedBufferFreeListTest, constPointerReleasesBuffer)
+{
+    {
+        ConstSharedBufferPointer pointer;
+        ASSERT_TRUE(mPool.allocate(pointer));
+        EXPECT_EQ(poolSize - 1, mPool.numberOfFreeElements());
+    }
+    EXPECT_EQ(poolSize, mPool.numberOfFreeElements());
+}
+
+TEST_F(SharedBufferFreeListTest, concurrentAllocation)
+{
+    std::array<std::future<uint32_t>, numberOfThreads> allocations;
+    for (uint32_t i = 0; i < numberOfThreads; i++)
+    {
+        allocations[i] = std::async(std::launch::async,
+                                    allocateConcurrently,
+                                    std::ref(mPool),
+                                    static_cast<uint8_t>(2 * i));
+    }
+    for (auto& allocation : allocations)
+    {
+        EXPECT_EQ(0U, allocation.get());
+    }
+    EXPECT_EQ(poolSize, mPool.numberOfFreeElements());
+
+    std::array<SharedBufferPointer, poolSize> pointers;
+    for (auto& pointer : pointers)
+    {
+        EXPECT_TRUE(mPool.allocate(pointer));
+    }
+}
+
+TEST(SharedBufferFreeListHandoverTest, nextOwnerSeesWritesOfEarlierHolders)
+{
+    SharedBufferPool<objectSize, 1> pool;
+    for (uint32_t i = 0; i < iterations; i++)
+    {
+        SharedBufferPointer pointer;
+        ASSERT_TRUE(pool.allocate(pointer));
+
+        // The flag is not ordered with the write, only the reference
+        // counter and the free list publish the write to the next owner
+        std::atomic<bool> written(false);
+        std::future<void> holder = std::async(std::launch::async, [&written, pointer]() mutable {
+            pointer[0] = 0x5A;
+            pointer = SharedBufferPointer();
+            written.store(true, std::memory_order_relaxed);
+        });
+        while (!written.load(std::memory_order_relaxed))
+        {
+            std::this_thread::yield();
+        }
+
+        // Drop the last reference while the holder thread may still be running
+        pointer = SharedBufferPointer();
+        ASSERT_TRUE(pool.allocate(pointer));
+        EXPECT_EQ(0x5A, pointer[0]);
+        pointer[0] = 0;
+        holder.get();
+    }
+}
+
+TEST(SharedBufferFreeListBatchTest, allocatesAndReleasesSeveralBuffers)
+{
+    std::array<SharedBuffer, 4> buffers;
+    std::array<SharedBufferFreeList::Link, 4> links;
+    SharedBufferFreeList list;
+    list.initialize(buffers.data(), links.data(), buffers.size());
+
+    SharedBuffer* allocated[3];
+    ASSERT_EQ(3U, list.allocate(outpost::asSlice(allocated)));
+    EXPECT_EQ(&buffers[0], allocated[0]);
+    EXPECT_EQ(&buffers[2], allocated[2]);
+    EXPECT_EQ(1U, list.getNumberOfFreeBuffers());
+
+    SharedBuffer* remaining[3];
+    ASSERT_EQ(1U, list.allocate(outpost::asSlice(remaining)));
+    EXPECT_EQ(&buffers[3], remaining[0]);
+    EXPECT_EQ(0U, list.allocate(outpost::asSlice(remaining)));
+    EXPECT_EQ(0U, list.getMinimumNumberOfFreeBuffers());
+
+    list.release(outpost::asSlice(allocated));
+    EXPECT_EQ(3U, list.getNumberOfFreeBuffers());
+    EXPECT_EQ(allocated[0], list.allocate());
+    EXPECT_EQ(allocated[1], list.allocate());
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026, German Aerospace Center (DLR)
+ *
+ * This file is part of the development version of OUTPOST.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <outpost/rtos/thread.h>
+#include <outpost/utils/container/shared_object_pool.h>
+#include <outpost/utils/container/spsc_reference_queue.h>
+
+#include <unittest/harness.h>
+
+#include <functional>
+#include <future>
+
+using namespace outpost::utils;
+
+namespace
+{
+constexpr uint32_t numberOfValues = 20000;
+
+typedef SpscReferenceQueue<uint32_t, 8> Queue;
+
+/**
+ * Sends an increasing sequence of values, retries while the queue is full.
+ */
+void
+sendSequence(Queue& queue)
+{
+    for (uint32_t i = 0; i < numberOfValues; i++)
+    {
+        uint32_t value = i;
+        while (!queue.send(value))
+        {
+            outpost::rtos::Thread::yield();
+        }
+    }
+}
+}  // namespace
+
+TEST(SpscReferenceQueueTest, status)
+{
+    SpscReferenceQueue<int, 3> queue;
+    EXPECT_TRUE(queue.isEmpty());
+    EXPECT_FALSE(queue.isFull());
+
+    int values[] = {1, 2, 3, 4};
+    EXPECT_TRUE(queue.send(values[0]));
+    EXPECT_TRUE(queue.send(values[1]));
+    EXPECT_TRUE(queue.send(values[2]));
+    EXPECT_FALSE(queue.send(values[3]));
+
+    EXPECT_FALSE(queue.isEmpty());
+    EXPECT_TRUE(queue.isFull());
+    EXPECT_EQ(3U, queue.getNumberOfItems());
+}
+
+TEST(SpscReferenceQueueTest, keepsOrderAcrossRounds)
+{
+    SpscReferenceQueue<int, 3> queue;
+    int received = 0;
+    EXPECT_FALSE(queue.receive(received, outpost::time::Duration::zero()));
+
+    for (int i = 0; i < 10; i++)
+    {
+        int first = 2 * i;
+        int second = 2 * i + 1;
+        ASSERT_TRUE(queue.send(first));
+        ASSERT_TRUE(queue.send(second));
+
+        ASSERT_TRUE(queue.receive(received, outpost::time::Duration::zero()));
+        EXPECT_EQ(first, received);
+        ASSERT_TRUE(queue.receive(received, outpost::time::Milliseconds(1)));
+        EXPECT_EQ(second, received);
+        EXPECT_TRUE(queue.isEmpty());
+    }
+}
+
+TEST(SpscReferenceQueueTest, releasesReferences)
+{
+    SharedBufferPool<8, 2> pool;
+    SpscReferenceQueue<SharedBufferPointer, 2> queue;
+    {
+        SharedBufferPointer pointer;
+        ASSERT_TRUE(pool.allocate(pointer));
+        ASSERT_TRUE(queue.send(pointer));
+    }
+    EXPECT_EQ(1U, pool.numberOfFreeElements());
+
+    {
+        SharedBufferPointer pointer;
+        ASSERT_TRUE(queue.receive(pointer, outpost::time::Duration::zero()));
+        EXPECT_TRUE(pointer.isValid());
+    }
+    EXPECT_EQ(2U, pool.numberOfFreeElements());
+}
+
+TEST(SpscReferenceQueueTest, receiveTimesOut)
+{
+    SpscReferenceQueue<int, 2> queue;
+    int received = 0;
+    EXPECT_FALSE(queue.receive(received, outpost::time::Milliseconds(10)));
+
+    int value = 5;
+    EXPECT_TRUE(queue.send(value));
+    EXPECT_TRUE(queue.receive(received, outpost::time::Milliseconds(10)));
+    EXPECT_EQ(5, received);
+}
+
+TEST(SpscReferenceQueueTest, singleElement)
+{
+    SpscReferenceQueue<int, 1> queue;
+    int value = 3;
+    int received = 0;
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_TRUE(queue.send(value));
+        EXPECT_TRUE(queue.isFull());
+        EXPECT_FALSE(queue.send(value));
+        ASSERT_TRUE(queue.receive(received, outpost::time::Duration::zero()));
+        EXPECT_EQ(3, received);
+        EXPECT_TRUE(queue.isEmpty());
+    }
+}
+
+TEST(SpscReferenceQueueTest, concurrentSender)
+{
+    Queue queue;
+    std::future<void> sender = std::async(std::launch::async, sendSequence, std::ref(queue));
+
+    for (uint32_t i = 0; i < numberOfValues; i++)
+    {
+        uint32_t value = 0;
+        ASSERT_TRUE(queue.receive(value, outpost::time::Seconds(10)));
+        EXPECT_EQ(i, value);
+    }
+
+    sender.get();
+    EXPECT_TRUE(queue.isEmpty());
+}
@@ -296,3 +296,119 @@ TEST(BitstreamTest, deserializeFail)
         EXPECT_EQ(bitstream.getSerializedSize(), 3U);
     }
 }
+
+TEST(BitstreamTest, pushBitsEqualsSingleBits)
+{
+    memset(buffer_in, 0xFF, ARRAY_LENGTH);
+    memset(buffer_out, 0, ARRAY_LENGTH);
+    outpost::Bitstream words(data_in);
+    outpost::Bitstream bits(data_out);
+
+    uint32_t value = 0x12345678U;
+    uint8_t count = 0;
+    while (!bits.isFull())
+    {
+        // Counts from 0 to 32, the last ones exceed the end of the buffer
+        words.pushBits(value, count);
+        for (int8_t i = count - 1; i >= 0; i--)
+        {
+            bits.pushBit((value >> i) & 1U);
+        }
+        ASSERT_EQ(bits.getSize(), words.getSize());
+
+        value = value * 1664525U + 1013904223U;
+        count = (count + 7) % 33;
+    }
+
+    EXPECT_TRUE(words.isFull());
+    EXPECT_ARRAY_EQ(uint8_t,
+                    &buffer_out[Bitstream::headerSize],
+                    &buffer_in[Bitstream::headerSize],
+                    ARRAY_LENGTH - Bitstream::headerSize);
+
+    for (uint32_t i = 0; i < 8U * words.getSize(); i++)
+    {
+        ASSERT_EQ(bits.getBit(i), words.readBit()) << "bit " << i;
+    }
+}
+
+TEST(BitstreamTest, readBits)
+{
+    memset(buffer_in, 0, ARRAY_LENGTH);
+    outpost::Bitstream bitstream(data_in);
+
+    bitstream.pushBits(0x5, 3);
+    bitstream.pushBits(0xABCDEF01U, 32);
+    bitstream.pushBits(0x1, 1);
+    bitstream.pushBits(0x3FF, 10);
+
+    EXPECT_EQ(bitstream.getReadPosition(), 0U);
+    EXPECT_EQ(bitstream.readBits(3), 0x5U);
+    EXPECT_EQ(bitstream.readBits(32), 0xABCDEF01U);
+    EXPECT_TRUE(bitstream.readBit());
+    EXPECT_EQ(bitstream.readBits(10), 0x3FFU);
+    EXPECT_EQ(bitstream.getReadPosition(), 46U);
+
+    // Beyond the end of the stream
+    EXPECT_EQ(bitstream.readBits(32), 0U);
+
+    bitstream.setReadPosition(5);
+    for (uint32_t i = 5; i < 46; i++)
+    {
+        EXPECT_EQ(bitstream.getBit(i), bitstream.readBit());
+    }
+
+    bitstream.reset();
+    EXPECT_EQ(bitstream.getReadPosition(), 0U);
+    EXPECT_EQ(bitstream.readBits(8), 0U);
+}
+
+TEST(BitstreamTest, readBitsAfterDeserialize)
+{
+    memset(buffer_in, 0, ARRAY_LENGTH);
+    memset(buffer_out, 0, ARRAY_LENGTH);
+    outpost::Bitstream bitstream(data_in);
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        bitstream.pushBits(i, 7);
+    }
+    outpost::Serialize stream(data_in);
+    bitstream.serialize(stream);
+
+    outpost::Bitstream received(data_out);
+    outpost::Deserialize input(data_in);
+    ASSERT_TRUE(received.deserialize(input));
+    for (uint32_t i = 0; i < 100; i++)
+    {
+        EXPECT_EQ(i, received.readBits(7));
+    }
+}
+
+TEST(BitstreamTest, streamLargerThan64KiB)
+{
+    constexpr size_t length = 70000U;
+    static uint8_t largeBuffer[length];
+    static uint8_t serializedBuffer[length];
+    outpost::Slice<uint8_t> data(largeBuffer);
+    outpost::Bitstream bitstream(data);
+
+    while (!bitstream.isFull())
+    {
+        bitstream.pushBits(0xA5, 8);
+    }
+    EXPECT_EQ(bitstream.getSize(), length - Bitstream::headerSize);
+    EXPECT_EQ(bitstream.getByte(69000U), 0xA5);
+    EXPECT_TRUE(bitstream.getBit(8U * 69000U));
+
+    bitstream.setReadPosition(8U * 68000U);
+    EXPECT_EQ(bitstream.readBits(16), 0xA5A5U);
+
+    // The header only holds 16 bit sizes, the stream is cut
+    EXPECT_EQ(bitstream.getSerializedSize(), 0xFFFFU + Bitstream::headerSize);
+    outpost::Serialize stream(serializedBuffer);
+    bitstream.serialize(stream);
+    EXPECT_EQ(serializedBuffer[0], 7);
+    EXPECT_EQ(serializedBuffer[1], 0xFF);
+    EXPECT_EQ(serializedBuffer[2], 0xFF);
+    EXPECT_EQ(stream.getPosition(), 0xFFFFU + Bitstream::headerSize);
+}